@@ -0,0 +1,105 @@
+# Shared by the tasks which ask the Deluge to dump some stats over sysex, and print the debug log lines it sends back
+import time
+import argparse
+import util
+
+# Deluge header, debug namespace, debug log message command
+LOG_MESSAGE_HEADER = [0xF0, 0x00, 0x21, 0x7B, 0x01, 0x03, 0x40, 0x00]
+
+
+def argparser(prog, description, example):
+    parser = argparse.ArgumentParser(
+        prog=prog,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        description=description,
+        epilog=f"""\nusage example: dbt {prog} --reset 123
+                  {example}""",
+        exit_on_error=False,
+    )
+    parser.group = "Development"
+    parser.add_argument(
+        "ports",
+        nargs="*",
+        help=f"""MIDI output and input port numbers. Example: 123 312. If only one port
+                number is given, same number is used for both. If no port numbers are
+                given, first output and input ports whose names start with "Deluge",
+                if any, are automatically used. Use 'dbt {prog} -h' to list
+                available ports""",
+        type=int,
+    )
+    parser.add_argument(
+        "-r",
+        "--reset",
+        action="store_true",
+        help="reset the counters once they have been dumped",
+    )
+    parser.add_argument(
+        "-t",
+        "--timeout",
+        type=float,
+        default=2.0,
+        help="seconds to wait for the dump to complete",
+    )
+    return parser
+
+
+def dump_stats(midiout, midiin, request, what, reset, timeout):
+    midiin.ignore_types(False, True, True)
+
+    midiout.send_message(request + [0x01 if reset else 0x00, 0xF7])
+
+    end_of_stats = f"end {what}"
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        msg_and_dt = midiin.get_message()
+        if not msg_and_dt:
+            # add a short sleep so the while loop doesn't hammer your cpu
+            time.sleep(0.01)
+            continue
+        (msg, _) = msg_and_dt
+        if msg[0 : len(LOG_MESSAGE_HEADER)] != LOG_MESSAGE_HEADER:
+            continue
+        line = bytearray(msg[len(LOG_MESSAGE_HEADER) : -1]).decode("ascii").rstrip("\n")
+        if line == end_of_stats:
+            return True
+        print(line, flush=True)
+
+    util.note(f"ERROR: timed out waiting for {what}")
+    return False
+
+
+def main(parser, request, what):
+    try:
+        import rtmidi
+    except ImportError:
+        util.install_rtmidi()
+    finally:
+        import rtmidi
+
+    midiout = rtmidi.MidiOut()
+    midiin = rtmidi.MidiIn()
+
+    ok = False
+    try:
+        args = parser.parse_args()
+        outport, inport, *_ = args.ports + [None, None]
+
+        if outport and not inport:
+            inport = outport
+
+        outport = util.ensure_midi_port("output", midiout, outport)
+        inport = util.ensure_midi_port("input ", midiin, inport)
+
+        midiout.open_port(outport)
+        midiin.open_port(inport)
+        ok = True
+    except Exception as e:
+        util.note(f"ERROR: {e}")
+    finally:
+        if not ok:
+            util.report_available_midi_ports("output", midiout)
+            util.report_available_midi_ports("input", midiin)
+            exit(1)
+
+    if not dump_stats(midiout, midiin, request, what, args.reset, args.timeout):
+        exit(1)
@@ -0,0 +1,21 @@
+#! /usr/bin/env python3
+import sysex_stats
+
+# Deluge header, debug namespace, memory stats command
+MEMORY_STATS_REQUEST = [0xF0, 0x00, 0x21, 0x7B, 0x01, 0x03, 0x03]
+
+
+def argparser():
+    return sysex_stats.argparser(
+        "memory-stats",
+        "Dump memory fragmentation and steal telemetry via MIDI",
+        "dump memory telemetry from port # 123 then reset the counters",
+    )
+
+
+def main():
+    sysex_stats.main(argparser(), MEMORY_STATS_REQUEST, "memory stats")
+
+
+if __name__ == "__main__":
+    main()
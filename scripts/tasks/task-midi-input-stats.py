@@ -0,0 +1,21 @@
+#! /usr/bin/env python3
+import sysex_stats
+
+# Deluge header, debug namespace, MIDI input queue stats command
+MIDI_INPUT_STATS_REQUEST = [0xF0, 0x00, 0x21, 0x7B, 0x01, 0x03, 0x05]
+
+
+def argparser():
+    return sysex_stats.argparser(
+        "midi-input-stats",
+        "Dump how many incoming MIDI messages were queued and coalesced via MIDI",
+        "dump MIDI input queue stats from port # 123 then reset the counters",
+    )
+
+
+def main():
+    sysex_stats.main(argparser(), MIDI_INPUT_STATS_REQUEST, "midi input stats")
+
+
+if __name__ == "__main__":
+    main()
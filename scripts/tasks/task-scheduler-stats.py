@@ -0,0 +1,21 @@
+#! /usr/bin/env python3
+import sysex_stats
+
+# Deluge header, debug namespace, scheduler stats command
+SCHEDULER_STATS_REQUEST = [0xF0, 0x00, 0x21, 0x7B, 0x01, 0x03, 0x04]
+
+
+def argparser():
+    return sysex_stats.argparser(
+        "scheduler-stats",
+        "Dump task scheduler histograms and recent scheduling decisions via MIDI",
+        "dump scheduler stats from port # 123 then reset the counters",
+    )
+
+
+def main():
+    sysex_stats.main(argparser(), SCHEDULER_STATS_REQUEST, "scheduler stats")
+
+
+if __name__ == "__main__":
+    main()
@@ -62,6 +62,17 @@ uint8_t addOnceTask(TaskHandle task, uint8_t priority, double timeToWait, const
 /// interfere with scheduling
 uint8_t addConditionalTask(TaskHandle task, uint8_t priority, RunCondition condition, const char* name,
                            ResourceID resources);
+/// Set the deadline of a task, as the time after its target call time by which it must have started. Only used when
+/// scheduling by earliest deadline. Defaults to maxTimeBetweenCalls - targetTimeBetweenCalls.
+void setTaskDeadline(TaskID id, double deadline);
+/// Switch between scheduling by priority (the default) and by earliest deadline first. In the latter mode a more
+/// important task still goes first when running the earliest deadline task would make it miss its own deadline.
+void setSchedulerDeadlineMode(bool earliestDeadlineFirst);
+/// Writes per task run time and jitter histograms, overrun counts, and the most recent scheduling decisions, one line
+/// at a time
+void writeSchedulerStats(void (*writeLine)(char const* line));
+/// Clears the per task stats, but not the log of recent scheduling decisions
+void resetSchedulerStats();
 void ignoreForStats();
 double getAverageRunTimeforCurrentTask();
 double getSystemTime();
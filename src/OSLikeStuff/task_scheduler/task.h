@@ -19,6 +19,7 @@
 #define DELUGE_TASK_H
 #include "OSLikeStuff/scheduler_api.h"
 #include "resource_checker.h"
+#include <array>
 // internal to the scheduler - do not include from anywhere else
 struct StatBlock {
 
@@ -44,6 +45,27 @@ struct StatBlock {
 	}
 };
 
+/// Counts of durations in power of two buckets of microseconds - bucket 0 is under 1us, bucket n is [2^(n-1), 2^n)us
+/// and the last one takes everything longer. Averages hide the occasional long run that causes an audio dropout
+struct LogHistogram {
+	static constexpr int32_t kNumBuckets = 16;
+
+	std::array<uint32_t, kNumBuckets> counts{};
+
+	[[nodiscard]] static int32_t getBucket(Time v) {
+		dTime ticks = v;
+		if (ticks <= 0) {
+			return 0;
+		}
+		// 33.33 ticks per microsecond
+		uint64_t micros = static_cast<uint64_t>(ticks) * 3 / 100;
+		int32_t bucket = (micros == 0) ? 0 : 64 - __builtin_clzll(micros);
+		return std::min(bucket, kNumBuckets - 1);
+	}
+	[[gnu::hot]] void add(Time v) { counts[getBucket(v)] += 1; }
+	void reset() { counts = {}; }
+};
+
 struct TaskSchedule {
 	// 0 is highest priority
 	uint8_t priority;
@@ -53,6 +75,9 @@ struct TaskSchedule {
 	Time targetInterval;
 	// maximum time between function calls
 	Time maxInterval;
+	// time after the target call time by which the task must have started, only used when scheduling by earliest
+	// deadline. 0 means maxInterval - targetInterval
+	Time deadline{0};
 };
 
 enum class State {
@@ -84,6 +109,17 @@ struct Task {
 	}
 
 	void updateNextTimes(Time startTime, Time runtime) {
+		// the first call has no interval to measure
+		if (timesCalled > 0) {
+			Time interval = startTime - lastCallTime;
+			Time jitter = interval > schedule.targetInterval ? interval - schedule.targetInterval
+			                                                 : Time(schedule.targetInterval) - interval;
+			jitterHistogram.add(jitter);
+			if (interval > schedule.maxInterval) {
+				overruns += 1;
+			}
+		}
+		runTimeHistogram.add(runtime);
 
 		lastCallTime = startTime;
 
@@ -95,6 +131,31 @@ struct Task {
 		idealCallTime = startTime + schedule.targetInterval - durationStats.average;
 		latestCallTime = startTime + schedule.maxInterval - durationStats.average;
 	}
+	/// Absolute deadline for starting the next call. Before the first call there's no target call time yet, so it's
+	/// counted from when the task was added
+	[[nodiscard]] Time getDeadline() const {
+		Time target = idealCallTime != Time(0) ? idealCallTime : lastCallTime;
+		return target + getRelativeDeadline();
+	}
+	/// How long after its target call time the deadline falls
+	[[nodiscard]] Time getRelativeDeadline() const {
+		if (schedule.deadline == Time(0)) {
+			return Time(schedule.maxInterval) - Time(schedule.targetInterval);
+		}
+		return schedule.deadline;
+	}
+
+	void updateDeadlineStats(Time startTime) {
+		// the first call has nothing to be late against
+		if (idealCallTime == Time(0)) {
+			return;
+		}
+		worstLatency = std::max(worstLatency, Time(startTime) - Time(idealCallTime));
+		if (startTime > getDeadline()) {
+			deadlineMisses += 1;
+		}
+	}
+
 	// returns true if the task becomes runnable
 	bool checkCondition() {
 		if (condition != nullptr && state == State::BLOCKED) {
@@ -133,6 +194,14 @@ struct Task {
 	Time totalTime{0};
 	int32_t timesCalled{0};
 	Time lastRunTime;
+	// how late the task started against its target call time, worst case
+	Time worstLatency{0};
+	int32_t deadlineMisses{0};
+	LogHistogram runTimeHistogram;
+	// difference between the actual and target time between calls
+	LogHistogram jitterHistogram;
+	// times the time between calls exceeded maxInterval
+	int32_t overruns{0};
 
 	ResourceChecker _checker;
 };
@@ -20,6 +20,7 @@
 #include "io/debug/log.h"
 #include "resource_checker.h"
 #include <algorithm>
+#include <cstdio>
 
 #if !IN_UNIT_TESTS
 #include "memory/general_memory_allocator.h"
@@ -50,6 +51,9 @@ void TaskManager::createSortedList() {
 
 // deadline < 0 means no deadline
 TaskID TaskManager::chooseBestTask(Time deadline) {
+	if (schedulingMode == SchedulingMode::EARLIEST_DEADLINE) {
+		return chooseBestTaskByDeadline(deadline);
+	}
 	Time currentTime = getSecondsFromStart();
 	Time nextFinishTime = currentTime;
 	TaskID bestTask = -1;
@@ -65,6 +69,7 @@ TaskID TaskManager::chooseBestTask(Time deadline) {
 		}
 		// ensure every routine is within its target
 		if (currentTime - t->lastCallTime > s->maxInterval) {
+			lastReason = ScheduleReason::OVERDUE;
 			return sortedList[i].task;
 		}
 		if (t->idealCallTime < currentTime || t->latestCallTime < nextFinishTime) {
@@ -87,35 +92,124 @@ TaskID TaskManager::chooseBestTask(Time deadline) {
 	// if we didn't find a task because something high priority needs to wait to run, find the next task we can do
 	// before it needs to start
 	if (bestTask == -1) {
-		// first look based on target time
-		for (int i = (numActiveTasks - 1); i >= 0; i--) {
-			struct Task* t = &list[sortedList[i].task];
-			if (!t->isRunnable()) {
-				continue;
-			}
-			struct TaskSchedule* s = &t->schedule;
-			if (currentTime + t->durationStats.average < nextFinishTime
-			    && currentTime - t->lastFinishTime > s->targetInterval
-			    && currentTime - t->lastFinishTime > s->backOffPeriod) {
-				return sortedList[i].task;
-			}
+		return chooseTaskToFillGap(currentTime, nextFinishTime);
+	}
+	lastReason = ScheduleReason::PRIORITY;
+	return bestTask;
+}
+
+/// Earliest deadline first among the tasks that are due. If running that one would push a more important task past
+/// its own deadline, even one that isn't due yet, the more important task goes first or is waited for - so when
+/// deadlines collide, the audio routine and cluster loading still win over UI work. That only stops once the less
+/// important task has missed its own deadline, otherwise it could be starved indefinitely.
+TaskID TaskManager::chooseBestTaskByDeadline(Time deadline) {
+	Time currentTime = getSecondsFromStart();
+	Time nextReleaseTime = std::numeric_limits<Time>::infinity();
+	TaskID bestTask = -1;
+	Time bestDeadline{0};
+
+	auto canRunNow = [&](Task* t) {
+		return t->isReady(currentTime)
+		       && (deadline < Time(0) || currentTime + t->durationStats.average < deadline);
+	};
+
+	for (int i = 0; i < numActiveTasks; i++) {
+		TaskID id = sortedList[i].task;
+		struct Task* t = &list[id];
+		if (!t->isRunnable()) {
+			continue;
 		}
-		// then look based on min time just to avoid busy waiting
-		for (int i = (numActiveTasks - 1); i >= 0; i--) {
-			struct Task* t = &list[sortedList[i].task];
-			if (!t->isRunnable()) {
-				continue;
-			}
-			struct TaskSchedule* s = &t->schedule;
-			if (currentTime + t->durationStats.average < nextFinishTime
-			    && currentTime - t->lastFinishTime > s->backOffPeriod) {
-				return sortedList[i].task;
-			}
+		if (t->idealCallTime > currentTime) {
+			nextReleaseTime = std::min(nextReleaseTime, t->idealCallTime);
+			continue;
+		}
+		if (!canRunNow(t)) {
+			continue;
+		}
+		Time taskDeadline = t->getDeadline();
+		if (bestTask == -1 || taskDeadline < bestDeadline) {
+			bestTask = id;
+			bestDeadline = taskDeadline;
 		}
 	}
+
+	if (bestTask == -1) {
+		return chooseTaskToFillGap(currentTime, nextReleaseTime, true);
+	}
+
+	lastReason = ScheduleReason::EARLIEST_DEADLINE;
+	if (bestDeadline < currentTime) {
+		return bestTask;
+	}
+	// sortedList is least important first, so walk it backwards until we get to the task we picked. Use the longest
+	// run of the picked task since a single late audio render is audible
+	Time bestFinishTime = currentTime + std::max(list[bestTask].durationStats.average, list[bestTask].durationStats.max);
+	uint8_t bestPriority = list[bestTask].schedule.priority;
+	for (int i = (numActiveTasks - 1); i >= 0; i--) {
+		TaskID id = sortedList[i].task;
+		struct Task* t = &list[id];
+		if (t->schedule.priority >= bestPriority) {
+			break;
+		}
+		if (!t->isRunnable() || t->getDeadline() >= bestFinishTime) {
+			continue;
+		}
+		// Running it ahead of its target only helps if the picked task will then fit in before it's needed again.
+		// Otherwise it would just get called more and more often than its target while the picked task waits
+		Time periodIfRunNow =
+		    Time(t->schedule.targetInterval) - t->durationStats.average + t->getRelativeDeadline();
+		bool worthRunningEarly = periodIfRunNow >= t->durationStats.average + (bestFinishTime - currentTime);
+		if ((t->idealCallTime <= currentTime || worthRunningEarly) && canRunNow(t)) {
+			lastReason = ScheduleReason::DEADLINE_COLLISION;
+			return id;
+		}
+		// it isn't due yet or is still backing off from its last run, so only fill in with things that will be done
+		// by the time it can go
+		Time gapEnd = (t->idealCallTime > currentTime) ? t->idealCallTime : t->getDeadline();
+		return chooseTaskToFillGap(currentTime, gapEnd, true);
+	}
 	return bestTask;
 }
 
+/// Finds something that can be done before nextFinishTime, when nothing is due to run. For earliest deadline first,
+/// only tasks which have reached their target interval are considered, and only if their longest run fits - it hits
+/// the gaps between releases far more often than priority mode does, and would otherwise call everything as often as
+/// its back off allows
+TaskID TaskManager::chooseTaskToFillGap(Time currentTime, Time nextFinishTime, bool forDeadlines) {
+	lastReason = ScheduleReason::FILL_IN;
+	// first look based on target time
+	for (int i = (numActiveTasks - 1); i >= 0; i--) {
+		struct Task* t = &list[sortedList[i].task];
+		if (!t->isRunnable()) {
+			continue;
+		}
+		struct TaskSchedule* s = &t->schedule;
+		Time duration =
+		    forDeadlines ? std::max(t->durationStats.average, t->durationStats.max) : t->durationStats.average;
+		if (currentTime + duration < nextFinishTime
+		    && currentTime - t->lastFinishTime > s->targetInterval
+		    && currentTime - t->lastFinishTime > s->backOffPeriod) {
+			return sortedList[i].task;
+		}
+	}
+	if (forDeadlines) {
+		return -1;
+	}
+	// then look based on min time just to avoid busy waiting
+	for (int i = (numActiveTasks - 1); i >= 0; i--) {
+		struct Task* t = &list[sortedList[i].task];
+		if (!t->isRunnable()) {
+			continue;
+		}
+		struct TaskSchedule* s = &t->schedule;
+		if (currentTime + t->durationStats.average < nextFinishTime
+		    && currentTime - t->lastFinishTime > s->backOffPeriod) {
+			return sortedList[i].task;
+		}
+	}
+	return -1;
+}
+
 /// insert task into the first empty spot in the list
 TaskID TaskManager::insertTaskToList(Task task) {
 	int8_t index = 0;
@@ -179,6 +273,12 @@ Time TaskManager::getAverageRunTimeForCurrentTask() {
 	return currentTask->durationStats.average;
 }
 
+void TaskManager::setDeadline(TaskID id, Time deadline) {
+	if (id >= 0 && id < kMaxTasks) {
+		list[id].schedule.deadline = deadline;
+	}
+}
+
 void TaskManager::setNextRunTimeforCurrentTask(Time seconds) {
 	auto currentTask = &list[currentID];
 	currentTask->schedule.maxInterval = seconds;
@@ -192,6 +292,14 @@ void TaskManager::runTask(TaskID id) {
 	overhead += timeNow - lastFinishTime;
 	currentID = id;
 	auto currentTask = &list[currentID];
+	if (!currentTask->removeAfterUse) {
+		currentTask->updateDeadlineStats(startTime);
+	}
+	// filled in now since the task is gone by the end if it only runs once
+	SchedulingDecision decision{startTime, 0, 0, id, lastReason, currentTask->name};
+	if (currentTask->idealCallTime != Time(0)) {
+		decision.lateness = startTime - currentTask->idealCallTime;
+	}
 
 	currentTask->handle();
 	timeNow = getSecondsFromStart();
@@ -210,6 +318,14 @@ void TaskManager::runTask(TaskID id) {
 	}
 	currentTask->lastFinishTime = timeNow;
 	lastFinishTime = timeNow;
+	decision.runTime = runtime;
+	logDecision(decision);
+}
+
+void TaskManager::logDecision(const SchedulingDecision& decision) {
+	decisionLog[nextDecision] = decision;
+	nextDecision = (nextDecision + 1) % kNumLoggedDecisions;
+	numLoggedDecisions = std::min(numLoggedDecisions + 1, kNumLoggedDecisions);
 }
 
 /// pause current task, continue to run scheduler loop until a condition is met, then return to it
@@ -329,6 +445,11 @@ void TaskManager::resetStats() {
 			task.totalTime = 0;
 			task.timesCalled = 0;
 			task.durationStats.reset();
+			task.worstLatency = 0;
+			task.deadlineMisses = 0;
+			task.runTimeHistogram.reset();
+			task.jitterHistogram.reset();
+			task.overruns = 0;
 #if SCHEDULER_DETAILED_STATS
 			task.latency.reset();
 #endif
@@ -338,6 +459,68 @@ void TaskManager::resetStats() {
 	overhead = 0;
 }
 
+static const char* scheduleReasonToString(ScheduleReason reason) {
+	switch (reason) {
+	case ScheduleReason::OVERDUE:
+		return "overdue";
+	case ScheduleReason::PRIORITY:
+		return "priority";
+	case ScheduleReason::FILL_IN:
+		return "fill in";
+	case ScheduleReason::EARLIEST_DEADLINE:
+		return "deadline";
+	case ScheduleReason::DEADLINE_COLLISION:
+		return "collision";
+	default:
+		return "";
+	}
+}
+
+static int32_t toMicroseconds(Time t) {
+	return static_cast<int32_t>(double(t) * 1000000);
+}
+
+void TaskManager::writeStats(void (*writeLine)(char const* line)) {
+	char line[128];
+
+	writeLine("histogram buckets: <1,<2,<4,<8,<16,<32,<64,<128,<256,<512us,<1,<2,<4,<8,<16ms,more");
+	for (auto& task : list) {
+		if (!task.handle) {
+			continue;
+		}
+		snprintf(line, sizeof(line), "%s: called %d, overruns %d, missed %d, worst late %d us", task.name,
+		         static_cast<int32_t>(task.timesCalled), static_cast<int32_t>(task.overruns),
+		         static_cast<int32_t>(task.deadlineMisses), toMicroseconds(task.worstLatency));
+		writeLine(line);
+		for (auto* histogram : {&task.runTimeHistogram, &task.jitterHistogram}) {
+			int32_t length =
+			    snprintf(line, sizeof(line), histogram == &task.runTimeHistogram ? "  run time:" : "  jitter:  ");
+			for (uint32_t count : histogram->counts) {
+				// Past the end, snprintf() only says how long the line would have been
+				if (length >= static_cast<int32_t>(sizeof(line))) {
+					break;
+				}
+				length += snprintf(line + length, sizeof(line) - length, " %lu", static_cast<unsigned long>(count));
+			}
+			writeLine(line);
+		}
+	}
+
+	snprintf(line, sizeof(line), "last %d scheduling decisions, oldest first:", numLoggedDecisions);
+	writeLine(line);
+	if (numLoggedDecisions == 0) {
+		return;
+	}
+	Time lastStart = getDecision(0).startTime;
+	for (int32_t age = numLoggedDecisions - 1; age >= 0; age--) {
+		const SchedulingDecision& decision = getDecision(age);
+		snprintf(line, sizeof(line), "  %8d us ago: ran %6d us, late %6d us, %-9s %s",
+		         toMicroseconds(lastStart - decision.startTime), toMicroseconds(decision.runTime),
+		         toMicroseconds(decision.lateness), scheduleReasonToString(decision.reason), decision.name);
+		writeLine(line);
+	}
+}
+
 void TaskManager::printStats() {
 	D_PRINTLN("Dumping task manager stats: (min/ average/ max)");
 	for (auto task : list) {
@@ -348,6 +531,7 @@ void TaskManager::printStats() {
 			D_PRINTLN("Load: %5.2f, "                             //<
 			          "Dur: %8.3f/%8.3f/%9.3f us "                //<
 			          "Latency: %8.3f/%8.3f/%8.3f ms "            //<
+			          "Worst late: %8.3f ms, Missed: %6d "        //<
 			          "N: %10d, Task: %s",                        //<
 			          100.0 * task.totalTime / cpuTime,           //<
 			          durationScale * task.durationStats.min,     //<
@@ -356,6 +540,8 @@ void TaskManager::printStats() {
 			          latencyScale * task.latency.min,            //<
 			          latencyScale * task.latency.average,        //<
 			          latencyScale * task.latency.max,            //<
+			          latencyScale * task.worstLatency,           //<
+			          task.deadlineMisses,                        //<
 			          task.timesCalled, task.name);
 #else
 #ifdef NEVER
@@ -371,6 +557,9 @@ void TaskManager::printStats() {
 	auto totalTime = cpuTime + overhead;
 	D_PRINTLN("Working time: %5.2f, Overhead: %5.2f. Total running time: %5.2f seconds",
 	          double(cpuTime * 100) / double(totalTime), double(overhead * 100) / double(totalTime), runningTime);
+#if SCHEDULER_DETAILED_STATS
+	writeStats([](char const* line) { D_PRINTLN("%s", line); });
+#endif
 	resetStats();
 }
 Time getTimerValueSeconds(int timerNo) {
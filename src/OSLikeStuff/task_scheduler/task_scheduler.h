@@ -18,6 +18,41 @@ struct SortedTask {
 };
 // currently 14 are in use
 constexpr int kMaxTasks = 25;
+
+enum class SchedulingMode {
+	/// run the least important task that can finish before a more important task needs to start
+	PRIORITY,
+	/// run the due task with the earliest deadline, unless that would make a more important task miss its own
+	EARLIEST_DEADLINE,
+};
+
+/// Why chooseBestTask() picked a task
+enum class ScheduleReason : uint8_t {
+	/// it had gone longer than maxInterval without running
+	OVERDUE,
+	/// least important task that could finish before a more important one needs to start
+	PRIORITY,
+	/// nothing was due, so this was run in the gap before something is
+	FILL_IN,
+	/// due task with the earliest deadline
+	EARLIEST_DEADLINE,
+	/// a more important task that would have missed its deadline behind the earliest deadline task
+	DEADLINE_COLLISION,
+};
+
+struct SchedulingDecision {
+	Time startTime;
+	Time runTime;
+	// how late it started against its target call time, negative if early
+	Time lateness;
+	TaskID task;
+	ScheduleReason reason;
+	const char* name;
+};
+
+// enough to cover the few ms around an audio dropout
+constexpr int kNumLoggedDecisions = 64;
+
 /// internal only to the task scheduler, hence all public. External interaction to use the api
 struct TaskManager {
 
@@ -25,6 +60,8 @@ struct TaskManager {
 	void removeTask(TaskID id);
 	void runTask(TaskID id);
 	TaskID chooseBestTask(Time deadline);
+	TaskID chooseBestTaskByDeadline(Time deadline);
+	TaskID chooseTaskToFillGap(Time currentTime, Time nextFinishTime, bool forDeadlines = false);
 	TaskID addRepeatingTask(TaskHandle task, TaskSchedule schedule, const char* name, ResourceChecker resources);
 
 	TaskID addOnceTask(TaskHandle task, uint8_t priority, Time timeToWait, const char* name, ResourceChecker resources);
@@ -43,6 +80,19 @@ struct TaskManager {
 
 	Time getAverageRunTimeForCurrentTask();
 
+	void setDeadline(TaskID id, Time deadline);
+	void setSchedulingMode(SchedulingMode mode) { schedulingMode = mode; }
+	[[nodiscard]] const Task& getTask(TaskID id) const { return list[id]; }
+
+	/// Writes per task histograms and the recent scheduling decisions, oldest first, one line at a time
+	void writeStats(void (*writeLine)(char const* line));
+	/// Decisions ago, 0 being the most recent. Only valid up to getNumLoggedDecisions()
+	[[nodiscard]] const SchedulingDecision& getDecision(int32_t age) const {
+		return decisionLog[(nextDecision - 1 - age + kNumLoggedDecisions) % kNumLoggedDecisions];
+	}
+	[[nodiscard]] int32_t getNumLoggedDecisions() const { return numLoggedDecisions; }
+	void resetStats();
+
 private:
 	// All current tasks
 	// Not all entries are filled - removed entries have a null task handle
@@ -53,6 +103,7 @@ private:
 	uint8_t numRegisteredTasks = 0;
 	Time mustEndBefore = -1; // use for testing or I guess if you want a second temporary task manager?
 	bool running{false};
+	SchedulingMode schedulingMode{SchedulingMode::PRIORITY};
 	Time cpuTime{0};
 	Time overhead{0};
 	Time lastFinishTime{0};
@@ -62,7 +113,11 @@ private:
 	// for time tracking with rollover
 	Time lastTime{0};
 	Time runningTime{0};
-	void resetStats();
+	ScheduleReason lastReason{ScheduleReason::PRIORITY};
+	std::array<SchedulingDecision, kNumLoggedDecisions> decisionLog{};
+	int32_t nextDecision{0};
+	int32_t numLoggedDecisions{0};
+	void logDecision(const SchedulingDecision& decision);
 	// needs to be volatile, GCC misses that the handle call can call ignoreForStats and optimizes the check away
 	volatile bool countThisTask{true};
 	void startClock();
@@ -52,6 +52,22 @@ uint8_t addConditionalTask(TaskHandle task, uint8_t priority, RunCondition condi
 	return taskManager.addConditionalTask(task, priority, condition, name, ResourceChecker{resources});
 }
 
+void setTaskDeadline(TaskID id, double deadline) {
+	taskManager.setDeadline(id, deadline);
+}
+
+void setSchedulerDeadlineMode(bool earliestDeadlineFirst) {
+	taskManager.setSchedulingMode(earliestDeadlineFirst ? SchedulingMode::EARLIEST_DEADLINE : SchedulingMode::PRIORITY);
+}
+
+void writeSchedulerStats(void (*writeLine)(char const* line)) {
+	taskManager.writeStats(writeLine);
+}
+
+void resetSchedulerStats() {
+	taskManager.resetStats();
+}
+
 void yield(RunCondition until) {
 	taskManager.yield(until);
 }
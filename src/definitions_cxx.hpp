@@ -210,6 +210,7 @@ enum class UIType : uint8_t {
 	CONTEXT_MENU,
 	DX_BROWSER,
 	INSTRUMENT_CLIP,
+	IR_BROWSER,
 	KEYBOARD_SCREEN,
 	LOAD_INSTRUMENT_PRESET,
 	LOAD_MIDI_DEVICE_DEFINITION,
@@ -878,6 +879,8 @@ enum class StealableQueue {
 	NO_SONG_SAMPLE_DATA_REPITCHED_CACHE,
 	NO_SONG_SAMPLE_DATA_PERC_CACHE,
 	NO_SONG_AUDIO_FILE_OBJECTS, // TODO:having these in the Stealable region is a bad idea in general
+	NEXT_SONG_SAMPLE_DATA,      // Warmed up for the song waiting in the background to be swapped in
+	NEXT_SONG_SAMPLE_DATA_CONVERTED,
 	CURRENT_SONG_SAMPLE_DATA,
 	CURRENT_SONG_SAMPLE_DATA_CONVERTED,
 	CURRENT_SONG_SAMPLE_DATA_REPITCHED_CACHE,
@@ -885,7 +888,7 @@ enum class StealableQueue {
 	                                     // to load it all again
 };
 
-constexpr int32_t kNumStealableQueue = 10;
+constexpr int32_t kNumStealableQueue = 12;
 
 enum class SequenceDirection {
 	FORWARD,
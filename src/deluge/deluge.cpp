@@ -20,6 +20,7 @@
 #include "RZA1/sdhi/inc/sdif.h"
 #include "definitions_cxx.hpp"
 #include "drivers/pic/pic.h"
+#include "dsp/convolution/convolution_fx.h"
 #include "gui/ui/audio_recorder.h"
 #include "gui/ui/browser/browser.h"
 #include "gui/ui/keyboard/keyboard_screen.h"
@@ -62,6 +63,7 @@
 #include "processing/engines/cv_engine.h"
 #include "scheduler_api.h"
 #include "storage/audio/audio_file_manager.h"
+#include "storage/cluster/cluster_prefetcher.h"
 #include "storage/flash_storage.h"
 #include "storage/smsysex.h"
 #include "storage/storage_manager.h"
@@ -93,6 +95,7 @@ extern "C" void disk_timerproc(UINT msPassed);
 
 Song* currentSong = nullptr;
 Song* preLoadedSong = nullptr;
+Song* songBeingPreloaded = nullptr;
 
 bool sdRoutineLock = false;
 
@@ -230,6 +233,7 @@ extern "C" void openUSBPeripheral();
 extern "C" void closeUSBPeripheral(void);
 
 uint32_t picFirmwareVersion = 0;
+uint32_t timeLastUserInput = 0;
 bool picSaysOLEDPresent = false;
 
 bool isShortPress(uint32_t pressTime) {
@@ -293,6 +297,7 @@ bool readButtonsAndPads() {
 	if (anything) {
 
 		if (value < PIC::kPadAndButtonMessagesEnd) {
+			timeLastUserInput = AudioEngine::audioSampleTimer;
 
 			int32_t thisPadPressIsOn = nextPadPressIsOn;
 			nextPadPressIsOn = USE_DEFAULT_VELOCITY;
@@ -569,6 +574,9 @@ void registerTasks() {
 	// - keep track of average time a task takes
 	// - run the least important task that can finish before
 	//   a more important task needs to start
+	// - or with the Deadline scheduling community feature on, run
+	//   the task with the earliest deadline unless a more important
+	//   task would miss its own
 	//
 	// Explicit gaps at 10, 20, 30, 40 for dynamic tasks.
 	//
@@ -585,8 +593,11 @@ void registerTasks() {
 	                 RESOURCE_NONE);
 	addRepeatingTask([]() { playbackHandler.midiRoutine(); }, p++, 2 / 44100., 16 / 44100, 32 / 44100.,
 	                 "playback routine", RESOURCE_SD | RESOURCE_USB);
-	addRepeatingTask([]() { audioFileManager.loadAnyEnqueuedClusters(128, false); }, p++, 0.00001, 0.00001, 0.00002,
-	                 "load clusters", RESOURCE_NONE);
+	TaskID loadClusters = addRepeatingTask([]() { audioFileManager.loadAnyEnqueuedClusters(128, false); }, p++,
+	                                       0.00001, 0.00001, 0.00002, "load clusters", RESOURCE_NONE);
+	// it's polled as often as possible but only has to keep up with the audio routine, which matters when scheduling by
+	// earliest deadline
+	setTaskDeadline(loadClusters, 0.002);
 	// handles sd card recorders
 	// named "slow" but isn't actually, it handles audio recording setup
 	addRepeatingTask(&AudioEngine::slowRoutine, p++, 0.001, 0.005, 0.05, "audio slow", RESOURCE_NONE);
@@ -614,6 +625,13 @@ void registerTasks() {
 	addRepeatingTask([]() { audioRecorder.slowRoutine(); }, p++, 0.01, 0.1, 0.1, "audio recorder slow", RESOURCE_NONE);
 	// formerly part of cluster loading (why? no idea), actions undo/redo midi commands
 	addRepeatingTask([]() { playbackHandler.slowRoutine(); }, p++, 0.01, 0.1, 0.1, "playback routine", RESOURCE_SD);
+	// looks ahead of the playhead for sample Clusters that notes are about to need
+	addRepeatingTask([]() { clusterPrefetcher.routine(); }, p++, 0.01, 0.05, 0.1, "cluster prefetch", RESOURCE_NONE);
+	// reads in the IR files convolution effects are waiting for, one at a time
+	addRepeatingTask(&ConvolutionFX::loadSomePending, p++, 0.01, 0.05, 0.5, "load convolution IRs", RESOURCE_SD);
+	// reads the next song in the background while playing, so it's ready to swap to
+	addRepeatingTask([]() { loadSongUI.preloadRoutine(); }, p++, 0.05, 0.1, 1, "preload next song",
+	                 RESOURCE_SD | RESOURCE_SD_ROUTINE);
 	// 31-39: Idle priority (40 for dyn tasks)
 	p = 31;
 	addRepeatingTask(&(PIC::flush), p++, 0.001, 0.001, 0.02, "PIC flush", RESOURCE_NONE);
@@ -662,6 +680,7 @@ void mainLoop() {
 		// Only actually needs calling a couple of times per second, but we can't put it in uiTimerManager cos that gets
 		// called in card routine
 		audioFileManager.slowRoutine();
+		clusterPrefetcher.routine();
 		AudioEngine::slowRoutine();
 
 		audioRecorder.slowRoutine();
@@ -870,6 +889,7 @@ extern "C" int32_t deluge_main(void) {
 
 	// Hopefully we can read these files now
 	runtimeFeatureSettings.readSettingsFromFile();
+	setSchedulerDeadlineMode(runtimeFeatureSettings.isOn(RuntimeFeatureSettingType::DeadlineScheduling));
 	MIDIDeviceManager::readDevicesFromFile();
 	midiFollow.readDefaultsFromFile();
 	PadLEDs::setBrightnessLevel(FlashStorage::defaultPadBrightness);
@@ -1075,6 +1095,9 @@ void deleteOldSongBeforeLoadingNew() {
 	view.activeModControllableModelStack.setTimelineCounter(nullptr);
 	view.activeModControllableModelStack.paramManager = nullptr;
 
+	// Let go of any clusters still held for notes in the old Song
+	clusterPrefetcher.releaseAll();
+
 	Song* toDelete = currentSong;
 	currentSong = nullptr;
 	void* toDealloc = dynamic_cast<void*>(toDelete);
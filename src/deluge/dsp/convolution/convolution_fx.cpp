@@ -0,0 +1,244 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dsp/convolution/convolution_fx.h"
+#include "io/debug/log.h"
+#include "memory/general_memory_allocator.h"
+#include "model/sample/sample.h"
+#include "storage/audio/audio_file_manager.h"
+#include "storage/cluster/cluster.h"
+#include <cmath>
+#include <new>
+
+ConvolutionFX* ConvolutionFX::firstPendingLoad = nullptr;
+
+namespace {
+
+// Frames can straddle Clusters, so this goes a byte at a time - there are only a few thousand frames in an IR
+class ClusterByteReader {
+public:
+	explicit ClusterByteReader(Sample& sample) : sample_(sample) {}
+	~ClusterByteReader() { release(); }
+
+	// Returns false if the Cluster couldn't be loaded
+	bool read(uint32_t bytePos, uint8_t& byte) {
+		int32_t clusterIndex = bytePos >> Cluster::size_magnitude;
+		if (clusterIndex != clusterIndex_) {
+			release();
+			cluster_ = sample_.clusters.getElement(clusterIndex)
+			               ->getCluster(&sample_, clusterIndex, CLUSTER_LOAD_IMMEDIATELY);
+			if (cluster_ == nullptr) {
+				return false;
+			}
+			clusterIndex_ = clusterIndex;
+		}
+		byte = cluster_->data[bytePos & (Cluster::size - 1)];
+		return true;
+	}
+
+private:
+	void release() {
+		if (cluster_ != nullptr) {
+			audioFileManager.removeReasonFromCluster(*cluster_, "E460");
+			cluster_ = nullptr;
+		}
+		clusterIndex_ = -1;
+	}
+
+	Sample& sample_;
+	Cluster* cluster_{nullptr};
+	int32_t clusterIndex_{-1};
+};
+
+// The Clusters hold native data by now, so each value is little-endian with the most significant byte last. The IR
+// comes out at unit energy, so it's about as loud as the dry signal
+Error readImpulseResponse(Sample& sample, ConvolutionBuffer& buffer, int32_t numIRChannels) {
+	constexpr int32_t kBlockSize = PartitionedConvolver::kBlockSize;
+	ClusterByteReader reader(sample);
+	int32_t bytesPerFrame = sample.byteDepth * sample.numChannels;
+	q31_t taps[2][kBlockSize];
+	float energy = 0;
+
+	for (int32_t frame = 0; frame < buffer.irLength; frame++) {
+		uint32_t frameStart = sample.audioDataStartPosBytes + frame * bytesPerFrame;
+		int32_t tap = frame & (kBlockSize - 1);
+		for (int32_t c = 0; c < numIRChannels; c++) {
+			uint32_t value = 0;
+			for (int32_t b = 0; b < sample.byteDepth; b++) {
+				uint8_t byte;
+				if (!reader.read(frameStart + c * sample.byteDepth + b, byte)) {
+					return Error::SD_CARD;
+				}
+				value |= (uint32_t)byte << (32 - 8 * (sample.byteDepth - b));
+			}
+			taps[c][tap] = value;
+			float tapValue = (q31_t)value / 2147483648.f;
+			energy += tapValue * tapValue;
+		}
+
+		if (tap == kBlockSize - 1 || frame == buffer.irLength - 1) {
+			for (int32_t c = 0; c < numIRChannels; c++) {
+				buffer.convolver.setPartition(c, frame >> PartitionedConvolver::kBlockSizeMagnitude, taps[c], tap + 1);
+			}
+		}
+	}
+
+	energy /= numIRChannels;
+	buffer.convolver.setGain((energy > 0) ? 1 / std::sqrt(energy) : 1);
+	return Error::NONE;
+}
+
+} // namespace
+
+ConvolutionFX::~ConvolutionFX() {
+	removeFromPendingLoads();
+	discardBuffer();
+}
+
+void ConvolutionFX::cloneFrom(ConvolutionFX& other) {
+	mix = other.mix;
+	setFilePath(other.filePath);
+}
+
+void ConvolutionFX::setFilePath(String& path) {
+	discardBuffer();
+	filePath.set(&path);
+	loadFailed = false;
+	if (isActive()) {
+		requestLoad();
+	}
+	else {
+		removeFromPendingLoads();
+	}
+}
+
+int32_t ConvolutionFX::getTailLength() {
+	return (irBuffer != nullptr) ? irBuffer->irLength + PartitionedConvolver::kBlockSize : 0;
+}
+
+void ConvolutionFX::process(std::span<StereoSample> buffer) {
+	if (!isActive()) {
+		return;
+	}
+	if (irBuffer == nullptr) {
+		if (!loadFailed) {
+			requestLoad();
+		}
+		return;
+	}
+	irBuffer->inUse = true;
+	irBuffer->convolver.process(buffer, ONE_Q31 - mix, mix);
+}
+
+void ConvolutionFX::startSkippingRendering() {
+	if (irBuffer != nullptr) {
+		irBuffer->convolver.reset();
+		irBuffer->inUse = false;
+	}
+}
+
+void ConvolutionFX::bufferStolen() {
+	irBuffer = nullptr;
+}
+
+void ConvolutionFX::discardBuffer() {
+	if (irBuffer != nullptr) {
+		irBuffer->~ConvolutionBuffer(); // Removes from stealable list
+		delugeDealloc(irBuffer);
+		irBuffer = nullptr;
+	}
+}
+
+void ConvolutionFX::requestLoad() {
+	if (loadRequested) {
+		return;
+	}
+	loadRequested = true;
+	nextPendingLoad = firstPendingLoad;
+	firstPendingLoad = this;
+}
+
+void ConvolutionFX::removeFromPendingLoads() {
+	for (ConvolutionFX** link = &firstPendingLoad; *link != nullptr; link = &(*link)->nextPendingLoad) {
+		if (*link == this) {
+			*link = nextPendingLoad;
+			break;
+		}
+	}
+	nextPendingLoad = nullptr;
+	loadRequested = false;
+}
+
+// Scheduler task. Reading the file calls the audio routine, which may render this effect meanwhile - it stays dry, and
+// loadRequested stops it asking again
+void ConvolutionFX::loadSomePending() {
+	ConvolutionFX* convolution = firstPendingLoad;
+	if (convolution == nullptr) {
+		return;
+	}
+	firstPendingLoad = convolution->nextPendingLoad;
+	convolution->nextPendingLoad = nullptr;
+
+	Error error = convolution->load();
+	convolution->loadRequested = false;
+	if (error != Error::NONE) {
+		D_PRINTLN("couldn't load IR");
+		convolution->loadFailed = true;
+	}
+}
+
+Error ConvolutionFX::load() {
+	if (irBuffer != nullptr || !isActive()) {
+		return Error::NONE;
+	}
+
+	auto maybeSample = audioFileManager.getAudioFileFromFilename(filePath, true, nullptr, AudioFileType::SAMPLE);
+	if (!maybeSample.has_value()) {
+		return maybeSample.error();
+	}
+	auto* sample = static_cast<Sample*>(maybeSample.value());
+	if (sample == nullptr || sample->unloadable) {
+		return Error::FILE_NOT_FOUND;
+	}
+
+	int32_t irLength = std::min<uint64_t>(sample->lengthInSamples, PartitionedConvolver::kMaxIRLength);
+	int32_t numIRChannels = std::min<int32_t>(sample->numChannels, 2);
+	if (irLength == 0) {
+		return Error::FILE_UNSUPPORTED;
+	}
+
+	void* memory = GeneralMemoryAllocator::get().allocStealable(
+	    sizeof(ConvolutionBuffer) + PartitionedConvolver::getMemorySize(irLength, numIRChannels));
+	if (memory == nullptr) {
+		return Error::INSUFFICIENT_RAM;
+	}
+	// Isn't in a stealable queue until it's all read in
+	auto* newBuffer = new (memory) ConvolutionBuffer(*this, irLength, numIRChannels);
+
+	sample->addReason();
+	Error error = readImpulseResponse(*sample, *newBuffer, numIRChannels);
+	sample->removeReason("E459");
+
+	if (error != Error::NONE) {
+		newBuffer->~ConvolutionBuffer();
+		delugeDealloc(newBuffer);
+		return error;
+	}
+	GeneralMemoryAllocator::get().putStealableInAppropriateQueue(newBuffer);
+	irBuffer = newBuffer;
+	return Error::NONE;
+}
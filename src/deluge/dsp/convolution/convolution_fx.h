@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "definitions_cxx.hpp"
+#include "dsp/convolution/partitioned_convolver.h"
+#include "dsp/stereo_sample.h"
+#include "memory/stealable.h"
+#include "util/d_string.h"
+#include <span>
+
+class ConvolutionBuffer;
+
+/// Convolves a song's or track's audio with an IR WAV file from the card, e.g. a speaker cabinet or a small room. The
+/// IR is used at the audio engine's sample rate whatever the file's, and only its first
+/// PartitionedConvolver::kMaxIRLength samples are used.
+///
+/// Everything it needs lives in one stealable ConvolutionBuffer. That can be stolen while the effect isn't being
+/// rendered, and then gets read from the card again once it's next needed - until which the audio goes through dry.
+class ConvolutionFX {
+public:
+	ConvolutionFX() = default;
+	ConvolutionFX(const ConvolutionFX& other) = delete;
+	~ConvolutionFX();
+
+	/// Takes the file and mix from the other one. Its IR gets read in again rather than shared
+	void cloneFrom(ConvolutionFX& other);
+
+	/// An empty path turns the effect off. The file itself gets read later, by loadSomePending()
+	void setFilePath(String& path);
+	String& getFilePath() { return filePath; }
+	bool isActive() { return !filePath.isEmpty(); }
+
+	/// In samples, how long the output goes on for after the input stops
+	int32_t getTailLength();
+
+	void process(std::span<StereoSample> buffer);
+	/// Forgets the tail, and lets the buffer be stolen until the next process()
+	void startSkippingRendering();
+	void bufferStolen();
+
+	/// Scheduler task. Reads the IR in for one effect waiting for it
+	static void loadSomePending();
+
+	/// q31, from all dry to all wet
+	q31_t mix{ONE_Q31};
+
+private:
+	void requestLoad();
+	void removeFromPendingLoads();
+	void discardBuffer();
+	Error load();
+
+	String filePath;
+	ConvolutionBuffer* irBuffer{nullptr};
+	/// Whether this is waiting in, or being read by, loadSomePending()
+	bool loadRequested{false};
+	/// So a missing or broken file doesn't get tried again on every render
+	bool loadFailed{false};
+	ConvolutionFX* nextPendingLoad{nullptr};
+
+	static ConvolutionFX* firstPendingLoad;
+};
+
+/// The convolver's state, with the memory for its IR spectra and history straight after
+class alignas(8) ConvolutionBuffer final : public Stealable {
+public:
+	ConvolutionBuffer(ConvolutionFX& owner, int32_t irLength, int32_t numIRChannels)
+	    : irLength(irLength), convolver(this + 1, irLength, numIRChannels), owner_(owner) {}
+
+	bool mayBeStolen(void* thingNotToStealFrom) override { return thingNotToStealFrom != this && !inUse; }
+	void steal(char const* errorCode) override { owner_.bufferStolen(); }
+	// Like the grain buffer - these are big, and slow to get back
+	StealableQueue getAppropriateQueue() override { return StealableQueue::CURRENT_SONG_SAMPLE_DATA_REPITCHED_CACHE; }
+
+	bool inUse{true};
+	int32_t irLength;
+	PartitionedConvolver convolver;
+
+private:
+	ConvolutionFX& owner_;
+};
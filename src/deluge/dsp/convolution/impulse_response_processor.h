@@ -21,17 +21,19 @@
 #include "util/fixedpoint.h"
 #include <cstdint>
 
+/// A short fixed IR, convolved in the direct form - for longer or user supplied ones see PartitionedConvolver
 class [[gnu::hot]] ImpulseResponseProcessor {
+public:
 	constexpr static size_t IR_SIZE = 26;
 	constexpr static size_t IR_BUFFER_SIZE = (IR_SIZE - 1);
 
+	// Taps are scaled so 2^32 is unity
 	constexpr static std::array<int32_t, IR_SIZE> ir = {
 	    -3203916,   8857848,   24813136,  41537808, 35217472,  15195632,  -27538592, -61984128, 1944654848,
 	    1813580928, 438462784, 101125088, 6042048,  -22429488, -46218864, -56638560, -64785312, -52108528,
 	    -37256992,  -11863856, 1390352,   14663296, 12784464,  14254800,  5690912,   4490736,
 	};
 
-public:
 	ImpulseResponseProcessor() = default;
 
 	inline void process(const StereoSample input, StereoSample& output) {
@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dsp/convolution/partitioned_convolver.h"
+#include "dsp/fft/fft_config_manager.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+// The unit tests run on the host, which only has NE10's plain C FFTs
+#if IN_UNIT_TESTS
+constexpr auto fftForward = &ne10_fft_r2c_1d_int32_c;
+constexpr auto fftInverse = &ne10_fft_c2r_1d_int32_c;
+#else
+constexpr auto fftForward = &ne10_fft_r2c_1d_int32_neon;
+constexpr auto fftInverse = &ne10_fft_c2r_1d_int32_neon;
+#endif
+
+// Both spectra come from scaled forward FFTs, so each is 1/kFFTSize of the true one. Their product, taken down by this
+// much, goes through an unscaled inverse FFT to give the convolution with the IR's taps as q31
+constexpr int32_t kUnityAccumulatorShift = 31 - PartitionedConvolver::kFFTSizeMagnitude;
+
+[[gnu::always_inline]] inline void multiplyAccumulate(int64_t* __restrict__ accumulator,
+                                                      ne10_fft_cpx_int32_t const* __restrict__ input,
+                                                      ne10_fft_cpx_int32_t const* __restrict__ ir) {
+	for (int32_t b = 0; b < PartitionedConvolver::kNumBins; b++) {
+		accumulator[b * 2] += (int64_t)input[b].r * ir[b].r - (int64_t)input[b].i * ir[b].i;
+		accumulator[b * 2 + 1] += (int64_t)input[b].r * ir[b].i + (int64_t)input[b].i * ir[b].r;
+	}
+}
+
+[[gnu::always_inline]] inline int32_t roundAndSaturate(int64_t value, int32_t shift) {
+	value = (value + ((int64_t)1 << (shift - 1))) >> shift;
+	return std::clamp<int64_t>(value, INT32_MIN, INT32_MAX);
+}
+
+} // namespace
+
+size_t PartitionedConvolver::getMemorySize(int32_t irLength, int32_t numIRChannels) {
+	int32_t numPartitions = getNumPartitions(irLength);
+	size_t numSpectra = (numIRChannels + 2) * numPartitions + 1;
+	return kNumBins * 2 * sizeof(int64_t) + numSpectra * kNumBins * sizeof(ne10_fft_cpx_int32_t)
+	       + (2 * kFFTSize + 2 * kBlockSize + kFFTSize) * sizeof(q31_t);
+}
+
+PartitionedConvolver::PartitionedConvolver(void* memory, int32_t irLength, int32_t numIRChannels)
+    : fftConfig_(FFTConfigManager::getConfig(kFFTSizeMagnitude)), numPartitions_(getNumPartitions(irLength)),
+      numIRChannels_(numIRChannels) {
+	// The 64 bit accumulator goes first, so it gets the alignment
+	accumulator_ = static_cast<int64_t*>(memory);
+	irSpectra_ = reinterpret_cast<ne10_fft_cpx_int32_t*>(accumulator_ + kNumBins * 2);
+	inputSpectra_ = irSpectra_ + numIRChannels * numPartitions_ * kNumBins;
+	spectrumScratch_ = inputSpectra_ + 2 * numPartitions_ * kNumBins;
+	input_ = reinterpret_cast<q31_t*>(spectrumScratch_ + kNumBins);
+	output_ = input_ + 2 * kFFTSize;
+	timeScratch_ = output_ + 2 * kBlockSize;
+
+	memset(irSpectra_, 0, numIRChannels * numPartitions_ * kNumBins * sizeof(ne10_fft_cpx_int32_t));
+	setGain(1);
+	reset();
+}
+
+void PartitionedConvolver::setPartition(int32_t irChannel, int32_t partition, q31_t const* taps, int32_t numTaps) {
+	// Zero padded to twice the length, so the circular convolution of each block doesn't wrap around
+	numTaps = std::min(numTaps, kBlockSize);
+	memcpy(timeScratch_, taps, numTaps * sizeof(q31_t));
+	memset(timeScratch_ + numTaps, 0, (kFFTSize - numTaps) * sizeof(q31_t));
+	fftForward(getIRSpectrum(irChannel, partition), timeScratch_, fftConfig_, 1);
+}
+
+void PartitionedConvolver::setGain(float gain) {
+	int32_t exponent;
+	float mantissa = std::frexp(std::clamp(gain, 1.f / 65536, 65536.f), &exponent);
+	accumulatorShift_ = kUnityAccumulatorShift - exponent;
+	gainMantissa_ = std::min<double>(mantissa * 2147483648.0, ONE_Q31);
+}
+
+void PartitionedConvolver::reset() {
+	memset(inputSpectra_, 0, 2 * numPartitions_ * kNumBins * sizeof(ne10_fft_cpx_int32_t));
+	memset(input_, 0, (2 * kFFTSize + 2 * kBlockSize) * sizeof(q31_t));
+	position_ = 0;
+	headPartition_ = 0;
+}
+
+void PartitionedConvolver::process(std::span<StereoSample> buffer, q31_t dryLevel, q31_t wetLevel) {
+	q31_t wetMultiplier = multiply_32x32_rshift32(gainMantissa_, wetLevel) << 1;
+
+	while (!buffer.empty()) {
+		int32_t numFrames = std::min<int32_t>(buffer.size(), kBlockSize - position_);
+		q31_t* inputL = input_ + kBlockSize + position_;
+		q31_t* inputR = inputL + kFFTSize;
+		q31_t const* delayedL = input_ + position_;
+		q31_t const* delayedR = delayedL + kFFTSize;
+		q31_t const* outputL = output_ + position_;
+		q31_t const* outputR = outputL + kBlockSize;
+
+		for (int32_t i = 0; i < numFrames; i++) {
+			StereoSample& sample = buffer[i];
+			inputL[i] = sample.l;
+			inputR[i] = sample.r;
+			sample.l = (multiply_32x32_rshift32(delayedL[i], dryLevel)
+			            + multiply_32x32_rshift32(outputL[i], wetMultiplier))
+			           << 1;
+			sample.r = (multiply_32x32_rshift32(delayedR[i], dryLevel)
+			            + multiply_32x32_rshift32(outputR[i], wetMultiplier))
+			           << 1;
+		}
+
+		buffer = buffer.subspan(numFrames);
+		position_ += numFrames;
+		if (position_ == kBlockSize) {
+			processBlock();
+			position_ = 0;
+		}
+	}
+}
+
+void PartitionedConvolver::processBlock() {
+	for (int32_t c = 0; c < 2; c++) {
+		// NE10 works in its input buffer, so it gets a copy
+		q31_t* input = input_ + c * kFFTSize;
+		memcpy(timeScratch_, input, kFFTSize * sizeof(q31_t));
+		fftForward(getInputSpectrum(c, headPartition_), timeScratch_, fftConfig_, 1);
+
+		// The newest block meets the start of the IR, the oldest one its end
+		ne10_fft_cpx_int32_t const* irSpectrum = getIRSpectrum(numIRChannels_ == 2 ? c : 0, 0);
+		std::fill_n(accumulator_, kNumBins * 2, 0);
+		for (int32_t p = 0; p < numPartitions_; p++) {
+			int32_t inputPartition = headPartition_ - p;
+			if (inputPartition < 0) {
+				inputPartition += numPartitions_;
+			}
+			multiplyAccumulate(accumulator_, getInputSpectrum(c, inputPartition), irSpectrum);
+			irSpectrum += kNumBins;
+		}
+
+		for (int32_t b = 0; b < kNumBins; b++) {
+			spectrumScratch_[b].r = roundAndSaturate(accumulator_[b * 2], accumulatorShift_);
+			spectrumScratch_[b].i = roundAndSaturate(accumulator_[b * 2 + 1], accumulatorShift_);
+		}
+		fftInverse(timeScratch_, spectrumScratch_, fftConfig_, 0);
+
+		// Only the second half is the true linear convolution - the first has wrapped around. Then the block that's
+		// just come in becomes the previous one
+		memcpy(output_ + c * kBlockSize, timeScratch_ + kBlockSize, kBlockSize * sizeof(q31_t));
+		memcpy(input, input + kBlockSize, kBlockSize * sizeof(q31_t));
+	}
+
+	if (++headPartition_ == numPartitions_) {
+		headPartition_ = 0;
+	}
+}
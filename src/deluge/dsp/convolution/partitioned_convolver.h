@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "NE10.h"
+#include "dsp/stereo_sample.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// Convolves stereo audio with an impulse response of any length up to kMaxIRLength, in the frequency domain.
+///
+/// The IR is cut into kBlockSize sample partitions, each kept as the spectrum of an FFT twice that size. Each time a
+/// block of input has come in, its spectrum goes into a delay line of the last numPartitions blocks' spectra, each of
+/// those is multiplied with the matching partition's and the sum goes back through one inverse FFT (uniformly
+/// partitioned overlap-save). So the work per sample is two FFTs of a fixed size plus one complex multiply per
+/// partition and bin, where ImpulseResponseProcessor's direct form does one multiply per tap. The price is kBlockSize
+/// samples of latency, which the dry signal is delayed by too so they stay lined up.
+///
+/// All the memory - several hundred kB for a long IR - is supplied by the owner, which makes it easy to put somewhere
+/// stealable. A mono IR is used for both channels, a stereo one maps left to left and right to right.
+class [[gnu::hot]] PartitionedConvolver {
+public:
+	static constexpr int32_t kBlockSizeMagnitude = 7;
+	static constexpr int32_t kBlockSize = 1 << kBlockSizeMagnitude;
+	static constexpr int32_t kFFTSizeMagnitude = kBlockSizeMagnitude + 1;
+	static constexpr int32_t kFFTSize = 1 << kFFTSizeMagnitude;
+	static constexpr int32_t kNumBins = (kFFTSize >> 1) + 1;
+	static constexpr int32_t kMaxIRLength = 8192;
+
+	static constexpr int32_t getNumPartitions(int32_t irLength) {
+		return (irLength + kBlockSize - 1) >> kBlockSizeMagnitude;
+	}
+	/// How many bytes of memory the constructor needs for an IR this long
+	static size_t getMemorySize(int32_t irLength, int32_t numIRChannels);
+
+	/// @param memory getMemorySize() bytes, 8 byte aligned, which must outlive this
+	PartitionedConvolver(void* memory, int32_t irLength, int32_t numIRChannels);
+
+	/// Sets up one partition of the IR from numTaps (up to kBlockSize) q31 taps, where ONE_Q31 passes the input
+	/// straight through. Missing taps at the end of the last partition are zero
+	void setPartition(int32_t irChannel, int32_t partition, q31_t const* taps, int32_t numTaps);
+
+	/// Multiplies the wet output by this, e.g. to bring an IR normalised to full scale peaks back down to a sensible
+	/// level. Ranges from 2^-16 to 2^16
+	void setGain(float gain);
+
+	/// Forgets all the input heard so far, so nothing rings on
+	void reset();
+
+	/// Replaces each frame with the mix of the input from kBlockSize frames ago and the convolved output. The levels
+	/// are q31, with ONE_Q31 unity
+	void process(std::span<StereoSample> buffer, q31_t dryLevel, q31_t wetLevel);
+
+private:
+	ne10_fft_cpx_int32_t* getIRSpectrum(int32_t irChannel, int32_t partition) {
+		return irSpectra_ + (irChannel * numPartitions_ + partition) * kNumBins;
+	}
+	ne10_fft_cpx_int32_t* getInputSpectrum(int32_t channel, int32_t partition) {
+		return inputSpectra_ + (channel * numPartitions_ + partition) * kNumBins;
+	}
+	void processBlock();
+
+	ne10_fft_r2c_cfg_int32_t fftConfig_;
+	int32_t numPartitions_;
+	int32_t numIRChannels_;
+
+	/// Per bin, real then imaginary, wide enough that summing every partition's product loses nothing
+	int64_t* accumulator_;
+	/// [irChannel][partition][bin]
+	ne10_fft_cpx_int32_t* irSpectra_;
+	/// [channel][partition][bin], a ring buffer of the most recent input blocks' spectra
+	ne10_fft_cpx_int32_t* inputSpectra_;
+	ne10_fft_cpx_int32_t* spectrumScratch_;
+	/// [channel][kFFTSize] - the previous block of input, then the one coming in
+	q31_t* input_;
+	/// [channel][kBlockSize] - the convolved previous block, being played out
+	q31_t* output_;
+	q31_t* timeScratch_;
+
+	int32_t position_{0};
+	int32_t headPartition_{0};
+	int32_t accumulatorShift_{0};
+	q31_t gainMantissa_{ONE_Q31};
+};
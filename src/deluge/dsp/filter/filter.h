@@ -17,15 +17,46 @@
 
 #pragma once
 
+#include "dsp/filter/stereo_q31.h"
 #include "model/mod_controllable/filters/filter_config.h"
 #include "util/fixedpoint.h"
 #include "util/functions.h"
+#include <algorithm>
 #include <cstdint>
 
 namespace deluge::dsp::filter {
 constexpr int32_t ONE_Q16 = 134217728;
 
 extern q31_t blendBuffer[SSI_TX_BUFFER_NUM_SAMPLES * 2];
+
+/**
+ * A coefficient which, rather than jumping to the value setConfig() works out each render window, moves there in even
+ * steps across the window. Without this, modulating the cutoff or resonance quickly steps once per window, which can
+ * be heard as zipper noise.
+ */
+class RampedCoefficient {
+public:
+	/// rate is 1 / the number of steps in the window, or 0 to jump straight to target
+	void startRamp(q31_t target, q31_t rate) {
+		if (rate == 0) {
+			value_ = target;
+			increment_ = 0;
+		}
+		else {
+			// Halved so the difference can't overflow
+			increment_ = multiply_32x32_rshift32((target >> 1) - (value_ >> 1), rate) << 2;
+		}
+	}
+	[[gnu::always_inline]] void step() { value_ += increment_; }
+	/// Lands exactly on target, whatever the rounding on the way there
+	void finishRamp(q31_t target) { value_ = target; }
+	[[gnu::always_inline]] q31_t get() const { return value_; }
+
+private:
+	q31_t value_ = 0;
+	q31_t increment_ = 0;
+};
+
 /**
  *  Interface for filters in the sound engine
  * This is a CRTP base class for all filters used in the sound engine. To implement a new filter,
@@ -33,7 +64,8 @@ extern q31_t blendBuffer[SSI_TX_BUFFER_NUM_SAMPLES * 2];
  * Create a subclass of Filter, using itself as the template parameter (the CRTP). Then implement the following methods:
  * a. setConfig. This is run when the filter is reconfigured, and should be used to convert the user-level parameters
  * (frequency, resonance) to internal parameters b. doFilter runs the filter on a series of samples, densely packed c.
- * doFilterStereo runs the filter on stereo samples packed in the LRLRLR... format. d. reset resets any internal state
+ * doFilterStereo runs the filter on stereo samples packed in the LRLRLR... format, ideally on both channels at once
+ * using StereoQ31. d. reset resets any internal state
  * of the filter to avoid clicks when processing a new voice Then add a menu entry for the filter, and add item to
  * string conversion in ModControllableAudio::switchLPFMode Filters are extremely sensitive to performance, as they're
  * run per channel, per voice. One additional multiply instruction can have a noticeable impact on maximum voice count,
@@ -109,6 +141,7 @@ public:
 	 */
 	void reset(bool fade = false) {
 		static_cast<T*>(this)->resetFilter();
+		rampFromCurrent = false;
 		if (fade) {
 			dryFade = 1;
 			wetLevel = 0;
@@ -134,7 +167,22 @@ public:
 		divideBy1PlusTannedFrequency = (q31_t)(288230376151711744.0 / (double)(ONE_Q16 + (tannedFrequency >> 1)));
 		fc = multiply_32x32_rshift32_rounded(tannedFrequency, divideBy1PlusTannedFrequency) << 4;
 	}
+	/**
+	 * Gives the rate to pass to RampedCoefficient::startRamp() for a window of numSteps samples. The first window after
+	 * a reset jumps straight to its coefficients, as there's nothing sensible to ramp from
+	 */
+	q31_t startRampWindow(int32_t numSteps) {
+		if (!rampFromCurrent) {
+			rampFromCurrent = true;
+			return 0;
+		}
+		return ONE_Q31 / std::max<int32_t>(numSteps, 1);
+	}
+
 	q31_t fc;
+	// Whether the ramped coefficients hold the end of the last window, rather than whatever was there before a reset.
+	// Starts false as the filter set zeroes its filters
+	bool rampFromCurrent = false;
 	float dryFade = 1;
 	q31_t wetLevel = ONE_Q31;
 	q31_t tannedFrequency;
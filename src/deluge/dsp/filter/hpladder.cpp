@@ -67,41 +67,104 @@ q31_t HpLadderFilter::setConfig(q31_t hpfFrequency, q31_t hpfResonance, FilterMo
 	return filterGain;
 }
 [[gnu::hot]] void HpLadderFilter::doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrement) {
+	startRamps((endSample - startSample + sampleIncrement - 1) / sampleIncrement);
 	q31_t* currentSample = startSample;
 	do {
+		stepRamps();
 		*currentSample = doHPF(*currentSample, l);
 		currentSample += sampleIncrement;
 	} while (currentSample < endSample);
+	finishRamps();
 }
 // filter an interleaved stereo buffer
 [[gnu::hot]] void HpLadderFilter::doFilterStereo(q31_t* startSample, q31_t* endSample) {
+	startRamps((endSample - startSample) >> 1);
+	HPLadderState<StereoQ31> state{toLanes(l.hpfHPF1, r.hpfHPF1),
+	                               toLanes(l.hpfLPF1, r.hpfLPF1),
+	                               toLanes(l.hpfHPF3, r.hpfHPF3),
+	                               {l.hpfLastWorkingValue[0], r.hpfLastWorkingValue[0]}};
 	q31_t* currentSample = startSample;
 	do {
+		stepRamps();
+		doHPF(StereoQ31::load(currentSample), state).store(currentSample);
+		currentSample += 2;
+	} while (currentSample < endSample);
+	fromLanes(state.hpfHPF1, l.hpfHPF1, r.hpfHPF1);
+	fromLanes(state.hpfLPF1, l.hpfLPF1, r.hpfLPF1);
+	fromLanes(state.hpfHPF3, l.hpfHPF3, r.hpfHPF3);
+	l.hpfLastWorkingValue[0] = state.hpfLastWorkingValue[0];
+	r.hpfLastWorkingValue[0] = state.hpfLastWorkingValue[1];
+	finishRamps();
+}
+void HpLadderFilter::doFilterStereoScalar(q31_t* startSample, q31_t* endSample) {
+	startRamps((endSample - startSample) >> 1);
+	q31_t* currentSample = startSample;
+	do {
+		stepRamps();
 		*currentSample = doHPF(*currentSample, l);
 		currentSample += 1;
 		*currentSample = doHPF(*currentSample, r);
 		currentSample += 1;
 	} while (currentSample < endSample);
+	finishRamps();
+}
+
+void HpLadderFilter::startRamps(int32_t numSteps) {
+	q31_t rate = startRampWindow(numSteps);
+	fcRamp.startRamp(fc, rate);
+	hpfLPF1FeedbackRamp.startRamp(hpfLPF1Feedback, rate);
+	hpfHPF3FeedbackRamp.startRamp(hpfHPF3Feedback, rate);
+	hpfDivideByProcessedResonanceRamp.startRamp(hpfDivideByProcessedResonance, rate);
+	divideByTotalMoveabilityRamp.startRamp(divideByTotalMoveability, rate);
 }
-[[gnu::always_inline]] inline q31_t HpLadderFilter::doHPF(q31_t input, HPLadderState& state) {
+void HpLadderFilter::stepRamps() {
+	fcRamp.step();
+	hpfLPF1FeedbackRamp.step();
+	hpfHPF3FeedbackRamp.step();
+	hpfDivideByProcessedResonanceRamp.step();
+	divideByTotalMoveabilityRamp.step();
+}
+void HpLadderFilter::finishRamps() {
+	fcRamp.finishRamp(fc);
+	hpfLPF1FeedbackRamp.finishRamp(hpfLPF1Feedback);
+	hpfHPF3FeedbackRamp.finishRamp(hpfHPF3Feedback);
+	hpfDivideByProcessedResonanceRamp.finishRamp(hpfDivideByProcessedResonance);
+	divideByTotalMoveabilityRamp.finishRamp(divideByTotalMoveability);
+}
+
+namespace {
+// Keeps the antialiased saturation's history up to date while it isn't in use, so it doesn't click when it comes in
+[[gnu::always_inline]] inline void setLastWorkingValues(q31_t a, uint32_t* lastWorkingValues) {
+	lastWorkingValues[0] = (uint32_t)lshiftAndSaturate<2>(a) + 2147483648u;
+}
+[[gnu::always_inline]] inline void setLastWorkingValues(StereoQ31 a, uint32_t* lastWorkingValues) {
+	setLastWorkingValues(a.l(), &lastWorkingValues[0]);
+	setLastWorkingValues(a.r(), &lastWorkingValues[1]);
+}
+} // namespace
+
+template <typename S>
+[[gnu::always_inline]] inline S HpLadderFilter::doHPF(S input, HPLadderState<S>& state) {
 	// inputs are only 16 bit so this is pretty small
 	// this limit was found experimentally as about the lowest fc can get without sounding broken
 	q31_t constexpr lower_limit = -(ONE_Q31 >> 8);
-	q31_t temp_fc = std::max(multiply_accumulate_32x32_rshift32_rounded(fc, input << 4, morph_), lower_limit);
+	using std::max;
+	S temp_fc = max(multiply_accumulate_32x32_rshift32_rounded(fcRamp.get(), input << 4, morph_), lower_limit);
 
-	q31_t firstHPFOutput = input - state.hpfHPF1.doFilter(input, temp_fc);
+	S firstHPFOutput = input - state.hpfHPF1.doFilter(input, temp_fc);
 
-	q31_t feedbacksValue =
-	    state.hpfHPF3.getFeedbackOutput(hpfHPF3Feedback) + state.hpfLPF1.getFeedbackOutput(hpfLPF1Feedback);
+	S feedbacksValue = state.hpfHPF3.getFeedbackOutput(hpfHPF3FeedbackRamp.get())
+	                   + state.hpfLPF1.getFeedbackOutput(hpfLPF1FeedbackRamp.get());
 
-	q31_t a = multiply_32x32_rshift32_rounded(divideByTotalMoveability, firstHPFOutput + feedbacksValue) << (4 + 1);
+	S a = multiply_32x32_rshift32_rounded(divideByTotalMoveabilityRamp.get(), firstHPFOutput + feedbacksValue)
+	      << (4 + 1);
 
 	// Only saturate / anti-alias if lots of resonance
 	if (hpfProcessedResonance > 900000000) { // 890551738
-		a = getTanHAntialiased(a, &state.hpfLastWorkingValue, 1);
+		a = getTanHAntialiased(a, state.hpfLastWorkingValue, 1);
 	}
 	else {
-		state.hpfLastWorkingValue = (uint32_t)lshiftAndSaturate<2>(a) + 2147483648u;
+		setLastWorkingValues(a, state.hpfLastWorkingValue);
 		if (hpfProcessedResonance > 750000000) { // 400551738
 			a = getTanHUnknown(a, 2);
 		}
@@ -110,7 +173,7 @@ q31_t HpLadderFilter::setConfig(q31_t hpfFrequency, q31_t hpfResonance, FilterMo
 	state.hpfLPF1.doFilter(a - state.hpfHPF3.doFilter(a, temp_fc), temp_fc);
 
 	// Normalization
-	a = multiply_32x32_rshift32_rounded(a, hpfDivideByProcessedResonance) << (8 - 1);
+	a = multiply_32x32_rshift32_rounded(a, hpfDivideByProcessedResonanceRamp.get()) << (8 - 1);
 
 	return a;
 }
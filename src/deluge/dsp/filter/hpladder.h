@@ -20,6 +20,7 @@
 #include "dsp/filter/filter.h"
 #include "dsp/filter/ladder_components.h"
 #include "util/fixedpoint.h"
+#include <type_traits>
 
 namespace deluge::dsp::filter {
 
@@ -30,24 +31,32 @@ public:
 	q31_t setConfig(q31_t hpfFrequency, q31_t hpfResonance, FilterMode lpfMode, q31_t lpfMorph, q31_t filterGain);
 	void doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrememt);
 	void doFilterStereo(q31_t* startSample, q31_t* endSample);
+	/// doFilterStereo() a channel at a time, kept as the reference for the two lane version to be checked against
+	void doFilterStereoScalar(q31_t* startSample, q31_t* endSample);
 	void resetFilter() {
 		l.reset();
 		r.reset();
 	}
 
 private:
+	template <typename S>
 	struct HPLadderState {
-		BasicFilterComponent hpfHPF1;
-		BasicFilterComponent hpfLPF1;
-		BasicFilterComponent hpfHPF3;
-		uint32_t hpfLastWorkingValue;
+		FilterComponent<S> hpfHPF1;
+		FilterComponent<S> hpfLPF1;
+		FilterComponent<S> hpfHPF3;
+		// One per channel
+		uint32_t hpfLastWorkingValue[std::is_same_v<S, StereoQ31> ? 2 : 1];
 		void reset() {
 			hpfHPF1.reset();
 			hpfLPF1.reset();
 			hpfHPF3.reset();
 		}
 	};
-	[[gnu::always_inline]] inline q31_t doHPF(q31_t input, HPLadderState& state);
+	template <typename S>
+	[[gnu::always_inline]] inline S doHPF(S input, HPLadderState<S>& state);
+	void startRamps(int32_t numSteps);
+	[[gnu::always_inline]] inline void stepRamps();
+	void finishRamps();
 
 	bool hpfDoingAntialiasingNow;
 	int32_t hpfDivideByTotalMoveabilityLastTime;
@@ -66,7 +75,14 @@ private:
 	q31_t alteredHpfMomentumMultiplier;
 	q31_t thisHpfResonance;
 	q31_t morph_;
-	HPLadderState l;
-	HPLadderState r;
+	HPLadderState<q31_t> l;
+	HPLadderState<q31_t> r;
+
+	// The coefficients as the filter actually uses them, moving to the ones above over each window
+	RampedCoefficient fcRamp;
+	RampedCoefficient hpfLPF1FeedbackRamp;
+	RampedCoefficient hpfHPF3FeedbackRamp;
+	RampedCoefficient hpfDivideByProcessedResonanceRamp;
+	RampedCoefficient divideByTotalMoveabilityRamp;
 };
 } // namespace deluge::dsp::filter
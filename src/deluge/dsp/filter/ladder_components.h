@@ -17,36 +17,53 @@
 
 #pragma once
 
+#include "dsp/filter/stereo_q31.h"
 #include "util/fixedpoint.h"
 #include <cstdint>
 namespace deluge::dsp::filter {
-class BasicFilterComponent {
+/// One pole of a ladder. S is q31_t for one channel, or StereoQ31 to run both channels of a stereo filter at once
+template <typename S>
+class FilterComponent {
 public:
-	BasicFilterComponent() { reset(); }
+	FilterComponent() = default;
+	explicit FilterComponent(S memory) : memory(memory) {}
 	// moveability is tan(f)/(1+tan(f))
-	[[gnu::always_inline]] inline q31_t doFilter(q31_t input, q31_t moveability) {
-		q31_t a = multiply_32x32_rshift32_rounded(input - memory, moveability) << 1;
-		q31_t b = a + memory;
+	template <typename M>
+	[[gnu::always_inline]] inline S doFilter(S input, M moveability) {
+		S a = multiply_32x32_rshift32_rounded(input - memory, moveability) << 1;
+		S b = a + memory;
 		memory = b + a;
 		return b;
 	}
-	[[gnu::always_inline]] inline int32_t doAPF(q31_t input, int32_t moveability) {
-		q31_t a = multiply_32x32_rshift32_rounded(input - memory, moveability) << 1;
-		q31_t b = a + memory;
+	template <typename M>
+	[[gnu::always_inline]] inline S doAPF(S input, M moveability) {
+		S a = multiply_32x32_rshift32_rounded(input - memory, moveability) << 1;
+		S b = a + memory;
 		memory = a + b;
 		return b * 2 - input;
 	}
-	[[gnu::always_inline]] inline void affectFilter(q31_t input, int32_t moveability) {
-		memory += multiply_32x32_rshift32_rounded(input - memory, moveability) << 2;
+	template <typename M>
+	[[gnu::always_inline]] inline void affectFilter(S input, M moveability) {
+		memory = memory + (multiply_32x32_rshift32_rounded(input - memory, moveability) << 2);
 	}
-	[[gnu::always_inline]] inline void reset() { memory = 0; }
-	[[gnu::always_inline]] inline q31_t getFeedbackOutput(int32_t feedbackAmount) {
+	[[gnu::always_inline]] inline void reset() { memory = S{}; }
+	[[gnu::always_inline]] inline S getFeedbackOutput(int32_t feedbackAmount) {
 		return multiply_32x32_rshift32_rounded(memory, feedbackAmount) << 2;
 	}
-	[[gnu::always_inline]] inline q31_t getFeedbackOutputWithoutLshift(int32_t feedbackAmount) {
+	[[gnu::always_inline]] inline S getFeedbackOutputWithoutLshift(int32_t feedbackAmount) {
 		return multiply_32x32_rshift32_rounded(memory, feedbackAmount);
 	}
 
-	q31_t memory = 0;
+	S memory{};
 };
+using BasicFilterComponent = FilterComponent<q31_t>;
+
+/// A pair of single channel components as the lanes of one
+inline FilterComponent<StereoQ31> toLanes(BasicFilterComponent const& l, BasicFilterComponent const& r) {
+	return FilterComponent<StereoQ31>{StereoQ31{l.memory, r.memory}};
+}
+inline void fromLanes(FilterComponent<StereoQ31> const& lanes, BasicFilterComponent& l, BasicFilterComponent& r) {
+	l.memory = lanes.memory.l();
+	r.memory = lanes.memory.r();
+}
 } // namespace deluge::dsp::filter
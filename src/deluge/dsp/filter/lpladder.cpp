@@ -171,106 +171,99 @@ q31_t LpLadderFilter::setConfig(q31_t lpfFrequency, q31_t lpfResonance, FilterMo
 	return filterGain;
 }
 
-[[gnu::hot]] void LpLadderFilter::doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrement) {
-
-	// Half ladder
-	if (lpfMode == FilterMode::TRANSISTOR_12DB) {
+namespace {
+// Each channel gets its own noise, taken in the same order as filtering a channel at a time would
+template <typename S>
+[[gnu::always_inline]] inline S getChannelNoise();
+template <>
+[[gnu::always_inline]] inline q31_t getChannelNoise<q31_t>() {
+	return getNoise() >> 2;
+}
+template <>
+[[gnu::always_inline]] inline StereoQ31 getChannelNoise<StereoQ31>() {
+	q31_t l = getNoise() >> 2;
+	return StereoQ31{l, getNoise() >> 2};
+}
+// For oversampling, where a channel at a time takes both of the left channel's before either of the right's
+template <typename S>
+[[gnu::always_inline]] inline void getChannelNoisePair(S& first, S& second) {
+	first = getChannelNoise<q31_t>();
+	second = getChannelNoise<q31_t>();
+}
+template <>
+[[gnu::always_inline]] inline void getChannelNoisePair<StereoQ31>(StereoQ31& first, StereoQ31& second) {
+	q31_t l1 = getNoise() >> 2;
+	q31_t l2 = getNoise() >> 2;
+	q31_t r1 = getNoise() >> 2;
+	first = StereoQ31{l1, r1};
+	second = StereoQ31{l2, getNoise() >> 2};
+}
+} // namespace
 
+[[gnu::hot]] void LpLadderFilter::doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrement) {
+	renderMode([&](auto processSample) {
+		startRamps((endSample - startSample + sampleIncrement - 1) / sampleIncrement);
 		q31_t* currentSample = startSample;
 		do {
-			*currentSample = do12dBLPFOnSample(*currentSample, l);
+			stepRamps();
+			*currentSample = processSample(*currentSample, l);
 			currentSample += sampleIncrement;
 		} while (currentSample < endSample);
-	}
-
-	// Full ladder (regular)
-	else if (lpfMode == FilterMode::TRANSISTOR_24DB) {
-
+		finishRamps();
+	});
+}
+[[gnu::hot]] void LpLadderFilter::doFilterStereo(q31_t* startSample, q31_t* endSample) {
+	renderMode([&](auto processSample) {
+		startRamps((endSample - startSample) >> 1);
+		LpLadderState<StereoQ31> state{StereoQ31{l.noiseLastValue, r.noiseLastValue}, toLanes(l.lpfLPF1, r.lpfLPF1),
+		                               toLanes(l.lpfLPF2, r.lpfLPF2), toLanes(l.lpfLPF3, r.lpfLPF3),
+		                               toLanes(l.lpfLPF4, r.lpfLPF4)};
 		q31_t* currentSample = startSample;
 		do {
-			*currentSample = do24dBLPFOnSample(*currentSample, l);
-
-			currentSample += sampleIncrement;
+			stepRamps();
+			processSample(StereoQ31::load(currentSample), state).store(currentSample);
+			currentSample += 2;
 		} while (currentSample < endSample);
-	}
-
-	// Full ladder (drive)
-	else if (lpfMode == FilterMode::TRANSISTOR_24DB_DRIVE) {
-		constexpr int32_t extraSaturationDrive = 1;
-		if (doOversampling) {
-			q31_t* currentSample = startSample;
-			do {
-				// Linear interpolation works surprisingly well here - it doesn't lead to audible aliasing. But its big
-				// problem is that it kills the highest frequencies, which is especially noticeable when resonance is
-				// low. This is because it'll turn all your high sine waves into triangles whose fundamental is lower in
-				// amplitude. Now, if we immediately downsampled that again with no filtering, no problem, because those
-				// new really high harmonics that make it triangular are still there. But after running it through the
-				// ladder filter, those get doubly filtered out, leaving just the reduced-amplitude (fundamental) sine
-				// waves where our old ones were. So instead, we need to do just a little bit more and take one extra,
-				// previous sample into account in our interpolation. This is enough to make the HF loss inaudible
-				// - although we can still see it on the spectrum analysis.
-
-				// Insanely just doubling up our input values to oversample works better than fancy 3-sample
-				// interpolation. And even, making our "interpolated" sample just a 0 and doubling the amplitude of the
-				// actual sample works very nearly as well as this, but gives a little bit more aliasing on high notes
-				// fed in.
-
-				doDriveLPFOnSample(*currentSample, l);
-
-				// Crude downsampling - just take every second sample, with no anti-aliasing filter. Works fine cos the
-				// ladder LPF filter takes care of lots of those high harmonics!
-				q31_t outputSampleToKeep = doDriveLPFOnSample(*currentSample, l);
-
-				// Only perform the final saturation stage on this one sample, which we want to keep
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += sampleIncrement;
-			} while (currentSample < endSample);
-		}
-
-		else {
-			q31_t* currentSample = startSample;
-			do {
-				q31_t outputSampleToKeep = doDriveLPFOnSample(*currentSample, l);
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += sampleIncrement;
-			} while (currentSample < endSample);
-		}
-	}
+		l.noiseLastValue = state.noiseLastValue.l();
+		r.noiseLastValue = state.noiseLastValue.r();
+		fromLanes(state.lpfLPF1, l.lpfLPF1, r.lpfLPF1);
+		fromLanes(state.lpfLPF2, l.lpfLPF2, r.lpfLPF2);
+		fromLanes(state.lpfLPF3, l.lpfLPF3, r.lpfLPF3);
+		fromLanes(state.lpfLPF4, l.lpfLPF4, r.lpfLPF4);
+		finishRamps();
+	});
 }
-[[gnu::hot]] void LpLadderFilter::doFilterStereo(q31_t* startSample, q31_t* endSample) {
-
-	// Half ladder
-	if (lpfMode == FilterMode::TRANSISTOR_12DB) {
-
+void LpLadderFilter::doFilterStereoScalar(q31_t* startSample, q31_t* endSample) {
+	renderMode([&](auto processSample) {
+		startRamps((endSample - startSample) >> 1);
 		q31_t* currentSample = startSample;
 		do {
-			*currentSample = do12dBLPFOnSample(*currentSample, l);
+			stepRamps();
+			*currentSample = processSample(*currentSample, l);
 			currentSample += 1;
-			*currentSample = do12dBLPFOnSample(*currentSample, r);
+			*currentSample = processSample(*currentSample, r);
 			currentSample += 1;
 		} while (currentSample < endSample);
+		finishRamps();
+	});
+}
+
+template <typename Render>
+[[gnu::always_inline]] inline void LpLadderFilter::renderMode(Render render) {
+	// Half ladder
+	if (lpfMode == FilterMode::TRANSISTOR_12DB) {
+		render([this](auto input, auto& state) { return do12dBLPFOnSample(input, state); });
 	}
 
 	// Full ladder (regular)
 	else if (lpfMode == FilterMode::TRANSISTOR_24DB) {
-		q31_t* currentSample = startSample;
-		do {
-			*currentSample = do24dBLPFOnSample(*currentSample, l);
-
-			currentSample += 1;
-			*currentSample = do24dBLPFOnSample(*currentSample, r);
-
-			currentSample += 1;
-		} while (currentSample < endSample);
+		render([this](auto input, auto& state) { return do24dBLPFOnSample(input, state); });
 	}
 
 	// Full ladder (drive)
 	else if (lpfMode == FilterMode::TRANSISTOR_24DB_DRIVE) {
 		if (doOversampling) {
-			q31_t* currentSample = startSample;
-			do {
+			render([this](auto input, auto& state) {
 				// Linear interpolation works surprisingly well here - it doesn't lead to audible aliasing. But its big
 				// problem is that it kills the highest frequencies, which is especially noticeable when resonance is
 				// low. This is because it'll turn all your high sine waves into triangles whose fundamental is lower in
@@ -286,54 +279,72 @@ q31_t LpLadderFilter::setConfig(q31_t lpfFrequency, q31_t lpfResonance, FilterMo
 				// actual sample works very nearly as well as this, but gives a little bit more aliasing on high notes
 				// fed in.
 
-				doDriveLPFOnSample(*currentSample, l);
-
-				// Crude downsampling - just take every second sample, with no anti-aliasing filter. Works fine cos the
-				// ladder LPF filter takes care of lots of those high harmonics!
-				q31_t outputSampleToKeep = doDriveLPFOnSample(*currentSample, l);
-
-				// Only perform the final saturation stage on this one sample, which we want to keep
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += 1;
-				doDriveLPFOnSample(*currentSample, r);
+				decltype(input) noise;
+				decltype(input) noise2;
+				getChannelNoisePair(noise, noise2);
+				doDriveLPFOnSample(input, noise, state);
 
 				// Crude downsampling - just take every second sample, with no anti-aliasing filter. Works fine cos the
 				// ladder LPF filter takes care of lots of those high harmonics!
-				outputSampleToKeep = doDriveLPFOnSample(*currentSample, r);
+				auto outputSampleToKeep = doDriveLPFOnSample(input, noise2, state);
 
 				// Only perform the final saturation stage on this one sample, which we want to keep
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += 1;
-			} while (currentSample < endSample);
+				return getTanHUnknown(outputSampleToKeep, 4);
+			});
 		}
 
 		else {
-			q31_t* currentSample = startSample;
-			do {
-				q31_t outputSampleToKeep = doDriveLPFOnSample(*currentSample, l);
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += 1;
-				outputSampleToKeep = doDriveLPFOnSample(*currentSample, r);
-				*currentSample = getTanHUnknown(outputSampleToKeep, 4);
-
-				currentSample += 1;
-			} while (currentSample < endSample);
+			render([this](auto input, auto& state) {
+				auto noise = getChannelNoise<decltype(input)>();
+				return getTanHUnknown(doDriveLPFOnSample(input, noise, state), 4);
+			});
 		}
 	}
 }
-[[gnu::always_inline]] inline q31_t LpLadderFilter::do12dBLPFOnSample(q31_t input, LpLadderState& state) {
+
+void LpLadderFilter::startRamps(int32_t numSteps) {
+	q31_t rate = startRampWindow(numSteps);
+	moveabilityRamp.startRamp(moveability, rate);
+	processedResonanceRamp.startRamp(processedResonance, rate);
+	divideByTotalMoveabilityAndProcessedResonanceRamp.startRamp(divideByTotalMoveabilityAndProcessedResonance, rate);
+	lpf1FeedbackRamp.startRamp(lpf1Feedback, rate);
+	lpf2FeedbackRamp.startRamp(lpf2Feedback, rate);
+	lpf3FeedbackRamp.startRamp(lpf3Feedback, rate);
+	divideBy1PlusTannedFrequencyRamp.startRamp(divideBy1PlusTannedFrequency, rate);
+}
+void LpLadderFilter::stepRamps() {
+	moveabilityRamp.step();
+	processedResonanceRamp.step();
+	divideByTotalMoveabilityAndProcessedResonanceRamp.step();
+	lpf1FeedbackRamp.step();
+	lpf2FeedbackRamp.step();
+	lpf3FeedbackRamp.step();
+	divideBy1PlusTannedFrequencyRamp.step();
+}
+void LpLadderFilter::finishRamps() {
+	moveabilityRamp.finishRamp(moveability);
+	processedResonanceRamp.finishRamp(processedResonance);
+	divideByTotalMoveabilityAndProcessedResonanceRamp.finishRamp(divideByTotalMoveabilityAndProcessedResonance);
+	lpf1FeedbackRamp.finishRamp(lpf1Feedback);
+	lpf2FeedbackRamp.finishRamp(lpf2Feedback);
+	lpf3FeedbackRamp.finishRamp(lpf3Feedback);
+	divideBy1PlusTannedFrequencyRamp.finishRamp(divideBy1PlusTannedFrequency);
+}
+
+template <typename S>
+[[gnu::always_inline]] inline S LpLadderFilter::do12dBLPFOnSample(S input, LpLadderState<S>& state) {
+	q31_t moveability = moveabilityRamp.get();
+	q31_t divideBy1PlusTannedFrequency = divideBy1PlusTannedFrequencyRamp.get();
 	// For drive filter, apply some heavily lowpassed noise to the filter frequency, to add analog-ness
-	q31_t noise = getNoise() >> 2; // StorageManager::devVarA;// 2;
-	q31_t distanceToGo = noise - state.noiseLastValue;
-	state.noiseLastValue += distanceToGo >> 7; // StorageManager::devVarB;
-	q31_t noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
+	S noise = getChannelNoise<S>(); // StorageManager::devVarA;// 2;
+	S distanceToGo = noise - state.noiseLastValue;
+	state.noiseLastValue = state.noiseLastValue + (distanceToGo >> 7); // StorageManager::devVarB;
+	S noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
 
-	q31_t feedbacksSum = state.lpfLPF1.getFeedbackOutput(lpf1Feedback) + state.lpfLPF2.getFeedbackOutput(lpf2Feedback)
-	                     + state.lpfLPF3.getFeedbackOutput(divideBy1PlusTannedFrequency);
-	q31_t x = scaleInput(input, feedbacksSum);
+	S feedbacksSum = state.lpfLPF1.getFeedbackOutput(lpf1FeedbackRamp.get())
+	                 + state.lpfLPF2.getFeedbackOutput(lpf2FeedbackRamp.get())
+	                 + state.lpfLPF3.getFeedbackOutput(divideBy1PlusTannedFrequency);
+	S x = scaleInput(input, feedbacksSum);
 
 	// Only saturate if resonance is high enough. Surprisingly, saturation makes no audible difference until very near
 	// the point of feedback if (processedResonance > 510000000) { // Re-check this? 	x = getTanHUnknown(x, 1); //
@@ -342,25 +353,28 @@ q31_t LpLadderFilter::setConfig(q31_t lpfFrequency, q31_t lpfResonance, FilterMo
 
 	return state.lpfLPF3.doAPF(state.lpfLPF2.doFilter(state.lpfLPF1.doFilter(x, noisy_m), noisy_m), noisy_m) << 1;
 }
-[[gnu::always_inline]] inline q31_t LpLadderFilter::do24dBLPFOnSample(q31_t input, LpLadderState& state) {
+template <typename S>
+[[gnu::always_inline]] inline S LpLadderFilter::do24dBLPFOnSample(S input, LpLadderState<S>& state) {
+	q31_t moveability = moveabilityRamp.get();
+	q31_t divideBy1PlusTannedFrequency = divideBy1PlusTannedFrequencyRamp.get();
 
 	// For drive filter, apply some heavily lowpassed noise to the filter frequency, to add analog-ness
-	q31_t noise = getNoise() >> 2; // StorageManager::devVarA;// 2;
-	q31_t distanceToGo = noise - state.noiseLastValue;
-	state.noiseLastValue += distanceToGo >> 7; // StorageManager::devVarB;
-	q31_t noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
+	S noise = getChannelNoise<S>(); // StorageManager::devVarA;// 2;
+	S distanceToGo = noise - state.noiseLastValue;
+	state.noiseLastValue = state.noiseLastValue + (distanceToGo >> 7); // StorageManager::devVarB;
+	S noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
 
-	q31_t feedbacksSum = (state.lpfLPF1.getFeedbackOutputWithoutLshift(lpf1Feedback)
-	                      + state.lpfLPF2.getFeedbackOutputWithoutLshift(lpf2Feedback)
-	                      + state.lpfLPF3.getFeedbackOutputWithoutLshift(lpf3Feedback)
-	                      + state.lpfLPF4.getFeedbackOutputWithoutLshift(divideBy1PlusTannedFrequency))
-	                     << 2;
+	S feedbacksSum = (state.lpfLPF1.getFeedbackOutputWithoutLshift(lpf1FeedbackRamp.get())
+	                  + state.lpfLPF2.getFeedbackOutputWithoutLshift(lpf2FeedbackRamp.get())
+	                  + state.lpfLPF3.getFeedbackOutputWithoutLshift(lpf3FeedbackRamp.get())
+	                  + state.lpfLPF4.getFeedbackOutputWithoutLshift(divideBy1PlusTannedFrequency))
+	                 << 2;
 
 	// Note: in the line above, we "should" halve filterSetConfig->divideBy1plusg to get it into the 1=1073741824 range.
 	// But it doesn't sound as good. Primarily it stops us getting to full resonance. But even if we allow further
 	// resonance increase, the sound just doesn't quite compare. Lucky I discovered this by mistake
 
-	q31_t x = scaleInput(input, feedbacksSum);
+	S x = scaleInput(input, feedbacksSum);
 
 	// Only saturate if resonance is high enough. Surprisingly, saturation makes no audible difference until very near
 	// the point of feedback
@@ -375,19 +389,21 @@ q31_t LpLadderFilter::setConfig(q31_t lpfFrequency, q31_t lpfResonance, FilterMo
 	       << 1;
 }
 
-[[gnu::always_inline]] inline q31_t LpLadderFilter::doDriveLPFOnSample(q31_t input, LpLadderState& state) {
+template <typename S>
+[[gnu::always_inline]] inline S LpLadderFilter::doDriveLPFOnSample(S input, S noise, LpLadderState<S>& state) {
+	q31_t moveability = moveabilityRamp.get();
+	q31_t divideBy1PlusTannedFrequency = divideBy1PlusTannedFrequencyRamp.get();
 
 	// For drive filter, apply some heavily lowpassed noise to the filter frequency, to add analog-ness
-	q31_t noise = getNoise() >> 2; // StorageManager::devVarA;// 2;
-	q31_t distanceToGo = noise - state.noiseLastValue;
-	state.noiseLastValue += distanceToGo >> 7; // StorageManager::devVarB;
-	q31_t noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
+	S distanceToGo = noise - state.noiseLastValue;
+	state.noiseLastValue = state.noiseLastValue + (distanceToGo >> 7); // StorageManager::devVarB;
+	S noisy_m = moveability + multiply_32x32_rshift32(moveability, state.noiseLastValue);
 
-	q31_t feedbacksSum = (state.lpfLPF1.getFeedbackOutputWithoutLshift(lpf1Feedback)
-	                      + state.lpfLPF2.getFeedbackOutputWithoutLshift(lpf2Feedback)
-	                      + state.lpfLPF3.getFeedbackOutputWithoutLshift(lpf3Feedback)
-	                      + state.lpfLPF4.getFeedbackOutputWithoutLshift(divideBy1PlusTannedFrequency))
-	                     << 2;
+	S feedbacksSum = (state.lpfLPF1.getFeedbackOutputWithoutLshift(lpf1FeedbackRamp.get())
+	                  + state.lpfLPF2.getFeedbackOutputWithoutLshift(lpf2FeedbackRamp.get())
+	                  + state.lpfLPF3.getFeedbackOutputWithoutLshift(lpf3FeedbackRamp.get())
+	                  + state.lpfLPF4.getFeedbackOutputWithoutLshift(divideBy1PlusTannedFrequency))
+	                 << 2;
 
 	// Note: in the line above, we "should" halve filterSetConfig->divideBy1plusg to get it into the 1=1073741824 range.
 	// But it doesn't sound as good. Primarily it stops us getting to full resonance. But even if we allow further
@@ -397,15 +413,15 @@ q31_t LpLadderFilter::setConfig(q31_t lpfFrequency, q31_t lpfResonance, FilterMo
 	feedbacksSum = getTanHUnknown(feedbacksSum, 7);
 
 	// We don't saturate the input anymore, because that's the place where we'd get the most aliasing!
-	q31_t x = scaleInput(input, feedbacksSum);
+	S x = scaleInput(input, feedbacksSum);
 
-	q31_t a = state.lpfLPF1.doFilter(x, noisy_m);
+	S a = state.lpfLPF1.doFilter(x, noisy_m);
 
-	q31_t b = state.lpfLPF2.doFilter(a, noisy_m);
+	S b = state.lpfLPF2.doFilter(a, noisy_m);
 
-	q31_t c = state.lpfLPF3.doFilter(b, noisy_m);
+	S c = state.lpfLPF3.doFilter(b, noisy_m);
 
-	q31_t d = state.lpfLPF4.doFilter(c, noisy_m) << 1;
+	S d = state.lpfLPF4.doFilter(c, noisy_m) << 1;
 
 	return d;
 }
@@ -30,18 +30,21 @@ public:
 	q31_t setConfig(q31_t hpfFrequency, q31_t hpfResonance, FilterMode lpfMode, q31_t lpfMorph, q31_t filterGain);
 	void doFilter(q31_t* outputSample, q31_t* endSample, int32_t sampleIncrememt);
 	void doFilterStereo(q31_t* startSample, q31_t* endSample);
+	/// doFilterStereo() a channel at a time, kept as the reference for the two lane version to be checked against
+	void doFilterStereoScalar(q31_t* startSample, q31_t* endSample);
 	void resetFilter() {
 		l.reset();
 		r.reset();
 	}
 
 private:
+	template <typename S>
 	struct LpLadderState {
-		q31_t noiseLastValue;
-		BasicFilterComponent lpfLPF1;
-		BasicFilterComponent lpfLPF2;
-		BasicFilterComponent lpfLPF3;
-		BasicFilterComponent lpfLPF4;
+		S noiseLastValue;
+		FilterComponent<S> lpfLPF1;
+		FilterComponent<S> lpfLPF2;
+		FilterComponent<S> lpfLPF3;
+		FilterComponent<S> lpfLPF4;
 		void reset() {
 			lpfLPF1.reset();
 			lpfLPF2.reset();
@@ -49,14 +52,17 @@ private:
 			lpfLPF4.reset();
 		}
 	};
-	[[gnu::always_inline]] inline q31_t scaleInput(q31_t input, q31_t feedbacksSum) {
-		q31_t temp;
+	template <typename S>
+	[[gnu::always_inline]] inline S scaleInput(S input, S feedbacksSum) {
+		q31_t processedResonance = processedResonanceRamp.get();
+		q31_t divideByTotalMoveabilityAndProcessedResonance = divideByTotalMoveabilityAndProcessedResonanceRamp.get();
+		S temp;
 		if (morph > 0 || processedResonance > 510000000) {
 			temp = multiply_32x32_rshift32_rounded(
 			           (input - (multiply_32x32_rshift32_rounded(feedbacksSum, processedResonance) << 3)),
 			           divideByTotalMoveabilityAndProcessedResonance)
 			       << 2;
-			q31_t extra = 2 * multiply_32x32_rshift32(input, morph);
+			S extra = 2 * multiply_32x32_rshift32(input, morph);
 			temp = getTanHUnknown(temp + extra, 2);
 		}
 		else {
@@ -68,16 +74,27 @@ private:
 
 		return temp;
 	}
-	[[gnu::always_inline]] inline q31_t do24dBLPFOnSample(q31_t input, LpLadderState& state);
-	[[gnu::always_inline]] inline q31_t do12dBLPFOnSample(q31_t input, LpLadderState& state);
-	[[gnu::always_inline]] inline q31_t doDriveLPFOnSample(q31_t input, LpLadderState& state);
+	template <typename S>
+	[[gnu::always_inline]] inline S do24dBLPFOnSample(S input, LpLadderState<S>& state);
+	template <typename S>
+	[[gnu::always_inline]] inline S do12dBLPFOnSample(S input, LpLadderState<S>& state);
+	// Takes its noise from the caller, as oversampling takes it in a different order
+	template <typename S>
+	[[gnu::always_inline]] inline S doDriveLPFOnSample(S input, S noise, LpLadderState<S>& state);
+	/// Calls render with the per sample function for the current mode, which takes either a single channel's sample
+	/// and state, or both channels' as lanes
+	template <typename Render>
+	[[gnu::always_inline]] inline void renderMode(Render render);
+	void startRamps(int32_t numSteps);
+	[[gnu::always_inline]] inline void stepRamps();
+	void finishRamps();
 	// all ladders are in this class to share the basic components
 	// this differentiates between them
 	FilterMode lpfMode;
 
 	// state
-	LpLadderState l;
-	LpLadderState r;
+	LpLadderState<q31_t> l;
+	LpLadderState<q31_t> r;
 
 	// configuration
 	q31_t processedResonance;
@@ -94,5 +111,14 @@ private:
 	q31_t lpf3Feedback;
 
 	bool doOversampling;
+
+	// The coefficients as the filter actually uses them, moving to the ones above over each window
+	RampedCoefficient moveabilityRamp;
+	RampedCoefficient processedResonanceRamp;
+	RampedCoefficient divideByTotalMoveabilityAndProcessedResonanceRamp;
+	RampedCoefficient lpf1FeedbackRamp;
+	RampedCoefficient lpf2FeedbackRamp;
+	RampedCoefficient lpf3FeedbackRamp;
+	RampedCoefficient divideBy1PlusTannedFrequencyRamp;
 };
 } // namespace deluge::dsp::filter
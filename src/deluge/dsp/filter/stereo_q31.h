@@ -0,0 +1,213 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "util/fixedpoint.h"
+#include "util/functions.h"
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace deluge::dsp::filter {
+
+// So the scalar versions are still found alongside the overloads below
+using ::getTanHAntialiased;
+using ::getTanHUnknown;
+using ::multiply_32x32_rshift32;
+using ::multiply_32x32_rshift32_rounded;
+using ::multiply_accumulate_32x32_rshift32_rounded;
+
+/// A frame of interleaved stereo, with L and R as the two lanes of a NEON register so that a filter can put both
+/// channels through the same instructions. Each function here gives exactly what the fixedpoint.h function of the same
+/// name gives on each lane, so a filter written against these matches its scalar version bit for bit. Off ARM, the
+/// lanes are just done one after the other.
+class StereoQ31 {
+public:
+	StereoQ31() = default;
+	StereoQ31(q31_t l, q31_t r);
+	static StereoQ31 broadcast(q31_t value);
+	static StereoQ31 load(q31_t const* frame);
+	void store(q31_t* frame) const;
+	[[nodiscard]] q31_t l() const;
+	[[nodiscard]] q31_t r() const;
+
+	friend StereoQ31 operator+(StereoQ31 a, StereoQ31 b);
+	friend StereoQ31 operator-(StereoQ31 a, StereoQ31 b);
+	friend StereoQ31 operator*(StereoQ31 a, int32_t b);
+	friend StereoQ31 operator<<(StereoQ31 a, int32_t shift);
+	friend StereoQ31 operator>>(StereoQ31 a, int32_t shift);
+	friend StereoQ31 multiply_32x32_rshift32(StereoQ31 a, StereoQ31 b);
+	friend StereoQ31 multiply_32x32_rshift32_rounded(StereoQ31 a, StereoQ31 b);
+	friend StereoQ31 max(StereoQ31 a, StereoQ31 b);
+
+private:
+#if defined(__ARM_NEON)
+	explicit StereoQ31(int32x2_t lanes) : lanes_(lanes) {}
+	int32x2_t lanes_;
+#else
+	q31_t l_;
+	q31_t r_;
+#endif
+};
+
+#if defined(__ARM_NEON)
+
+inline StereoQ31::StereoQ31(q31_t l, q31_t r) : lanes_(vset_lane_s32(r, vdup_n_s32(l), 1)) {
+}
+inline StereoQ31 StereoQ31::broadcast(q31_t value) {
+	return StereoQ31{vdup_n_s32(value)};
+}
+inline StereoQ31 StereoQ31::load(q31_t const* frame) {
+	return StereoQ31{vld1_s32(frame)};
+}
+inline void StereoQ31::store(q31_t* frame) const {
+	vst1_s32(frame, lanes_);
+}
+inline q31_t StereoQ31::l() const {
+	return vget_lane_s32(lanes_, 0);
+}
+inline q31_t StereoQ31::r() const {
+	return vget_lane_s32(lanes_, 1);
+}
+inline StereoQ31 operator+(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{vadd_s32(a.lanes_, b.lanes_)};
+}
+inline StereoQ31 operator-(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{vsub_s32(a.lanes_, b.lanes_)};
+}
+inline StereoQ31 operator*(StereoQ31 a, int32_t b) {
+	return StereoQ31{vmul_n_s32(a.lanes_, b)};
+}
+inline StereoQ31 operator<<(StereoQ31 a, int32_t shift) {
+	return StereoQ31{vshl_s32(a.lanes_, vdup_n_s32(shift))};
+}
+// A negative shift is an arithmetic shift right
+inline StereoQ31 operator>>(StereoQ31 a, int32_t shift) {
+	return StereoQ31{vshl_s32(a.lanes_, vdup_n_s32(-shift))};
+}
+// smmul
+inline StereoQ31 multiply_32x32_rshift32(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{vshrn_n_s64(vmull_s32(a.lanes_, b.lanes_), 32)};
+}
+// smmulr
+inline StereoQ31 multiply_32x32_rshift32_rounded(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{vrshrn_n_s64(vmull_s32(a.lanes_, b.lanes_), 32)};
+}
+inline StereoQ31 max(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{vmax_s32(a.lanes_, b.lanes_)};
+}
+
+#else
+
+inline StereoQ31::StereoQ31(q31_t l, q31_t r) : l_(l), r_(r) {
+}
+inline StereoQ31 StereoQ31::broadcast(q31_t value) {
+	return StereoQ31{value, value};
+}
+inline StereoQ31 StereoQ31::load(q31_t const* frame) {
+	return StereoQ31{frame[0], frame[1]};
+}
+inline void StereoQ31::store(q31_t* frame) const {
+	frame[0] = l_;
+	frame[1] = r_;
+}
+inline q31_t StereoQ31::l() const {
+	return l_;
+}
+inline q31_t StereoQ31::r() const {
+	return r_;
+}
+inline StereoQ31 operator+(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{a.l_ + b.l_, a.r_ + b.r_};
+}
+inline StereoQ31 operator-(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{a.l_ - b.l_, a.r_ - b.r_};
+}
+inline StereoQ31 operator*(StereoQ31 a, int32_t b) {
+	return StereoQ31{a.l_ * b, a.r_ * b};
+}
+inline StereoQ31 operator<<(StereoQ31 a, int32_t shift) {
+	return StereoQ31{a.l_ << shift, a.r_ << shift};
+}
+inline StereoQ31 operator>>(StereoQ31 a, int32_t shift) {
+	return StereoQ31{a.l_ >> shift, a.r_ >> shift};
+}
+inline StereoQ31 multiply_32x32_rshift32(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{multiply_32x32_rshift32(a.l_, b.l_), multiply_32x32_rshift32(a.r_, b.r_)};
+}
+inline StereoQ31 multiply_32x32_rshift32_rounded(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{multiply_32x32_rshift32_rounded(a.l_, b.l_), multiply_32x32_rshift32_rounded(a.r_, b.r_)};
+}
+inline StereoQ31 max(StereoQ31 a, StereoQ31 b) {
+	return StereoQ31{std::max(a.l_, b.l_), std::max(a.r_, b.r_)};
+}
+
+#endif
+
+// A coefficient shared by both channels
+inline StereoQ31 operator+(StereoQ31 a, q31_t b) {
+	return a + StereoQ31::broadcast(b);
+}
+inline StereoQ31 operator+(q31_t a, StereoQ31 b) {
+	return StereoQ31::broadcast(a) + b;
+}
+inline StereoQ31 operator-(StereoQ31 a, q31_t b) {
+	return a - StereoQ31::broadcast(b);
+}
+inline StereoQ31 operator-(q31_t a, StereoQ31 b) {
+	return StereoQ31::broadcast(a) - b;
+}
+inline StereoQ31 operator*(int32_t a, StereoQ31 b) {
+	return b * a;
+}
+inline StereoQ31 multiply_32x32_rshift32(StereoQ31 a, q31_t b) {
+	return multiply_32x32_rshift32(a, StereoQ31::broadcast(b));
+}
+inline StereoQ31 multiply_32x32_rshift32(q31_t a, StereoQ31 b) {
+	return multiply_32x32_rshift32(StereoQ31::broadcast(a), b);
+}
+inline StereoQ31 multiply_32x32_rshift32_rounded(StereoQ31 a, q31_t b) {
+	return multiply_32x32_rshift32_rounded(a, StereoQ31::broadcast(b));
+}
+inline StereoQ31 multiply_32x32_rshift32_rounded(q31_t a, StereoQ31 b) {
+	return multiply_32x32_rshift32_rounded(StereoQ31::broadcast(a), b);
+}
+// smmlar
+template <typename Sum, typename A, typename B>
+requires(std::is_same_v<Sum, StereoQ31> || std::is_same_v<A, StereoQ31> || std::is_same_v<B, StereoQ31>)
+inline StereoQ31 multiply_accumulate_32x32_rshift32_rounded(Sum sum, A a, B b) {
+	return sum + multiply_32x32_rshift32_rounded(a, b);
+}
+inline StereoQ31 max(StereoQ31 a, q31_t b) {
+	return max(a, StereoQ31::broadcast(b));
+}
+
+// The saturation curves are table lookups, so they're done a lane at a time
+inline StereoQ31 getTanHUnknown(StereoQ31 input, uint32_t saturationAmount) {
+	return StereoQ31{getTanHUnknown(input.l(), saturationAmount), getTanHUnknown(input.r(), saturationAmount)};
+}
+inline StereoQ31 getTanHAntialiased(StereoQ31 input, uint32_t* lastWorkingValues, uint32_t saturationAmount) {
+	q31_t l = getTanHAntialiased(input.l(), &lastWorkingValues[0], saturationAmount);
+	return StereoQ31{l, getTanHAntialiased(input.r(), &lastWorkingValues[1], saturationAmount)};
+}
+
+} // namespace deluge::dsp::filter
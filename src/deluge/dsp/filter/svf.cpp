@@ -18,17 +18,35 @@
 
 namespace deluge::dsp::filter {
 [[gnu::hot]] void SVFilter::doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrememt) {
+	startRamps((endSample - startSample + sampleIncrememt - 1) / sampleIncrememt);
 	q31_t* currentSample = startSample;
 	do {
+		stepRamps();
 		q31_t outs = doSVF(*currentSample, l);
 		*currentSample = outs;
 
 		currentSample += sampleIncrememt;
 	} while (currentSample < endSample);
+	finishRamps();
 }
 [[gnu::hot]] void SVFilter::doFilterStereo(q31_t* startSample, q31_t* endSample) {
+	startRamps((endSample - startSample) >> 1);
+	SVFState<StereoQ31> state{{l.low, r.low}, {l.band, r.band}};
 	q31_t* currentSample = startSample;
 	do {
+		stepRamps();
+		doSVF(StereoQ31::load(currentSample), state).store(currentSample);
+		currentSample += 2;
+	} while (currentSample < endSample);
+	l = {state.low.l(), state.band.l()};
+	r = {state.low.r(), state.band.r()};
+	finishRamps();
+}
+void SVFilter::doFilterStereoScalar(q31_t* startSample, q31_t* endSample) {
+	startRamps((endSample - startSample) >> 1);
+	q31_t* currentSample = startSample;
+	do {
+		stepRamps();
 		q31_t outs = doSVF(*currentSample, l);
 
 		*currentSample = outs;
@@ -36,6 +54,24 @@ namespace deluge::dsp::filter {
 		*(currentSample + 1) = outs2;
 		currentSample += 2;
 	} while (currentSample < endSample);
+	finishRamps();
+}
+
+void SVFilter::startRamps(int32_t numSteps) {
+	q31_t rate = startRampWindow(numSteps);
+	fcRamp.startRamp(fc, rate);
+	qRamp.startRamp(q, rate);
+	inRamp.startRamp(in, rate);
+}
+void SVFilter::stepRamps() {
+	fcRamp.step();
+	qRamp.step();
+	inRamp.step();
+}
+void SVFilter::finishRamps() {
+	fcRamp.finishRamp(fc);
+	qRamp.finishRamp(q);
+	inRamp.finishRamp(in);
 }
 
 q31_t SVFilter::setConfig(q31_t freq, q31_t res, FilterMode lpfMode, q31_t lpfMorph, q31_t filterGain) {
@@ -79,16 +115,18 @@ q31_t SVFilter::setConfig(q31_t freq, q31_t res, FilterMode lpfMode, q31_t lpfMo
 	return filterGain;
 }
 
-[[gnu::always_inline]] inline q31_t SVFilter::doSVF(int32_t input, SVFState& state) {
-	q31_t high = 0;
-	q31_t notch = 0;
-	q31_t lowi;
-	q31_t highi;
-	q31_t bandi;
-	q31_t low = state.low;
-	q31_t band = state.band;
+template <typename S>
+[[gnu::always_inline]] inline S SVFilter::doSVF(S input, SVFState<S>& state) {
+	q31_t fc = fcRamp.get();
+	q31_t q = qRamp.get();
+	S high;
+	S lowi;
+	S highi;
+	S bandi;
+	S low = state.low;
+	S band = state.band;
 
-	input = multiply_32x32_rshift32(in, input);
+	input = multiply_32x32_rshift32(inRamp.get(), input);
 
 	low = low + 2 * multiply_32x32_rshift32(band, fc);
 	high = input - low;
@@ -113,7 +151,7 @@ q31_t SVFilter::setConfig(q31_t freq, q31_t res, FilterMode lpfMode, q31_t lpfMo
 	highi = highi + high;
 	bandi = bandi + band;
 
-	q31_t result = multiply_32x32_rshift32_rounded(lowi, c_low);
+	S result = multiply_32x32_rshift32_rounded(lowi, c_low);
 	result = multiply_accumulate_32x32_rshift32_rounded(result, highi, c_high);
 	if (band_mode) {
 		result = multiply_accumulate_32x32_rshift32_rounded(result, bandi, c_band);
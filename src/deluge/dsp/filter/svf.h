@@ -29,20 +29,30 @@ public:
 	q31_t setConfig(q31_t hpfFrequency, q31_t hpfResonance, FilterMode lpfMode, q31_t lpfMorph, q31_t filterGain);
 	void doFilter(q31_t* startSample, q31_t* endSample, int32_t sampleIncrememt);
 	void doFilterStereo(q31_t* startSample, q31_t* endSample);
+	/// doFilterStereo() a channel at a time, kept as the reference for the two lane version to be checked against
+	void doFilterStereoScalar(q31_t* startSample, q31_t* endSample);
 	void resetFilter() {
-		l = (SVFState){0, 0};
-		r = (SVFState){0, 0};
+		l = {0, 0};
+		r = {0, 0};
 	}
 
 private:
+	template <typename S>
 	struct SVFState {
-		q31_t low;
-		q31_t band;
+		S low;
+		S band;
 	};
-	[[gnu::always_inline]] inline q31_t doSVF(q31_t input, SVFState& state);
-	SVFState l;
-	SVFState r;
+	template <typename S>
+	[[gnu::always_inline]] inline S doSVF(S input, SVFState<S>& state);
+	void startRamps(int32_t numSteps);
+	[[gnu::always_inline]] inline void stepRamps();
+	void finishRamps();
+	SVFState<q31_t> l;
+	SVFState<q31_t> r;
 
+	RampedCoefficient fcRamp;
+	RampedCoefficient qRamp;
+	RampedCoefficient inRamp;
 	q31_t q;
 	q31_t in;
 	q31_t c_low;
@@ -34,35 +34,27 @@ StereoSample Interpolator::interpolate(size_t channels, int32_t whichKernel, uin
 		kernelVector[i] = value1.MultiplyAddFixedPoint((value2 - value1), strength2);
 	}
 
-	Argon<int32_t> multiplied = 0;
-	for (size_t i = 0; i < kernelVector.size(); ++i) {
-		size_t idx = i * decltype(kernelVector)::value_type::lanes;
-		// TODO: auto [low, high] = ArgonHalf<int16_t>::LoadMulti<2>(&buffer_l[idx]);
-		auto low = ArgonHalf<int16_t>::Load(&buffer_l[idx]);
-		auto high = ArgonHalf<int16_t>::Load(&buffer_l[idx + ArgonHalf<int16_t>::lanes]);
-
-		multiplied = multiplied
-		                 .MultiplyAddLong(kernelVector[i].GetLow(), low)    // low half
-		                 .MultiplyAddLong(kernelVector[i].GetHigh(), high); // high half
-	}
-
-	output.l = multiplied.ReduceAdd();
-
-	if (channels == 2) {
-
+	// The window starts at the head of the ring buffer and is contiguous thanks to the second copy, though it's only
+	// 16 bit aligned
+	auto convolve = [&](const int16_t* window) {
 		Argon<int32_t> multiplied = 0;
 		for (size_t i = 0; i < kernelVector.size(); ++i) {
 			size_t idx = i * decltype(kernelVector)::value_type::lanes;
-			// TODO: auto [low, high] = ArgonHalf<int16_t>::LoadMulti<2>(&buffer_l[idx]);
-			auto low = ArgonHalf<int16_t>::Load(&buffer_l[idx]);
-			auto high = ArgonHalf<int16_t>::Load(&buffer_l[idx + ArgonHalf<int16_t>::lanes]);
+			// TODO: auto [low, high] = ArgonHalf<int16_t>::LoadMulti<2>(&window[idx]);
+			auto low = ArgonHalf<int16_t>::Load(&window[idx]);
+			auto high = ArgonHalf<int16_t>::Load(&window[idx + ArgonHalf<int16_t>::lanes]);
 
 			multiplied = multiplied
 			                 .MultiplyAddLong(kernelVector[i].GetLow(), low)    // low half
 			                 .MultiplyAddLong(kernelVector[i].GetHigh(), high); // high half
 		}
+		return multiplied.ReduceAdd();
+	};
 
-		output.r = multiplied.ReduceAdd();
+	output.l = convolve(&buffer_l_[head_]);
+
+	if (channels == 2) {
+		output.r = convolve(&buffer_r_[head_]);
 	}
 	return output;
 }
@@ -72,9 +64,9 @@ StereoSample Interpolator::interpolateLinear(size_t channels, uint32_t phase) {
 	int16_t strength2 = phase >> 9;
 	int16_t strength1 = std::numeric_limits<int16_t>::max() - strength2; // inverse
 
-	output.l = (buffer_l[1] * strength1) + (buffer_l[0] * strength2);
+	output.l = (getL(1) * strength1) + (getL(0) * strength2);
 	if (channels == 2) {
-		output.r = (buffer_r[1] * strength1) + (buffer_r[0] * strength2);
+		output.r = (getR(1) * strength1) + (getR(0) * strength2);
 	}
 	return output;
 }
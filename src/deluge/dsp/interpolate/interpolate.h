@@ -7,38 +7,60 @@
 extern const int16_t windowedSincKernel[][17][16];
 
 namespace deluge::dsp {
+/// Holds the most recent kInterpolationMaxNumSamples source samples of each channel, newest at index 0.
+///
+/// Each channel is a ring buffer stored twice over, kInterpolationMaxNumSamples apart, so pushing or jumping forward
+/// just moves the head rather than shifting the whole window, and the window the kernel is applied to is always
+/// contiguous in memory.
 struct [[gnu::hot]] Interpolator {
 
 	Interpolator() = default;
 	StereoSample interpolate(size_t channels, int32_t whichKernel, uint32_t oscPos);
 	StereoSample interpolateLinear(size_t channels, uint32_t oscPos);
 
-	[[gnu::always_inline]] constexpr void pushL(int16_t value) {
-#pragma unroll
-		for (int32_t i = kInterpolationMaxNumSamples - 1; i >= 1; i--) {
-			buffer_l[i] = buffer_l[i - 1];
-		}
-		buffer_l[0] = value;
+	/// Push a mono sample, leaving the right channel stale
+	[[gnu::always_inline]] constexpr void push(int16_t l) {
+		jumpForward(1);
+		setL(0, l);
 	}
 
-	[[gnu::always_inline]] constexpr void pushR(int16_t value) {
-#pragma unroll
-		for (int32_t i = kInterpolationMaxNumSamples - 1; i >= 1; i--) {
-			buffer_r[i] = buffer_r[i - 1];
-		}
-		buffer_r[0] = value;
+	[[gnu::always_inline]] constexpr void push(int16_t l, int16_t r) {
+		jumpForward(1);
+		set(0, l, r);
 	}
 
+	/// Makes room for num_samples new samples at the start of the window, which the caller must then fill in with
+	/// setL() / setR(). Whatever was at those positions before is left in place
 	[[gnu::always_inline]] constexpr void jumpForward(size_t num_samples) {
-#pragma unroll
-		for (int32_t i = kInterpolationMaxNumSamples - 1; i >= num_samples; i--) {
-			buffer_l[i] = buffer_l[i - num_samples];
-			buffer_r[i] = buffer_r[i - num_samples];
-		}
+		head_ = (head_ - num_samples) & (kInterpolationMaxNumSamples - 1);
 	}
 
+	[[gnu::always_inline]] constexpr void setL(size_t i, int16_t value) {
+		size_t pos = (head_ + i) & (kInterpolationMaxNumSamples - 1);
+		buffer_l_[pos] = value;
+		buffer_l_[pos + kInterpolationMaxNumSamples] = value;
+	}
+
+	[[gnu::always_inline]] constexpr void setR(size_t i, int16_t value) {
+		size_t pos = (head_ + i) & (kInterpolationMaxNumSamples - 1);
+		buffer_r_[pos] = value;
+		buffer_r_[pos + kInterpolationMaxNumSamples] = value;
+	}
+
+	[[gnu::always_inline]] constexpr void set(size_t i, int16_t l, int16_t r) {
+		setL(i, l);
+		setR(i, r);
+	}
+
+	[[nodiscard]] constexpr int16_t getL(size_t i) const { return buffer_l_[head_ + i]; }
+	[[nodiscard]] constexpr int16_t getR(size_t i) const { return buffer_r_[head_ + i]; }
+
+private:
+	// Index of the newest sample, the window runs from here for kInterpolationMaxNumSamples
+	size_t head_{0};
+
 	// These are the state buffers (quadword alignment for NEON)
-	alignas(sizeof(int32_t) * 4) std::array<int16_t, kInterpolationMaxNumSamples> buffer_l;
-	alignas(sizeof(int32_t) * 4) std::array<int16_t, kInterpolationMaxNumSamples> buffer_r;
+	alignas(sizeof(int32_t) * 4) std::array<int16_t, kInterpolationMaxNumSamples * 2> buffer_l_;
+	alignas(sizeof(int32_t) * 4) std::array<int16_t, kInterpolationMaxNumSamples * 2> buffer_r_;
 };
 } // namespace deluge::dsp
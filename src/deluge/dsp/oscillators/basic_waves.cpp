@@ -20,6 +20,8 @@
 #include "processing/render_wave.h"
 #include "util/functions.h"
 #include "util/lookuptables/lookuptables.h"
+#include <algorithm>
+#include <array>
 namespace deluge::dsp {
 /* Before calling, you must:
     amplitude <<= 1;
@@ -51,6 +53,48 @@ void renderWave(const int16_t* __restrict__ table, int32_t tableSizeMagnitude, i
 	} while (outputBufferPos < bufferEnd);
 }
 
+// Each part is scaled down by this much before being summed, so that up to kMaxNumVoicesUnison full-scale parts
+// can't wrap. It's made back up after the amplitude has been applied.
+constexpr int32_t kUnisonSumHeadroomBits = 3;
+static_assert(kMaxNumVoicesUnison <= (1 << kUnisonSumHeadroomBits));
+
+/* Renders numParts unison parts which all read the same table, summing them in registers and applying the amplitude
+   to the sum, so the output buffer only gets loaded and stored once no matter how many parts there are. Always adds
+   to what's already in the buffer. Phases aren't written back - the caller advances them.
+   Before calling, you must:
+    amplitude <<= 1;
+    amplitudeIncrement <<= 1;
+*/
+void renderWaveUnison(const int16_t* __restrict__ table, int32_t tableSizeMagnitude, int32_t amplitude,
+                      int32_t* __restrict__ outputBuffer, int32_t* bufferEnd, const uint32_t* phaseIncrements,
+                      const uint32_t* phases, int32_t numParts, int32_t amplitudeIncrement) {
+	std::array<uint32_t, kMaxNumVoicesUnison> phaseNow;
+	std::copy_n(phases, numParts, phaseNow.begin());
+
+	int32_t* __restrict__ outputBufferPos = outputBuffer;
+
+	int32x4_t amplitudeVector = createAmplitudeVector(amplitude, amplitudeIncrement);
+	int32x4_t amplitudeIncrementVector = vdupq_n_s32(amplitudeIncrement << 1);
+	do {
+		int32x4_t sumVector = vdupq_n_s32(0);
+		for (int32_t u = 0; u < numParts; u++) {
+			int32x4_t valueVector;
+			std::tie(valueVector, phaseNow[u]) =
+			    waveRenderingFunctionGeneral(phaseNow[u], phaseIncrements[u], 0, table, tableSizeMagnitude);
+			sumVector = vsraq_n_s32(sumVector, valueVector, kUnisonSumHeadroomBits);
+		}
+
+		int32x4_t existingDataInBuffer = vld1q_s32(outputBufferPos);
+		sumVector = vqdmulhq_s32(amplitudeVector, sumVector);
+		amplitudeVector = vaddq_s32(amplitudeVector, amplitudeIncrementVector);
+		sumVector = vaddq_s32(vqshlq_n_s32(sumVector, kUnisonSumHeadroomBits), existingDataInBuffer);
+
+		vst1q_s32(outputBufferPos, sumVector);
+
+		outputBufferPos += 4;
+	} while (outputBufferPos < bufferEnd);
+}
+
 /* Before calling, you must:
     amplitude <<= 1;
     amplitudeIncrement <<= 1;
@@ -18,6 +18,7 @@
 #include "basic_waves.h"
 #include "processing/render_wave.h"
 #include "storage/wave_table/wave_table.h"
+#include <array>
 
 namespace deluge {
 namespace dsp {
@@ -506,6 +507,94 @@ callRenderWave:
 
 	maybeStorePhase(type, startPhase, phase, doPulseWave);
 }
+
+bool Oscillator::canRenderUnisonBatch(OscType type, uint32_t pulseWidth) {
+	switch (type) {
+	case OscType::SINE:
+	case OscType::SAW:
+	case OscType::SQUARE:
+	case OscType::ANALOG_SAW_2:
+	case OscType::ANALOG_SQUARE:
+		return pulseWidth == 0;
+	default:
+		return false;
+	}
+}
+
+// Makes the same table choice renderOsc() would for a part with no PW and no osc sync. Returns nullptr where
+// renderOsc() would do a crude, table-less wave instead.
+const int16_t* Oscillator::getUnisonBatchTable(OscType type, uint32_t phaseIncrement, int32_t* tableSizeMagnitude) {
+	if (type == OscType::SINE) {
+		*tableSizeMagnitude = 8;
+		return sineWaveSmall;
+	}
+
+	int32_t tableNumber;
+	std::tie(tableNumber, *tableSizeMagnitude) = dsp::getTableNumber(phaseIncrement);
+	bool crudeWaveWanted = tableNumber < AudioEngine::cpuDireness + 6;
+
+	switch (type) {
+	case OscType::SAW:
+		return crudeWaveWanted ? nullptr : dsp::sawTables[tableNumber];
+	case OscType::SQUARE:
+		return crudeWaveWanted ? nullptr : dsp::squareTables[tableNumber];
+	case OscType::ANALOG_SAW_2:
+		// renderOsc() swaps these for the crude digital saw
+		return (tableNumber >= 8 && crudeWaveWanted) ? nullptr : dsp::analogSawTables[tableNumber];
+	case OscType::ANALOG_SQUARE:
+		return dsp::analogSquareTables[tableNumber];
+	default:
+		return nullptr;
+	}
+}
+
+void Oscillator::renderOscUnison(OscType type, int32_t amplitude, int32_t* bufferStart, int32_t* bufferEnd,
+                                 int32_t numSamples, const uint32_t* phaseIncrements, uint32_t* phases,
+                                 int32_t numParts, int32_t amplitudeIncrement) {
+	std::array<const int16_t*, kMaxNumVoicesUnison> tables;
+	std::array<int32_t, kMaxNumVoicesUnison> tableSizeMagnitudes;
+	for (int32_t u = 0; u < numParts; u++) {
+		tables[u] = getUnisonBatchTable(type, phaseIncrements[u], &tableSizeMagnitudes[u]);
+	}
+
+	// The sine table is full scale, the others are stored at half
+	int32_t tableAmplitude = amplitude;
+	int32_t tableAmplitudeIncrement = amplitudeIncrement;
+	if (type != OscType::SINE) {
+		tableAmplitude <<= 1;
+		tableAmplitudeIncrement <<= 1;
+	}
+
+	int32_t u = 0;
+	while (u < numParts) {
+		if (tables[u] == nullptr) {
+			renderOsc(type, amplitude, bufferStart, bufferEnd, numSamples, phaseIncrements[u], 0, &phases[u], true,
+			          amplitudeIncrement, false, 0, 0, 0, 0, 0, nullptr);
+			u++;
+			continue;
+		}
+
+		// Parts are in pitch order and detune is small, so usually they all share one table
+		int32_t runEnd = u + 1;
+		while (runEnd < numParts && tables[runEnd] == tables[u]) {
+			runEnd++;
+		}
+
+		if (runEnd - u == 1) {
+			dsp::renderWave(tables[u], tableSizeMagnitudes[u], tableAmplitude, bufferStart, bufferEnd,
+			                phaseIncrements[u], phases[u], true, 0, tableAmplitudeIncrement);
+		}
+		else {
+			dsp::renderWaveUnison(tables[u], tableSizeMagnitudes[u], tableAmplitude, bufferStart, bufferEnd,
+			                      &phaseIncrements[u], &phases[u], runEnd - u, tableAmplitudeIncrement);
+		}
+
+		for (; u < runEnd; u++) {
+			phases[u] += phaseIncrements[u] * numSamples;
+		}
+	}
+}
+
 void Oscillator::applyAmplitudeVectorToBuffer(int32_t amplitude, int32_t numSamples, int32_t amplitudeIncrement,
                                               int32_t* outputBufferPos, int32_t* inputBuferPos) {
 	int32_t const* const bufferEnd = outputBufferPos + numSamples;
@@ -26,6 +26,7 @@ class Oscillator {
 	static void maybeStorePhase(const OscType& type, uint32_t* startPhase, uint32_t phase, bool doPulseWave);
 	static void applyAmplitudeVectorToBuffer(int32_t amplitude, int32_t numSamples, int32_t amplitudeIncrement,
 	                                         int32_t* outputBufferPos, int32_t* inputBuferPos);
+	static const int16_t* getUnisonBatchTable(OscType type, uint32_t phaseIncrement, int32_t* tableSizeMagnitude);
 
 public:
 	static void renderOsc(OscType type, int32_t amplitude, int32_t* bufferStart, int32_t* bufferEnd, int32_t numSamples,
@@ -33,6 +34,17 @@ public:
 	                      int32_t amplitudeIncrement, bool doOscSync, uint32_t resetterPhase,
 	                      uint32_t resetterPhaseIncrement, uint32_t retriggerPhase, int32_t waveIndexIncrement,
 	                      int sourceWaveIndexLastTime, WaveTable* waveTable);
+
+	/// Whether renderOscUnison() can take this wave. It's only for the plain table waves - anything with a pulse width
+	/// or osc sync needs its own buffer per part, so goes through renderOsc().
+	static bool canRenderUnisonBatch(OscType type, uint32_t pulseWidth);
+
+	/// Renders several unison parts of the same wave, adding them with amplitude applied into bufferStart. Parts whose
+	/// phase increments land on the same table are summed in one pass over the buffer. phases get advanced by
+	/// numSamples, like renderOsc() does with startPhase.
+	static void renderOscUnison(OscType type, int32_t amplitude, int32_t* bufferStart, int32_t* bufferEnd,
+	                            int32_t numSamples, const uint32_t* phaseIncrements, uint32_t* phases, int32_t numParts,
+	                            int32_t amplitudeIncrement);
 };
 
 } // namespace dsp
@@ -25,3 +25,4 @@ extern bool allowSomeUserActionsEvenWhenInCardRoutine;
 extern bool readButtonsAndPads();
 extern uint32_t picFirmwareVersion;
 extern bool isShortPress(uint32_t pressTime);
+extern uint32_t timeLastUserInput; // AudioEngine::audioSampleTimer at the last pad, button or encoder action
@@ -512,6 +512,9 @@ PLACE_SDRAM_DATA Language english{
         {STRING_FOR_COMMUNITY_FEATURE_ALTERNATIVE_TAP_TEMPO_BEHAVIOUR, "Alternative Tap Tempo Behaviour"},
         {STRING_FOR_COMMUNITY_FEATURE_HORIZONTAL_MENUS, "Horizontal menus"},
         {STRING_FOR_COMMUNITY_FEATURE_TRIM_FROM_START_OF_AUDIO_CLIP, "Trim from start of audio clips"},
+        {STRING_FOR_COMMUNITY_FEATURE_DEADLINE_SCHEDULING, "Deadline scheduling"},
+        {STRING_FOR_COMMUNITY_FEATURE_BINARY_SONG_FILES, "Binary song files"},
+        {STRING_FOR_COMMUNITY_FEATURE_PRELOAD_NEXT_SONG, "Preload next song"},
         {STRING_FOR_TRACK_STILL_HAS_CLIPS_IN_SESSION, "Track still has clips in session"},
         {STRING_FOR_DELETE_ALL_TRACKS_CLIPS_FIRST, "Delete all track's clips first"},
         {STRING_FOR_CANT_DELETE_FINAL_CLIP, "Can't delete final Clip"},
@@ -610,6 +613,10 @@ PLACE_SDRAM_DATA Language english{
         {STRING_FOR_DELAY, "DELAY"},
         {STRING_FOR_AMOUNT, "AMOUNT"},
         {STRING_FOR_REVERB, "REVERB"},
+        {STRING_FOR_CONVOLUTION, "CONVOLUTION"},
+        {STRING_FOR_IR_FILE, "IR file"},
+        {STRING_FOR_MIX, "Mix"},
+        {STRING_FOR_REMOVE_IR, "Remove IR"},
         {STRING_FOR_VOLUME_DUCKING, "Volume ducking"},
         {STRING_FOR_SIDECHAIN, "Sidechain"},
         {STRING_FOR_THRESHOLD, "Threshold"},
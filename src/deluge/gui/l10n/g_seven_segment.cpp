@@ -294,6 +294,10 @@ PLACE_SDRAM_DATA Language seven_segment{
         {STRING_FOR_POLY_FINGER_MPE, "MPE"},
         {STRING_FOR_MPE_MONO, "POLY2MONO"},
         {STRING_FOR_REVERB_SIDECHAIN, "SIDE"},
+        {STRING_FOR_CONVOLUTION, "CONV"},
+        {STRING_FOR_IR_FILE, "FILE"},
+        {STRING_FOR_MIX, "MIX"},
+        {STRING_FOR_REMOVE_IR, "OFF"},
         {STRING_FOR_ROOM_SIZE, "SIZE"},
         {STRING_FOR_BITCRUSH, "CRUSH"},
         {STRING_FOR_MIDI_DEVICE_DEFINITION, "DEVI"},
@@ -409,6 +413,9 @@ PLACE_SDRAM_DATA Language seven_segment{
         {STRING_FOR_COMMUNITY_FEATURE_GRID_VIEW_LOOP_PADS, "LOOP"},
         {STRING_FOR_COMMUNITY_FEATURE_ALTERNATIVE_TAP_TEMPO_BEHAVIOUR, "TAPT"},
         {STRING_FOR_COMMUNITY_FEATURE_TRIM_FROM_START_OF_AUDIO_CLIP, "TRIM"},
+        {STRING_FOR_COMMUNITY_FEATURE_DEADLINE_SCHEDULING, "EDF"},
+        {STRING_FOR_COMMUNITY_FEATURE_BINARY_SONG_FILES, "BINS"},
+        {STRING_FOR_COMMUNITY_FEATURE_PRELOAD_NEXT_SONG, "PREL"},
         {STRING_FOR_TRACK_STILL_HAS_CLIPS_IN_SESSION, "CANT"},
         {STRING_FOR_DELETE_ALL_TRACKS_CLIPS_FIRST, "CANT"},
         {STRING_FOR_CANT_DELETE_FINAL_CLIP, "CANT"},
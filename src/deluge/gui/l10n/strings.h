@@ -545,6 +545,9 @@ enum class String : size_t {
 	STRING_FOR_COMMUNITY_FEATURE_ALTERNATIVE_TAP_TEMPO_BEHAVIOUR,
 	STRING_FOR_COMMUNITY_FEATURE_HORIZONTAL_MENUS,
 	STRING_FOR_COMMUNITY_FEATURE_TRIM_FROM_START_OF_AUDIO_CLIP,
+	STRING_FOR_COMMUNITY_FEATURE_DEADLINE_SCHEDULING,
+	STRING_FOR_COMMUNITY_FEATURE_BINARY_SONG_FILES,
+	STRING_FOR_COMMUNITY_FEATURE_PRELOAD_NEXT_SONG,
 
 	STRING_FOR_TRACK_STILL_HAS_CLIPS_IN_SESSION,
 	STRING_FOR_DELETE_ALL_TRACKS_CLIPS_FIRST,
@@ -666,6 +669,10 @@ enum class String : size_t {
 	STRING_FOR_AMOUNT,
 	STRING_FOR_REVERB_AMOUNT,
 	STRING_FOR_REVERB,
+	STRING_FOR_CONVOLUTION,
+	STRING_FOR_IR_FILE,
+	STRING_FOR_MIX,
+	STRING_FOR_REMOVE_IR,
 	STRING_FOR_VOLUME_DUCKING,
 	STRING_FOR_SIDECHAIN,
 	STRING_FOR_THRESHOLD,
@@ -0,0 +1,33 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "file.h"
+#include "gui/ui/browser/ir_browser.h"
+#include "gui/ui/sound_editor.h"
+#include "gui/ui_timer_manager.h"
+
+namespace deluge::gui::menu_item::convolution {
+
+void File::beginSession(MenuItem* navigatedBackwardFrom) {
+	soundEditor.shouldGoUpOneLevelOnBegin = true;
+	bool success = openUI(&irBrowser);
+	if (!success) {
+		uiTimerManager.unsetTimer(TimerName::SHORTCUT_BLINK);
+	}
+}
+
+} // namespace deluge::gui::menu_item::convolution
@@ -0,0 +1,40 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "gui/menu_item/integer.h"
+#include "gui/ui/sound_editor.h"
+#include "model/mod_controllable/mod_controllable_audio.h"
+
+namespace deluge::gui::menu_item::convolution {
+class Mix final : public Integer {
+public:
+	using Integer::Integer;
+	void readCurrentValue() override {
+		q31_t mix = soundEditor.currentModControllable->convolution.mix;
+		this->setValue(((int64_t)mix * kMaxMenuValue + (ONE_Q31 >> 1)) / ONE_Q31);
+	}
+	void writeCurrentValue() override {
+		soundEditor.currentModControllable->convolution.mix =
+		    (this->getValue() == kMaxMenuValue) ? ONE_Q31 : this->getValue() * (ONE_Q31 / kMaxMenuValue);
+	}
+	[[nodiscard]] int32_t getMaxValue() const override { return kMaxMenuValue; }
+	bool isRelevant(ModControllableAudio* modControllable, int32_t whichThing) override {
+		return modControllable->convolution.isActive();
+	}
+};
+} // namespace deluge::gui::menu_item::convolution
@@ -16,6 +16,7 @@
  */
 
 #include "settings.h"
+#include "deadline_scheduling.h"
 #include "devSysexSetting.h"
 #include "emulated_display.h"
 #include "setting.h"
@@ -50,6 +51,9 @@ SettingToggle menuEnableGridViewLoopPads(RuntimeFeatureSettingType::EnableGridVi
 SettingToggle menuAlternativeTapTempoBehaviour(RuntimeFeatureSettingType::AlternativeTapTempoBehaviour);
 SettingToggle menuHorizontalMenus(RuntimeFeatureSettingType::HorizontalMenus);
 SettingToggle menuTrimFromStartOfAudioClip(RuntimeFeatureSettingType::TrimFromStartOfAudioClip);
+DeadlineScheduling menuDeadlineScheduling{};
+SettingToggle menuBinarySongFiles(RuntimeFeatureSettingType::BinarySongFiles);
+SettingToggle menuPreloadNextSong(RuntimeFeatureSettingType::PreloadNextSong);
 
 std::array<MenuItem*, RuntimeFeatureSettingType::MaxElement - kNonTopLevelSettings> subMenuEntries{
     &menuDrumRandomizer,
@@ -74,7 +78,10 @@ std::array<MenuItem*, RuntimeFeatureSettingType::MaxElement - kNonTopLevelSettin
     &menuEnableGridViewLoopPads,
     &menuAlternativeTapTempoBehaviour,
     &menuHorizontalMenus,
-    &menuTrimFromStartOfAudioClip};
+    &menuTrimFromStartOfAudioClip,
+    &menuDeadlineScheduling,
+    &menuBinarySongFiles,
+    &menuPreloadNextSong};
 
 Settings::Settings(l10n::String name, l10n::String title) : menu_item::Submenu(name, title, subMenuEntries) {
 }
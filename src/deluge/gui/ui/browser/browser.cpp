@@ -63,7 +63,7 @@ char const* Browser::filenameToStartSearchAt;
 int8_t Browser::numberEditPos;
 NumericLayerScrollingText* Browser::scrollingText;
 
-char const* allowedFileExtensionsXML[] = {"XML", "Json", NULL};
+char const* allowedFileExtensionsXML[] = {"XML", "Json", "DLB", NULL};
 
 Browser::Browser() {
 	fileIcon = deluge::hid::display::OLED::songIcon;
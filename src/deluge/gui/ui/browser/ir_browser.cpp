@@ -0,0 +1,125 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ir_browser.h"
+#include "definitions_cxx.hpp"
+#include "gui/ui/sound_editor.h"
+#include "hid/display/oled.h"
+#include "model/mod_controllable/mod_controllable_audio.h"
+#include <cstring>
+
+IRBrowser::IRBrowser() {
+	fileIcon = deluge::hid::display::OLED::waveIcon;
+	title = "Impulse responses";
+	shouldWrapFolderContents = false;
+}
+
+static char const* allowedFileExtensionsIR[] = {"WAV", "AIFF", "AIF", NULL};
+bool IRBrowser::opened() {
+	bool success = Browser::opened();
+	if (!success)
+		return false;
+
+	allowedFileExtensions = allowedFileExtensionsIR;
+
+	allowFoldersSharingNameWithFile = true;
+	outputTypeToLoad = OutputType::NONE;
+	qwertyVisible = false;
+
+	fileIndexSelected = 0;
+
+	Error error = StorageManager::initSD();
+	if (error != Error::NONE)
+		goto sdError;
+
+	{
+		// Start at the file in use, if there is one
+		char const* filenameToStartAt = "";
+		String& filePath = soundEditor.currentModControllable->convolution.getFilePath();
+		char const* slash = strrchr(filePath.get(), '/');
+		if (slash != nullptr) {
+			error = currentDir.set(filePath.get(), slash - filePath.get());
+			if (error != Error::NONE)
+				goto sdError;
+			filenameToStartAt = slash + 1;
+		}
+		else {
+			currentDir.set("SAMPLES");
+		}
+
+		error = arrivedInNewFolder(1, filenameToStartAt, "SAMPLES");
+		if (error != Error::NONE)
+			goto sdError;
+	}
+
+	return true;
+sdError:
+	display->displayError(error);
+	return false;
+}
+
+Error IRBrowser::getCurrentFilePath(String* path) {
+	Error error;
+
+	path->set(&currentDir);
+	int oldLength = path->getLength();
+	if (oldLength) {
+		error = path->concatenateAtPos("/", oldLength);
+		if (error != Error::NONE) {
+gotError:
+			path->clear();
+			return error;
+		}
+	}
+
+	FileItem* currentFileItem = getCurrentFileItem();
+
+	error = path->concatenate(&currentFileItem->filename);
+	if (error != Error::NONE)
+		goto gotError;
+
+	return Error::NONE;
+}
+
+void IRBrowser::enterKeyPress() {
+	FileItem* currentFileItem = getCurrentFileItem();
+	if (!currentFileItem) {
+		return;
+	}
+
+	if (currentFileItem->isFolder) {
+		char const* filenameChars = currentFileItem->filename.get();
+		Error error = goIntoFolder(filenameChars);
+		if (error != Error::NONE) {
+			display->displayError(error);
+			close(); // Don't use goBackToSoundEditor() because that would do a left-scroll
+		}
+	}
+	else {
+		String path;
+		Error error = getCurrentFilePath(&path);
+		close();
+		if (error != Error::NONE) {
+			display->displayError(error);
+			return;
+		}
+		// The file gets read in by the convolution effect's own task, so the browser doesn't wait for it
+		soundEditor.currentModControllable->convolution.setFilePath(path);
+	}
+}
+
+IRBrowser irBrowser{};
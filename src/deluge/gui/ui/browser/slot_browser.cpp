@@ -223,12 +223,9 @@ Error SlotBrowser::getCurrentFilePath(String* path) {
 	if (error != Error::NONE) {
 		return error;
 	}
-	if (writeJsonFlag) {
-		error = path->concatenate(".Json");
-	}
-	else {
-		error = path->concatenate(".XML");
-	}
+	return path->concatenate(getFileExtension());
+}
 
-	return error;
+char const* SlotBrowser::getFileExtension() {
+	return writeJsonFlag ? ".Json" : ".XML";
 }
@@ -40,6 +40,8 @@ protected:
 	void convertToPrefixFormatIfPossible();
 	void enterKeyPress() override;
 	Error getCurrentFilenameWithoutExtension(String* filename);
+	// Including the dot, for the file the slot's saved to
+	virtual char const* getFileExtension();
 
 	static bool currentFileHasSuffixFormatNameImplied;
 
@@ -42,6 +42,8 @@
 #include "processing/engines/audio_engine.h"
 #include "scheduler_api.h"
 #include "storage/audio/audio_file_manager.h"
+#include "storage/cluster/cluster_prefetcher.h"
+#include "storage/cluster/cluster_warmer.h"
 #include "storage/file_item.h"
 #include "storage/flash_storage.h"
 #include "storage/storage_manager.h"
@@ -258,43 +260,154 @@ void LoadSongUI::doQueueLoadNextSongIfAvailable(int8_t offset) {
 	outputTypeToLoad = OutputType::NONE;
 	currentDir.set(&currentSong->dirPath);
 
-	int32_t currentFileIndexSelected = fileIndexSelected;
+	int32_t nextFileIndex = findNextSongIndex(offset);
+	if (nextFileIndex != -1) {
+		fileIndexSelected = nextFileIndex;
+		Browser::setEnteredTextFromCurrentFilename();
+
+		AudioEngine::logAction("performLoad");
+		performLoad();
+		if (FlashStorage::defaultStartupSongMode == StartupSongMode::LASTOPENED) {
+			runtimeFeatureSettings.writeSettingsToFile();
+		}
+	}
+	// in case we wrapped around the whole list of files and didn't find a song,
+	// we just exit without doing anything else
+
+	currentUIMode = UI_MODE_NONE;
+}
 
-	bool songFound = false;
+// Steps through the files by offset from the selected one, wrapping around and skipping folders. Returns -1 if there's
+// no song at all
+int32_t LoadSongUI::findNextSongIndex(int8_t offset) {
+	int32_t numFileItems = fileItems.getNumElements();
+	if (numFileItems == 0) {
+		return -1;
+	}
+
+	int32_t fileIndex = fileIndexSelected;
 	do {
-		fileIndexSelected = fileIndexSelected + offset;
-		if (fileIndexSelected < 0) {
-			fileIndexSelected = fileItems.getNumElements() - 1;
+		fileIndex += offset;
+		if (fileIndex < 0) {
+			fileIndex = numFileItems - 1;
 		}
-		else if (fileIndexSelected >= fileItems.getNumElements()) {
-			fileIndexSelected = 0;
+		else if (fileIndex >= numFileItems) {
+			fileIndex = 0;
 		}
-		Browser::setEnteredTextFromCurrentFilename();
 
-		FileItem* currentFileItem = getCurrentFileItem();
+		FileItem* fileItem = (FileItem*)fileItems.getElementAddress(fileIndex);
+		if (!fileItem->isFolder) {
+			return fileIndex;
+		}
+	} while (fileIndex != fileIndexSelected);
 
-		if (currentFileItem != nullptr) {
-			// Check if it's a directory...
-			if (currentFileItem->isFolder) {
-				// it is a folder
-				// scroll to the next item
-				continue;
-			}
-			else {
-				// if is a file, select it
-				songFound = true;
-				AudioEngine::logAction("performLoad");
-				performLoad();
-				if (FlashStorage::defaultStartupSongMode == StartupSongMode::LASTOPENED) {
-					runtimeFeatureSettings.writeSettingsToFile();
-				}
-			}
+	return -1;
+}
+
+bool LoadSongUI::isStandbySongFor(FileItem const& fileItem) {
+	return standbySong != nullptr && standbyFilePointer.sclust == fileItem.filePointer.sclust
+	       && standbyFilePointer.objsize == fileItem.filePointer.objsize;
+}
+
+// How long the pads, buttons and encoders have to have been left alone before the next song gets read
+constexpr uint32_t kPreloadIdleTime = kSampleRate * 2;
+
+// While playing, reads the song after the current one into standbySong, and gets the start of its playing samples
+// loaded, so a "load next" can swap to it at the next launch without waiting on the card. Reading it holds up the
+// buttons, pads and encoders until it's done, so it only starts once the user has left everything alone for a bit,
+// and nothing else is happening with the browser or the song.
+void LoadSongUI::preloadRoutine() {
+	clusterWarmer.routine();
+
+	// It's only worth the RAM if there's going to be a song swap while playing
+	if (!runtimeFeatureSettings.isOn(RuntimeFeatureSettingType::PreloadNextSong)
+	    || !playbackHandler.isEitherClockActive()) {
+		discardStandbySong();
+		return;
+	}
+
+	// Anything else needing RAM comes first. Give it back, and don't read the same song in again
+	GeneralMemoryAllocator& allocator = GeneralMemoryAllocator::get();
+	if (allocator.ranShortOfMemory) {
+		allocator.ranShortOfMemory = false;
+		if (standbySong != nullptr) {
+			FilePointer triedFilePointer = standbyFilePointer;
+			discardStandbySong();
+			standbyFilePointer = triedFilePointer;
+			return;
 		}
-	} while (currentFileIndexSelected != fileIndexSelected && !songFound);
-	// in case we wrapped around the whole list of files and didn't find a song,
-	// we just exit without doing anything else
+	}
 
-	currentUIMode = UI_MODE_NONE;
+	if (performingLoad || preLoadedSong != nullptr || currentSong == nullptr || currentUIMode != UI_MODE_NONE
+	    || getCurrentUI() == this || fileIndexSelected == -1 || !currentDir.equals(&currentSong->dirPath)) {
+		return;
+	}
+
+	if (AudioEngine::audioSampleTimer - timeLastUserInput < kPreloadIdleTime) {
+		return;
+	}
+
+	int32_t nextFileIndex = findNextSongIndex(1);
+	if (nextFileIndex == -1 || nextFileIndex == fileIndexSelected) {
+		return;
+	}
+	FileItem* fileItem = (FileItem*)fileItems.getElementAddress(nextFileIndex);
+
+	// Already have it - or tried and failed, in which case don't keep trying
+	if (standbyFilePointer.sclust == fileItem->filePointer.sclust
+	    && standbyFilePointer.objsize == fileItem->filePointer.objsize) {
+		return;
+	}
+
+	discardStandbySong();
+	standbyFilePointer = fileItem->filePointer;
+
+	Error error = StorageManager::openDelugeFile(fileItem, "song");
+	if (error != Error::NONE) {
+		return;
+	}
+
+	void* songMemory = allocator.allocMaxSpeed(sizeof(Song));
+	if (!songMemory) {
+		activeDeserializer->closeWriter();
+		return;
+	}
+
+	AudioEngine::logAction("preloading next song");
+	Song* song = new (songMemory) Song();
+	songBeingPreloaded = song; // So anything defaulting to a song's settings while it's read gets them from this one
+	error = song->paramManager.setupUnpatched();
+	if (error == Error::NONE) {
+		GlobalEffectable::initParams(&song->paramManager);
+		error = song->readFromFile(*activeDeserializer);
+	}
+	songBeingPreloaded = nullptr;
+	FRESULT success = activeDeserializer->closeWriter();
+
+	if (error != Error::NONE || success != FR_OK) {
+		void* toDealloc = dynamic_cast<void*>(song);
+		song->~Song(); // Will also delete paramManager
+		delugeDealloc(toDealloc);
+		return;
+	}
+
+	song->dirPath.set(&currentDir);
+	standbySong = song;
+
+	clusterWarmer.warm(*standbySong);
+	AudioEngine::logAction("preloaded next song");
+}
+
+void LoadSongUI::discardStandbySong() {
+	clusterWarmer.releaseAll();
+	clusterPrefetcher.releaseAll();
+	standbyFilePointer = {0, 0};
+	if (standbySong != nullptr) {
+		void* toDealloc = dynamic_cast<void*>(standbySong);
+		standbySong->~Song();
+		delugeDealloc(toDealloc);
+		standbySong = nullptr;
+	}
 }
 
 // Before calling this, you must set loadButtonReleased.
@@ -316,9 +429,19 @@ void LoadSongUI::performLoad() {
 	if (arrangement.hasPlaybackActive()) {
 		playbackHandler.switchToSession();
 	}
-	Error error;
 
-	error = StorageManager::openDelugeFile(currentFileItem, "song");
+	// If it's the song that was read in the background, it needn't be read again
+	if (!isStandbySongFor(*currentFileItem)) {
+		discardStandbySong();
+	}
+
+	Error error = Error::NONE;
+
+	// The standby Song was read in full already, so there's no file to open, or to close if anything fails
+	bool fileOpen = (standbySong == nullptr);
+	if (fileOpen) {
+		error = StorageManager::openDelugeFile(currentFileItem, "song");
+	}
 
 	currentUIMode = UI_MODE_LOADING_SONG_ESSENTIAL_SAMPLES;
 	indicator_leds::setLedState(IndicatorLED::LOAD, false);
@@ -345,14 +468,27 @@ void LoadSongUI::performLoad() {
 		playbackHandler.songSwapShouldPreserveTempo = Buttons::isButtonPressed(deluge::hid::button::TEMPO_ENC);
 	}
 
-	void* songMemory = GeneralMemoryAllocator::get().allocMaxSpeed(sizeof(Song));
+	void* songMemory = nullptr;
+	FRESULT success = FR_OK;
+
+	if (standbySong != nullptr) {
+		preLoadedSong = standbySong;
+		standbySong = nullptr;
+		AudioEngine::logAction("took preloaded song");
+		goto haveSong;
+	}
+
+	songMemory = GeneralMemoryAllocator::get().allocMaxSpeed(sizeof(Song));
 	if (!songMemory) {
 ramError:
 		error = Error::INSUFFICIENT_RAM;
 
 someError:
 		display->displayError(error);
-		activeDeserializer->closeWriter();
+		if (fileOpen) {
+			activeDeserializer->closeWriter();
+			fileOpen = false;
+		}
 fail:
 		// If we already deleted the old song, make a new blank one. This will take us back to InstrumentClipView.
 		if (!currentSong) {
@@ -452,12 +588,14 @@ gotErrorAfterCreatingSong:
 	}
 	AudioEngine::logAction("read new song from file");
 
-	FRESULT success = activeDeserializer->closeWriter();
+	success = activeDeserializer->closeWriter();
+	fileOpen = false;
 	if (success != FR_OK) {
 		display->displayPopup(deluge::l10n::get(deluge::l10n::String::STRING_FOR_ERROR_LOADING_SONG));
 		goto fail;
 	}
 
+haveSong:
 	preLoadedSong->dirPath.set(&currentDir);
 
 	String currentFilenameWithoutExtension;
@@ -480,6 +618,10 @@ gotErrorAfterCreatingSong:
 	// might actually want
 	preLoadedSong->loadAllSamples(false);
 
+	// Anything warmed up or prefetched in the background has been claimed by now
+	clusterWarmer.releaseAll();
+	clusterPrefetcher.releaseAll();
+
 	// Load samples from files, just for currently playing Sounds (or if not playing, then all Sounds)
 	if (playbackHandler.isEitherClockActive()) {
 		preLoadedSong->loadCrucialSamplesOnly();
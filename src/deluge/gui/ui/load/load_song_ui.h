@@ -35,6 +35,8 @@ public:
 	void performLoad();
 	void displayLoopsRemainingPopup();
 	bool isLoadingSong();
+	void preloadRoutine();
+	void discardStandbySong();
 
 	bool deletedPartsOfOldSong;
 
@@ -55,6 +57,12 @@ private:
 	bool performingLoad;
 	bool scrollingIntoSlot;
 	void doQueueLoadNextSongIfAvailable(int8_t offset);
+	int32_t findNextSongIndex(int8_t offset);
+	bool isStandbySongFor(FileItem const& fileItem);
+
+	// The song after the current one, read in the background while playing so it's ready to swap to
+	Song* standbySong = nullptr;
+	FilePointer standbyFilePointer{0, 0}; // What the standby Song was (or failed to be) read from
 	// int32_t findNextFile(int32_t offset);
 	void exitThisUI();
 	void exitActionWithError();
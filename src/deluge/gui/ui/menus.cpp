@@ -58,6 +58,9 @@
 #include "gui/menu_item/defaults/swing_interval.h"
 #include "gui/menu_item/defaults/ui/clip_type/default_new_clip_type.h"
 #include "gui/menu_item/defaults/velocity.h"
+#include "gui/menu_item/convolution/file.h"
+#include "gui/menu_item/convolution/mix.h"
+#include "gui/menu_item/convolution/remove.h"
 #include "gui/menu_item/delay/analog.h"
 #include "gui/menu_item/delay/ping_pong.h"
 #include "gui/menu_item/delay/sync.h"
@@ -561,6 +564,21 @@ Submenu reverbMenu{
     },
 };
 
+// Convolution -----------------------------------------------------------------------------
+
+convolution::File convolutionFileMenu{STRING_FOR_IR_FILE};
+convolution::Mix convolutionMixMenu{STRING_FOR_MIX};
+convolution::Remove convolutionRemoveMenu{STRING_FOR_REMOVE_IR};
+
+Submenu convolutionMenu{
+    STRING_FOR_CONVOLUTION,
+    {
+        &convolutionFileMenu,
+        &convolutionMixMenu,
+        &convolutionRemoveMenu,
+    },
+};
+
 // FX ----------------------------------------------------------------------------------------
 
 fx::Clipping clippingMenu{STRING_FOR_SATURATION};
@@ -761,6 +779,7 @@ Submenu globalFXMenu{
         &globalEQMenu,
         &globalDelayMenu,
         &globalReverbMenu,
+        &convolutionMenu,
         &stutterMenu,
         &globalModFXMenu,
         &globalDistortionMenu,
@@ -828,6 +847,7 @@ Submenu audioClipFXMenu{
         &eqMenu,
         &globalDelayMenu,
         &globalReverbMenu,
+        &convolutionMenu,
         &stutterMenu,
         &globalModFXMenu,
         &audioClipDistortionMenu,
@@ -1337,6 +1357,7 @@ Submenu soundFXMenu{
         &eqMenu,
         &delayMenu,
         &reverbMenu,
+        &convolutionMenu,
         &stutterMenu,
         &modFXMenu,
         &soundDistortionMenu,
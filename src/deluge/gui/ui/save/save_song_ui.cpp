@@ -19,6 +19,7 @@
 #include "gui/context_menu/overwrite_file.h"
 #include "gui/l10n/l10n.h"
 #include "gui/ui/audio_recorder.h"
+#include "gui/ui/load/load_song_ui.h"
 #include "hid/display/display.h"
 #include "hid/led/indicator_leds.h"
 #include "hid/led/pad_leds.h"
@@ -69,12 +70,7 @@ doReturnFalse:
 	String searchFilename;
 	searchFilename.set(&currentSong->name);
 	if (!searchFilename.isEmpty()) {
-		if (writeJsonFlag) {
-			error = searchFilename.concatenate(".Json");
-		}
-		else {
-			error = searchFilename.concatenate(".XML");
-		}
+		error = searchFilename.concatenate(getFileExtension());
 		if (error != Error::NONE) {
 gotError:
 			display->displayError(error);
@@ -114,6 +110,13 @@ void SaveSongUI::focusRegained() {
 	return SaveUI::focusRegained();
 }
 
+char const* SaveSongUI::getFileExtension() {
+	if (runtimeFeatureSettings.isOn(RuntimeFeatureSettingType::BinarySongFiles)) {
+		return ".DLB";
+	}
+	return SaveUI::getFileExtension();
+}
+
 bool SaveSongUI::performSave(bool mayOverwrite) {
 
 	if (ALPHA_OR_BETA_VERSION && currentlyAccessingCard) {
@@ -443,12 +446,7 @@ gotError:
 			if (error != Error::NONE) {
 				goto gotError;
 			}
-			if (writeJsonFlag) {
-				error = filePathDuringWrite.concatenate(".Json");
-			}
-			else {
-				error = filePathDuringWrite.concatenate(".XML");
-			}
+			error = filePathDuringWrite.concatenate(getFileExtension());
 			if (error != Error::NONE) {
 				goto gotError;
 			}
@@ -464,9 +462,18 @@ gotError:
 		filePathDuringWrite.set(&filePath);
 	}
 
+	// A song preloaded from this folder may be the very file about to be overwritten, so it'll get read in again
+	loadSongUI.discardStandbySong();
+
 	D_PRINTLN("creating:  %s", filePathDuringWrite.get());
 
-	if (writeJsonFlag) {
+	if (runtimeFeatureSettings.isOn(RuntimeFeatureSettingType::BinarySongFiles)) {
+		error = StorageManager::createBinaryFile(filePathDuringWrite.get(), smBinarySerializer, false, false);
+		if (error != Error::NONE) {
+			goto gotError;
+		}
+	}
+	else if (writeJsonFlag) {
 		// Write the actual song file
 		error = StorageManager::createJsonFile(filePathDuringWrite.get(), smJsonSerializer, false, false);
 		if (error != Error::NONE) {
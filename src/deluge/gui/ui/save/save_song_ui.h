@@ -34,6 +34,7 @@ public:
 
 protected:
 	// int32_t arrivedInNewFolder(int32_t direction);
+	char const* getFileExtension() override;
 };
 
 extern SaveSongUI saveSongUI;
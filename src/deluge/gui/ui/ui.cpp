@@ -460,6 +460,7 @@ EnumStringMap<UIType, util::to_underlying(UIType::UI_TYPE_COUNT)> uiTypeMap = {
       {UIType::CONTEXT_MENU, "context_menu"},
       {UIType::DX_BROWSER, "dx_browser"},
       {UIType::INSTRUMENT_CLIP, "instrument_clip"},
+      {UIType::IR_BROWSER, "ir_browser"},
       {UIType::KEYBOARD_SCREEN, "keyboard_screen"},
       {UIType::LOAD_INSTRUMENT_PRESET, "load_instrument_preset"},
       {UIType::LOAD_MIDI_DEVICE_DEFINITION, "load_midi_device_definition"},
@@ -22,6 +22,7 @@
 #include "io/debug/log.h"
 #include "model/sample/sample.h"
 #include "model/sample/sample_recorder.h"
+#include "model/sample/sample_summary.h"
 #include "model/voice/voice_sample.h"
 #include "processing/engines/audio_engine.h"
 #include "scheduler_api.h"
@@ -247,6 +248,11 @@ bool WaveformRenderer::findPeaksPerCol(Sample* sample, int64_t xScrollSamples, u
 
 	uint64_t numValidBytes = numValidSamples * sample->byteDepth * sample->numChannels;
 
+	// Zoomed out this far, we want the summary - so start it again if it's been stolen since the Sample was loaded
+	if (xZoomSamples >= SampleSummary::kMinFramesToSummarise) {
+		sample->getOrCreateSummary(numValidSamples);
+	}
+
 	bool hadAnyTroubleLoading = false;
 
 	for (int32_t col = xStart; col < xEnd; col++) {
@@ -284,6 +290,14 @@ bool WaveformRenderer::findPeaksPerCol(Sample* sample, int64_t xScrollSamples, u
 			continue;
 		}
 
+		// If the summary already covers this whole col, there's no need to read any audio. Loading Clusters below
+		// might steal the summary, so have to grab it fresh each time
+		if (sample->summary != nullptr
+		    && sample->summary->getPeaks(colStartSample, colEndSample, &data->minPerCol[col],
+		                                 &data->maxPerCol[col])) {
+			continue;
+		}
+
 		int32_t colStartByte =
 		    colStartSample * sample->numChannels * sample->byteDepth + sample->audioDataStartPosBytes;
 		int32_t colEndByte = colEndSample * sample->numChannels * sample->byteDepth + sample->audioDataStartPosBytes;
@@ -551,6 +565,11 @@ cantReadData:
 			data->maxPerCol[col] = maxThisCol;
 			data->minPerCol[col] = minThisCol;
 
+			// While we've got the Cluster, add it to the summary, unless it's still being recorded into
+			if (recorder == nullptr || clusterIndexToDo < recorder->firstUnwrittenClusterIndex) {
+				sample->summariseCluster(clusterIndexToDo, *cluster);
+			}
+
 			audioFileManager.removeReasonFromCluster(*cluster, "E340"); // Ron R got this, when error was "iiuh"
 			if (nextCluster != nullptr) {
 				audioFileManager.removeReasonFromCluster(*nextCluster, "9700");
@@ -567,16 +586,22 @@ cantReadData:
 
 	// Keep a running best for the max and min found for the whole Sample
 	else {
+		bool foundMore = false;
 		for (int32_t col = xStart; col < xEnd; col++) {
 			if (data->colStatus[col] == COL_STATUS_INVESTIGATED) {
 				if (data->maxPerCol[col] > sample->maxValueFound) {
 					sample->maxValueFound = data->maxPerCol[col];
+					foundMore = true;
 				}
 				if (data->minPerCol[col] < sample->minValueFound) {
 					sample->minValueFound = data->minPerCol[col];
+					foundMore = true;
 				}
 			}
 		}
+		if (foundMore) {
+			sample->analysisChanged();
+		}
 	}
 
 	return !hadAnyTroubleLoading;
@@ -240,6 +240,9 @@ checkResult:
 		}
 	}
 
+	if (anything) {
+		timeLastUserInput = AudioEngine::audioSampleTimer;
+	}
 	return anything;
 }
 
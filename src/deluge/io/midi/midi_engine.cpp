@@ -610,7 +610,7 @@ bool MidiEngine::checkIncomingSerialMidi() {
 			// If it's a realtime message, we have to obey it right now, separately from any other message it was
 			// inserted into the middle of
 			case 0xF8 ... 0xFF:
-				midiMessageReceived(cable, thisSerialByte >> 4, thisSerialByte & 0x0F, 0, 0, timer);
+				queueMidiMessage(cable, thisSerialByte >> 4, thisSerialByte & 0x0F, 0, 0, timer);
 				return true;
 
 			// Or if it's a SysEx start...
@@ -668,8 +668,8 @@ bool MidiEngine::checkIncomingSerialMidi() {
 		if (bytesPerStatusMessage(serialMidiInput[0]) == numSerialMidiInput) {
 			uint8_t channel = serialMidiInput[0] & 0x0F;
 
-			midiMessageReceived(MIDIDeviceManager::dinMIDIPorts, serialMidiInput[0] >> 4, channel, serialMidiInput[1],
-			                    serialMidiInput[2], timer);
+			queueMidiMessage(MIDIDeviceManager::dinMIDIPorts, serialMidiInput[0] >> 4, channel, serialMidiInput[1],
+			                 serialMidiInput[2], timer);
 
 			// If message was more than 1 byte long, and was a voice or mode message, then allow for running status
 			if (numSerialMidiInput > 1 && ((serialMidiInput[0] & 0xF0) != 0xF0)) {
@@ -753,6 +753,9 @@ void MidiEngine::checkIncomingUsbSysex(uint8_t const* msg, int32_t ip, int32_t d
 bool developerSysexCodeReceived = false;
 
 void MidiEngine::midiSysexReceived(MIDICable& cable, uint8_t* data, int32_t len) {
+	// Keep it in order with anything it arrived behind
+	flushInputQueue();
+
 	if (len < 4) {
 		return;
 	}
@@ -893,8 +896,8 @@ void MidiEngine::checkIncomingUsbMidi() {
 							// fallback to cable 0 since we don't support more than one port on hosted devices yet
 							cable = 0;
 						}
-						midiMessageReceived(*connectedUSBMIDIDevices[ip][d].cable[cable], statusType, channel, data1,
-						                    data2, &timeLastBRDY[ip]);
+						queueMidiMessage(*connectedUSBMIDIDevices[ip][d].cable[cable], statusType, channel, data1, data2,
+						                 &timeLastBRDY[ip]);
 					}
 				}
 
@@ -934,6 +937,36 @@ void MidiEngine::checkIncomingUsbMidi() {
 	}
 }
 
+void MidiEngine::queueMidiMessage(MIDICable& cable, uint8_t statusType, uint8_t channel, uint8_t data1, uint8_t data2,
+                                  uint32_t* timer) {
+	// System messages - clock especially - need dealing with right now, just after anything they arrived behind
+	if (statusType == 0x0F) {
+		flushInputQueue();
+		midiMessageReceived(cable, statusType, channel, data1, data2, timer);
+		return;
+	}
+
+	// MIDI thru has to pass on every message, and whether it does for each is only decided as it's dispatched
+	MIDIInputQueue::Message message{&cable, statusType, channel, data1, data2};
+	if (!inputQueue.push(message, !midiThru)) {
+		flushInputQueue();
+		inputQueue.push(message, !midiThru);
+	}
+}
+
+void MidiEngine::flushInputQueue() {
+	inputQueue.dispatch([this](MIDIInputQueue::Message const& message) {
+		midiMessageReceived(*message.cable, message.statusType, message.channel, message.data1, message.data2);
+	});
+	audioSampleTimerAtLastDispatch = AudioEngine::audioSampleTimer;
+}
+
+void MidiEngine::dispatchQueuedMidiMessages() {
+	if (inputQueue.hasOrderSensitiveMessages() || AudioEngine::audioSampleTimer != audioSampleTimerAtLastDispatch) {
+		flushInputQueue();
+	}
+}
+
 #define MISSING_MESSAGE_CHECK 0
 
 #if MISSING_MESSAGE_CHECK
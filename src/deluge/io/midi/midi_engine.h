@@ -21,6 +21,7 @@
 
 #include "definitions_cxx.hpp"
 #include "io/midi/learned_midi.h"
+#include "io/midi/midi_input_queue.h"
 #include "playback/playback_handler.h"
 
 class MIDICable;
@@ -68,6 +69,12 @@ public:
 	void sendCC(MIDISource source, int32_t channel, int32_t cc, int32_t value, int32_t filter);
 	bool checkIncomingSerialMidi();
 	void checkIncomingUsbMidi();
+	/// Dispatches what the checkIncoming functions queued up - straight away if it includes anything order sensitive,
+	/// like notes, otherwise once the audio engine has started a new window. Params only change once per window, so
+	/// holding expression until then loses nothing and lets it be coalesced.
+	void dispatchQueuedMidiMessages();
+	MIDIInputQueue::Stats const& getInputQueueStats() const { return inputQueue.getStats(); }
+	void resetInputQueueStats() { inputQueue.resetStats(); }
 
 	void checkIncomingUsbSysex(uint8_t const* message, int32_t ip, int32_t d, int32_t cable);
 
@@ -146,6 +153,12 @@ private:
 	EventStackStorage::iterator eventStackTop_;
 
 	int32_t getPotentialNumConnectedUSBMIDIDevices(int32_t ip);
+	void queueMidiMessage(MIDICable& cable, uint8_t statusType, uint8_t channel, uint8_t data1, uint8_t data2,
+	                      uint32_t* timer);
+	void flushInputQueue();
+
+	MIDIInputQueue inputQueue;
+	uint32_t audioSampleTimerAtLastDispatch = 0;
 };
 
 uint32_t setupUSBMessage(MIDIMessage message);
@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "io/midi/midi_input_queue.h"
+
+bool MIDIInputQueue::isCoalescable(Message const& message) {
+	switch (message.statusType) {
+	case 0x0A: // Polyphonic aftertouch
+	case 0x0D: // Channel pressure
+	case 0x0E: // Pitch bend
+		return true;
+
+	case 0x0B:
+		switch (message.data1) {
+		case 6:   // Data entry MSB
+		case 38:  // Data entry LSB
+		case 96:  // Data increment
+		case 97:  // Data decrement
+		case 98:  // NRPN LSB
+		case 99:  // NRPN MSB
+		case 100: // RPN LSB
+		case 101: // RPN MSB
+			return false;
+		default:
+			// Not channel mode messages either
+			return message.data1 < 120;
+		}
+
+	default:
+		return false;
+	}
+}
+
+bool MIDIInputQueue::push(Message const& message, bool mayCoalesce) {
+	mayCoalesce = mayCoalesce && isCoalescable(message);
+	if (mayCoalesce) {
+		// Only the latest one waiting for the same destination can be replaced, or values would swap places
+		for (int32_t i = numMessages - 1; i >= coalesceFrom; i--) {
+			Message& queued = messages[i];
+			// Poly aftertouch and CCs are per note / CC number, the others per channel
+			if (queued.cable == message.cable && queued.statusType == message.statusType
+			    && queued.channel == message.channel
+			    && (message.statusType == 0x0D || message.statusType == 0x0E || queued.data1 == message.data1)) {
+				// Learned CCs act as on / off switches too, so a 0 and what's either side of it all have to get there
+				if (message.statusType == 0x0B && (queued.data2 == 0) != (message.data2 == 0)) {
+					break;
+				}
+				queued = message;
+				stats.coalesced++;
+				return true;
+			}
+		}
+	}
+
+	if (numMessages == kCapacity) {
+		return false;
+	}
+	messages[numMessages++] = message;
+	stats.queued++;
+	if (!mayCoalesce) {
+		coalesceFrom = numMessages;
+	}
+	return true;
+}
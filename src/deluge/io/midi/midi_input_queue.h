@@ -0,0 +1,85 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+class MIDICable;
+
+/// Holds incoming channel messages until they're dispatched, replacing any CC, pitch bend or aftertouch still waiting
+/// for the same destination with the latest value, so a flood of expression only costs one param update per
+/// destination. Anything whose order matters - notes, program changes, RPN/NRPN and channel mode messages - is never
+/// coalesced, and nothing queued before one of those is coalesced with anything arriving after it. Nor is a CC
+/// coalesced between zero and non-zero values, as a learned CC can be a switch.
+class MIDIInputQueue {
+public:
+	struct Message {
+		MIDICable* cable;
+		uint8_t statusType;
+		uint8_t channel;
+		uint8_t data1;
+		uint8_t data2;
+	};
+
+	struct Stats {
+		uint32_t queued;
+		/// Messages that replaced an earlier one for the same destination rather than being dispatched themselves
+		uint32_t coalesced;
+		uint32_t batches;
+	};
+
+	static constexpr int32_t kCapacity = 64;
+
+	static bool isCoalescable(Message const& message);
+
+	/// Returns false, without queueing anything, if the queue is full and the message couldn't be coalesced. If
+	/// mayCoalesce is false, the message is queued as though it were order sensitive
+	bool push(Message const& message, bool mayCoalesce = true);
+	bool isEmpty() const { return numMessages == 0; }
+	/// Whether anything is waiting that shouldn't be held back, for notes not to be delayed
+	bool hasOrderSensitiveMessages() const { return coalesceFrom > 0; }
+
+	template <typename F>
+	void dispatch(F&& dispatchMessage) {
+		if (!numMessages) {
+			return;
+		}
+		stats.batches++;
+		// Emptied before dispatching anything, in case dealing with a message ends up receiving and dispatching more
+		std::array<Message, kCapacity> batch;
+		int32_t numInBatch = numMessages;
+		std::copy_n(messages.begin(), numInBatch, batch.begin());
+		numMessages = 0;
+		coalesceFrom = 0;
+		for (int32_t i = 0; i < numInBatch; i++) {
+			dispatchMessage(batch[i]);
+		}
+	}
+
+	Stats const& getStats() const { return stats; }
+	void resetStats() { stats = {}; }
+
+private:
+	std::array<Message, kCapacity> messages;
+	int32_t numMessages = 0;
+	/// Messages before this one are at or before an order sensitive one, so mustn't be coalesced with new ones
+	int32_t coalesceFrom = 0;
+	Stats stats{};
+};
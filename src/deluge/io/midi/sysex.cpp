@@ -21,10 +21,19 @@
 #include "io/debug/print.h"
 #include "io/midi/midi_device.h"
 #include "io/midi/midi_engine.h"
+#include "memory/general_memory_allocator.h"
+#include "scheduler_api.h"
 #include "util/chainload.h"
+#include <cstdio>
 
 #include "util/pack.h"
 
+static MIDICable* statsCable = nullptr;
+
+static void sendStatsLine(char const* line) {
+	Debug::sysexDebugPrint(*statsCable, line, true);
+}
+
 void Debug::sysexReceived(MIDICable& cable, uint8_t* data, int32_t len) {
 	if (len < 3) {
 		return;
@@ -53,6 +62,39 @@ void Debug::sysexReceived(MIDICable& cable, uint8_t* data, int32_t len) {
 #endif
 		break;
 
+	case 3: // Memory telemetry dump, answered as log messages. Third byte 1 resets the counters afterwards
+		statsCable = &cable;
+		GeneralMemoryAllocator::get().writeStats(sendStatsLine);
+		sendStatsLine("end memory stats");
+		if (data[2] == 1) {
+			GeneralMemoryAllocator::get().resetStats();
+		}
+		break;
+
+	case 4: // Task scheduler histograms and recent decisions, same as above
+		statsCable = &cable;
+		writeSchedulerStats(sendStatsLine);
+		sendStatsLine("end scheduler stats");
+		if (data[2] == 1) {
+			resetSchedulerStats();
+		}
+		break;
+
+	case 5: { // MIDI input queue counters, same as above
+		statsCable = &cable;
+		MIDIInputQueue::Stats const& stats = midiEngine.getInputQueueStats();
+		char line[96];
+		snprintf(line, sizeof(line), "midi input: queued %lu, coalesced %lu, dispatch batches %lu",
+		         static_cast<unsigned long>(stats.queued), static_cast<unsigned long>(stats.coalesced),
+		         static_cast<unsigned long>(stats.batches));
+		sendStatsLine(line);
+		sendStatsLine("end midi input stats");
+		if (data[2] == 1) {
+			midiEngine.resetInputQueueStats();
+		}
+		break;
+	}
+
 	default:
 		break;
 	}
@@ -92,7 +134,6 @@ void Debug::sysexDebugPrint(MIDICable& cable, const char* msg, bool nl) {
 #include "gui/l10n/l10n.h"
 #include "hid/display/oled.h"
 #include "hid/led/pad_leds.h"
-#include "memory/general_memory_allocator.h"
 #include "model/settings/runtime_feature_settings.h"
 
 static uint8_t* load_buf;
@@ -4,11 +4,103 @@
 #include "memory/memory_region.h"
 #include "memory/stealable.h"
 #include "processing/engines/audio_engine.h"
+#include <algorithm>
 #include <cstdint>
 
 extern bool skipConsistencyCheck;
 uint32_t currentTraversalNo = 0;
 
+// How many spaces to look at in each direction when measuring a run before just calling it long. Keeps queueing cheap
+// when a region is wall-to-wall stealables, where runs really are long anyway.
+constexpr int32_t kMaxRunWalkSteps = 16;
+constexpr uint32_t kRunTooLongToWalk = 0xFFFFFFFF;
+
+void CacheManager::QueueForReclamation(StealableQueue queue, Stealable* stealable) {
+	size_t q = util::to_underlying(queue);
+
+	/// Alternatively we could add to start of queue - logic is that a recently freed sample is unlikely
+	/// to be immediately needed again. This increases average and max voice counts, but has a problem with medium
+	/// memory pressure songs where it tends to prioritize earlier sounds in the song and makes it possible for
+	/// later songs to break in. This occurs since there's no mechanism to determine if a sample is going to be used
+	/// in the remainder of the song, so if there's not enough memory pressure for all stealable clusters to get
+	/// reclaimed the same few just get put on and off the list repeatedly
+	reclamation_queue_[q].addToEnd(stealable);
+
+	uint32_t* header = (uint32_t*)((uint32_t)stealable - 4);
+	uint32_t run = measureRun((uint32_t)stealable, *header & SPACE_SIZE_MASK);
+	longest_runs_[q] = std::max(longest_runs_[q], run);
+}
+
+// Walks the same headers and footers attemptToGrabNeighbouringMemory() would. Every Stealable counts, whether or not it
+// could be stolen right now, so the result is an upper bound. Region ends are marked allocated so the walk stops there.
+uint32_t CacheManager::measureRun(uint32_t address, uint32_t spaceSize) {
+	uint32_t run = spaceSize;
+
+	uint32_t* lookRight = (uint32_t*)(address + spaceSize + 4);
+	for (int32_t i = 0; (*lookRight & SPACE_TYPE_MASK) != SPACE_HEADER_ALLOCATED; i++) {
+		if (i == kMaxRunWalkSteps) {
+			return kRunTooLongToWalk;
+		}
+		uint32_t size = *lookRight & SPACE_SIZE_MASK;
+		run += size + 8;
+		lookRight = (uint32_t*)((uint32_t)lookRight + size + 8);
+	}
+
+	uint32_t* lookLeft = (uint32_t*)(address - 8);
+	for (int32_t i = 0; (*lookLeft & SPACE_TYPE_MASK) != SPACE_HEADER_ALLOCATED; i++) {
+		if (i == kMaxRunWalkSteps) {
+			return kRunTooLongToWalk;
+		}
+		uint32_t size = *lookLeft & SPACE_SIZE_MASK;
+		run += size + 8;
+		lookLeft = (uint32_t*)((uint32_t)lookLeft - size - 8);
+	}
+
+	return run;
+}
+
+int32_t CacheManager::getQueueIndex(Stealable* stealable) {
+	auto* list = static_cast<BidirectionalLinkedList*>(stealable->list);
+	if (list < reclamation_queue_.data() || list >= reclamation_queue_.data() + kNumStealableQueue) {
+		return -1;
+	}
+	return list - reclamation_queue_.data();
+}
+
+void CacheManager::noteSpaceFreed(uint32_t address, uint32_t spaceSize) {
+	// Usually there's no Stealable right next door, and then no run got any longer
+	uint32_t* lookLeft = (uint32_t*)(address - 8);
+	uint32_t* lookRight = (uint32_t*)(address + spaceSize + 4);
+	if ((*lookLeft & SPACE_TYPE_MASK) != SPACE_HEADER_STEALABLE
+	    && (*lookRight & SPACE_TYPE_MASK) != SPACE_HEADER_STEALABLE) {
+		return;
+	}
+
+	uint32_t run = measureRun(address, spaceSize);
+	if (run == kRunTooLongToWalk) {
+		// Stealables out past the walk might be in any queue
+		longest_runs_.fill(kRunTooLongToWalk);
+		return;
+	}
+
+	// measureRun() came back, so the whole run is within kMaxRunWalkSteps each side - raise the queue of every
+	// Stealable in it
+	for (int32_t lookingLeft = 0; lookingLeft < 2; lookingLeft++) {
+		uint32_t* look = lookingLeft ? lookLeft : lookRight;
+		while ((*look & SPACE_TYPE_MASK) != SPACE_HEADER_ALLOCATED) {
+			uint32_t size = *look & SPACE_SIZE_MASK;
+			if ((*look & SPACE_TYPE_MASK) == SPACE_HEADER_STEALABLE) {
+				uint32_t stealableAddress = lookingLeft ? (uint32_t)look - size : (uint32_t)(look + 1);
+				int32_t q = getQueueIndex((Stealable*)stealableAddress);
+				if (q >= 0) {
+					longest_runs_[q] = std::max(longest_runs_[q], run);
+				}
+			}
+			look = lookingLeft ? (uint32_t*)((uint32_t)look - size - 8) : (uint32_t*)((uint32_t)look + size + 8);
+		}
+	}
+}
+
 // Size 0 means don't care, just get any memory.
 uint32_t CacheManager::ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeeded, void* thingNotToStealFrom,
                                      int32_t* __restrict__ foundSpaceSize) {
@@ -31,6 +123,7 @@ uint32_t CacheManager::ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeed
 
 	bool found = false;
 	bool stolen = false;
+	auto stealQueue = StealableQueue{0};
 
 	// Go through each queue, one by one
 	for (size_t q = 0; q < kNumStealableQueue; q++) {
@@ -122,6 +215,7 @@ uint32_t CacheManager::ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeed
 			if (amountToExtend <= 0) {
 				// need to reset this since it's getting stolen
 				longestRunSeenInThisQueue = 0xFFFFFFFF;
+				stealQueue = queue;
 				found = true;
 				break;
 			}
@@ -167,7 +261,10 @@ uint32_t CacheManager::ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeed
 		currentTraversalNo++;
 	}
 
+	stats_.numReclaims++;
+
 	if (!(found || stolen)) {
+		stats_.numFailedReclaims++;
 #if TEST_GENERAL_MEMORY_ALLOCATION
 		skipConsistencyCheck = false;
 #endif
@@ -178,12 +275,14 @@ uint32_t CacheManager::ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeed
 	if (found && !stolen) {
 		// Warning - for perc cache Cluster, stealing one can cause it to want to allocate more memory for its list of
 		// zones
+		recordSteal(stealQueue, spaceSize);
 		stealable->steal("i007");
 		stealable->~Stealable();
 	}
 
 	// At this point we have either found or stolen to be true
 	*foundSpaceSize = spaceSize;
+	stats_.bytesReclaimed += spaceSize;
 #if TEST_GENERAL_MEMORY_ALLOCATION
 	skipConsistencyCheck = false;
 #endif
@@ -9,6 +9,16 @@
 
 class MemoryRegion;
 
+/// Steal telemetry, accumulated until CacheManager::resetStats()
+struct CacheManagerStats {
+	// By the queue the stolen Stealable was in - or, for neighbours stolen to make up a run, the one it belongs in
+	std::array<uint32_t, kNumStealableQueue> steals;
+	std::array<uint32_t, kNumStealableQueue> bytesStolen;
+	uint32_t numReclaims;
+	uint32_t numFailedReclaims;
+	uint64_t bytesReclaimed; // Total size of the spaces ReclaimMemory() handed back, including any neighbouring memory
+};
+
 class CacheManager {
 public:
 	CacheManager() = default;
@@ -20,27 +30,36 @@ public:
 	uint32_t& longest_runs(size_t idx) { return longest_runs_.at(idx); }
 
 	/// add a stealable to end of given queue
-	void QueueForReclamation(StealableQueue queue, Stealable* stealable) {
-		size_t q = util::to_underlying(queue);
+	void QueueForReclamation(StealableQueue queue, Stealable* stealable);
 
-		/// Alternatively we could add to start of queue - logic is that a recently freed sample is unlikely
-		/// to be immediately needed again. This increases average and max voice counts, but has a problem with medium
-		/// memory pressure songs where it tends to prioritize earlier sounds in the song and makes it possible for
-		/// later songs to break in. This occurs since there's no mechanism to determine if a sample is going to be used
-		/// in the remainder of the song, so if there's not enough memory pressure for all stealable clusters to get
-		/// reclaimed the same few just get put on and off the list repeatedly
-		reclamation_queue_[q].addToEnd(stealable);
-		longest_runs_[q] = 0xFFFFFFFF; // TODO: actually investigate neighbouring memory "run".
-	}
+	/// Called by the region once a space has been marked empty, as that may have joined up runs of stealable memory
+	void noteSpaceFreed(uint32_t address, uint32_t spaceSize);
+
+	/// Length of the run of empty and stealable spaces containing the given space, including headers between them,
+	/// i.e. the most ReclaimMemory() could make of it. 0xFFFFFFFF if the run was too long to walk.
+	static uint32_t measureRun(uint32_t address, uint32_t spaceSize);
 
 	uint32_t ReclaimMemory(MemoryRegion& region, int32_t totalSizeNeeded, void* thingNotToStealFrom,
 	                       int32_t* __restrict__ foundSpaceSize);
 
+	void recordSteal(StealableQueue queue, uint32_t size) {
+		size_t q = util::to_underlying(queue);
+		stats_.steals[q]++;
+		stats_.bytesStolen[q] += size;
+	}
+	[[nodiscard]] const CacheManagerStats& getStats() const { return stats_; }
+	void resetStats() { stats_ = {}; }
+
 private:
 	std::array<BidirectionalLinkedList, kNumStealableQueue> reclamation_queue_;
 
-	// Keeps track, semi-accurately, of biggest runs of memory that could be stolen. In a perfect world, we'd have a
-	// second index on stealableClusterQueues[q], for run length. Although even that wouldn't automatically reflect
-	// changes to run lengths as neighbouring memory is allocated.
-	std::array<uint32_t, kNumStealableQueue> longest_runs_;
+	// Upper bound, per queue, of the longest run of memory that could be stolen around any Stealable in it. Raised to
+	// the measured run whenever a Stealable is queued or memory is freed next to one, so a queue is only ever skipped
+	// when it really can't satisfy a request. Allocations only shorten runs, which we don't track - ReclaimMemory()
+	// lowers the bound again as it traverses a queue.
+	std::array<uint32_t, kNumStealableQueue> longest_runs_{};
+
+	int32_t getQueueIndex(Stealable* stealable);
+
+	CacheManagerStats stats_{};
 };
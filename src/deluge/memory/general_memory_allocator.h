@@ -19,6 +19,7 @@
 
 #include "definitions_cxx.hpp"
 #include "memory/memory_region.h"
+#include "memory/slab_allocator.h"
 
 #define MEMORY_REGION_STEALABLE 0
 #define MEMORY_REGION_INTERNAL 1
@@ -96,10 +97,20 @@ public:
 	void putStealableInQueue(Stealable* stealable, StealableQueue q);
 	void putStealableInAppropriateQueue(Stealable* stealable);
 
+	/// Writes fragmentation, steal and slab telemetry for every region, one line of text per call
+	void writeStats(void (*writeLine)(char const* line));
+	void resetStats();
+
 	MemoryRegion regions[NUM_MEMORY_REGIONS];
+	// Front ends for the two small regions, taking the allocations that fit a slab size class
+	SlabAllocator internalSlabs;
+	SlabAllocator externalSlabs;
 	// only used for managing stealables (audio files that we could deallocate and re load from sd later if needed)
 	CacheManager cacheManager;
 	bool lock;
+	// Set when something couldn't be had outside the stealable region. Whoever's holding RAM they could do without can
+	// check this, give it up, and clear it
+	bool ranShortOfMemory = false;
 
 	static GeneralMemoryAllocator& get() {
 		static GeneralMemoryAllocator generalMemoryAllocator;
@@ -108,6 +119,7 @@ public:
 
 private:
 	void checkEverythingOk(char const* errorString);
+	SlabAllocator* getSlabAllocator(void* address);
 };
 
 extern "C" {
@@ -21,8 +21,13 @@
 #include "memory/general_memory_allocator.h"
 #include "memory/stealable.h"
 #include "util/fixedpoint.h"
+#include <algorithm>
 #include <cstring>
 
+extern "C" {
+#include "RZA1/ostm/ostm.h"
+}
+
 #ifdef DO_AUDIO_LOG
 #include "processing/engines/audio_engine.h"
 #endif
@@ -121,6 +126,39 @@ void MemoryRegion::verifyMemoryNotFree(void* address, uint32_t spaceSize) {
 	}
 }
 
+const MemoryRegionStats& MemoryRegion::getStats() {
+	stats_.freeSpaceHistogram = {};
+	stats_.totalFree = 0;
+	stats_.numFreeSpaces = emptySpaces.getNumElements();
+	for (int32_t i = 0; i < stats_.numFreeSpaces; i++) {
+		auto* emptySpaceRecord = (EmptySpaceRecord*)emptySpaces.getElementAddress(i);
+		stats_.totalFree += emptySpaceRecord->length;
+		stats_.freeSpaceHistogram[getFreeSpaceSizeClass(emptySpaceRecord->length)]++;
+	}
+	// Records are sorted by length, so the last one is the longest
+	stats_.largestFreeRun =
+	    stats_.numFreeSpaces ? ((EmptySpaceRecord*)emptySpaces.getElementAddress(stats_.numFreeSpaces - 1))->length : 0;
+	return stats_;
+}
+
+void MemoryRegion::resetStats() {
+	stats_ = {};
+}
+
+int32_t MemoryRegion::getFreeSpaceSizeClass(uint32_t size) {
+	if (size < 64) {
+		return 0;
+	}
+	int32_t log2 = 31 - clz(size);
+	return std::min((log2 - 6) / 2 + 1, kNumFreeSpaceSizeClasses - 1);
+}
+
+// emptySpaces is binary searched, so the length of a search is the number of probes that takes
+inline void MemoryRegion::noteSearch() {
+	stats_.numSearches++;
+	stats_.totalSearchLength += 32 - clz(emptySpaces.getNumElements());
+}
+
 // Okay this is me being experimental and trying something you're not supposed to do - using static variables in place
 // of stack ones within a function. It seemed to give a slight speed up, but it's probably quite circumstantial, and I
 // wouldn't normally do this.
@@ -217,6 +255,7 @@ justInsertRecord:
 		EmptySpaceRecord newRecord;
 		newRecord.length = spaceSize;
 		newRecord.address = address;
+		noteSearch();
 		int32_t i = emptySpaces.searchMultiWordExact((uint32_t*)&newRecord);
 		if (i != -1) {
 			FREEZE_WITH_ERROR("M123");
@@ -233,6 +272,7 @@ justInsertRecord:
 	if (false) {
 
 goingToReplaceOldRecord:
+		noteSearch();
 		int32_t i = emptySpaces.searchMultiWordExact((uint32_t*)recordToMergeWith, &insertRangeBegin,
 		                                             biggerRecordSearchFromIndex);
 		if (i == -1) { // The record might not exist because there wasn't room to insert it when the empty space was
@@ -276,6 +316,10 @@ goingToReplaceOldRecord:
 	*header = headerData;
 	*footer = headerData;
 	emptySpaces.testSequentiality("M005");
+
+	if (cache_manager_) {
+		cache_manager_->noteSpaceFreed(address, spaceSize);
+	}
 }
 
 void* MemoryRegion::alloc(uint32_t requiredSize, bool makeStealable, void* thingNotToStealFrom) {
@@ -283,7 +327,7 @@ void* MemoryRegion::alloc(uint32_t requiredSize, bool makeStealable, void* thing
 	bool large = requiredSize > pivot_;
 	// set a minimum size	requiredSize = padSize(requiredSize);
 	int32_t allocatedSize;
-	uint32_t allocatedAddress;
+	uint32_t allocatedAddress = 0;
 	int32_t i;
 
 	if (!emptySpaces.getNumElements()) {
@@ -291,6 +335,7 @@ void* MemoryRegion::alloc(uint32_t requiredSize, bool makeStealable, void* thing
 	}
 
 	// Here we're doing a search just on one 32-bit word of the key (that's "length of empty space").
+	noteSearch();
 	i = emptySpaces.search(requiredSize, GREATER_OR_EQUAL);
 
 	// If found an empty space big enough...
@@ -383,6 +428,7 @@ noEmptySpace:
 			allocatedAddress = cache_manager_->ReclaimMemory(*this, requiredSize, thingNotToStealFrom, &allocatedSize);
 		}
 		if (!allocatedAddress) {
+			stats_.numFailedAllocations++;
 #if ALPHA_OR_BETA_VERSION
 			if (name) {
 				const uint32_t msgBufferLen = 32;
@@ -539,6 +585,9 @@ uint32_t MemoryRegion::extendRightAsMuchAsEasilyPossible(void* address) {
 		if (!stealable->mayBeStolen(nullptr)) {
 			goto finished;
 		}
+		if (cache_manager_) {
+			cache_manager_->recordSteal(stealable->getAppropriateQueue(), emptySpaceHereSizeWithoutHeaders + 8);
+		}
 		stealable->steal("E446");
 		stealable->~Stealable();
 	}
@@ -576,6 +625,18 @@ NeighbouringMemoryGrabAttemptResult MemoryRegion::attemptToGrabNeighbouringMemor
     void* originalSpaceAddress, int32_t originalSpaceSize, int32_t minAmountToExtend, int32_t idealAmountToExtend,
     void* thingNotToStealFrom, uint32_t markWithTraversalNo, bool originalSpaceNeedsStealing) {
 
+	// Accounts the time taken into stats_ whichever way we return
+	struct GrabTimer {
+		MemoryRegionStats& stats;
+		uint32_t startTime = getTimerValue(0);
+		~GrabTimer() {
+			uint32_t timeTaken = getTimerValue(0) - startTime;
+			stats.numNeighbourGrabs++;
+			stats.neighbourGrabTime += timeTaken;
+			stats.maxNeighbourGrabTime = std::max(stats.maxNeighbourGrabTime, timeTaken);
+		}
+	} grabTimer{stats_};
+
 	NeighbouringMemoryGrabAttemptResult toReturn;
 
 	toReturn.address = (uint32_t)originalSpaceAddress;
@@ -587,6 +648,10 @@ NeighbouringMemoryGrabAttemptResult MemoryRegion::attemptToGrabNeighbouringMemor
 	for (int32_t actuallyGrabbing = 0; actuallyGrabbing < 2; actuallyGrabbing++) {
 
 		if (actuallyGrabbing && originalSpaceNeedsStealing) {
+			if (cache_manager_) {
+				cache_manager_->recordSteal(((Stealable*)originalSpaceAddress)->getAppropriateQueue(),
+				                            originalSpaceSize);
+			}
 			((Stealable*)originalSpaceAddress)->steal("E417"); // Jensg still getting.
 			((Stealable*)originalSpaceAddress)->~Stealable();
 		}
@@ -678,6 +743,10 @@ tryNotStealingFirst:
 							                                                   + toReturn.amountsExtended[0]
 							                                                   + toReturn.amountsExtended[1]);
 
+							if (cache_manager_) {
+								cache_manager_->recordSteal(stealable->getAppropriateQueue(),
+								                            emptySpaceHereSizeWithoutHeaders + 8);
+							}
 							stealable->steal("E418"); // Jensg still getting.
 							stealable->~Stealable();
 						}
@@ -21,6 +21,7 @@
 #include "util/container/array/ordered_resizeable_array_with_multi_word_key.h"
 
 #include <util/exceptions.h>
+#include <array>
 
 struct EmptySpaceRecord {
 	uint32_t length;
@@ -32,6 +33,32 @@ struct NeighbouringMemoryGrabAttemptResult {
 	int32_t amountsExtended[2];
 	uint32_t longestRunFound; // Only valid if didn't return some space.
 };
+
+// Free spaces are bucketed by size in powers of 4, from below 64 bytes up to 256kB and over
+constexpr int32_t kNumFreeSpaceSizeClasses = 8;
+
+/// Fragmentation telemetry for one region. The live counters accumulate until resetStats(), the rest is a snapshot
+/// of emptySpaces taken by getStats().
+struct MemoryRegionStats {
+	// Snapshot
+	uint32_t largestFreeRun;
+	uint32_t totalFree;
+	uint32_t numFreeSpaces;
+	std::array<uint32_t, kNumFreeSpaceSizeClasses> freeSpaceHistogram;
+
+	// Live counters
+	uint32_t numSearches;
+	uint32_t totalSearchLength; // Probes of the (binary searched) emptySpaces array
+	uint32_t numFailedAllocations;
+	uint32_t numNeighbourGrabs;
+	uint32_t neighbourGrabTime;    // Ticks spent in attemptToGrabNeighbouringMemory()
+	uint32_t maxNeighbourGrabTime; // Ticks, longest single call
+
+	[[nodiscard]] float getAverageSearchLength() const {
+		return numSearches ? static_cast<float>(totalSearchLength) / static_cast<float>(numSearches) : 0;
+	}
+};
+
 #define SPACE_HEADER_EMPTY 0
 #define SPACE_HEADER_STEALABLE 0x40000000
 #define SPACE_HEADER_ALLOCATED 0x80000000
@@ -56,6 +83,11 @@ public:
 	void dealloc(void* address);
 	void verifyMemoryNotFree(void* address, uint32_t spaceSize);
 
+	/// Refreshes the free space snapshot and returns it along with the live counters
+	const MemoryRegionStats& getStats();
+	void resetStats();
+	static int32_t getFreeSpaceSizeClass(uint32_t size);
+
 	uint32_t start;
 	uint32_t end;
 
@@ -81,6 +113,8 @@ private:
 	size_t maxAlign_ = max_align_big;
 	// not size_t, it needs to  be  compared to results of pointer subtractions that can be negative
 	ptrdiff_t minAlign_ = min_align_big;
+	MemoryRegionStats stats_{};
+	void noteSearch();
 	void markSpaceAsEmpty(uint32_t spaceStart, uint32_t spaceSize, bool mayLookLeft = true, bool mayLookRight = true);
 	NeighbouringMemoryGrabAttemptResult
 	attemptToGrabNeighbouringMemory(void* originalSpaceAddress, int32_t originalSpaceSize, int32_t minAmountToExtend,
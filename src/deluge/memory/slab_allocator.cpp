@@ -0,0 +1,153 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "memory/slab_allocator.h"
+#include "definitions.h"
+
+void SlabAllocator::setup(uint32_t arenaStart, uint32_t arenaEnd) {
+	// Leave room for the page table at the start, then line pages up so every slot is aligned to its own size
+	uint32_t arenaSize = arenaEnd - arenaStart;
+	uint32_t maxNumPages = arenaSize / (kPageSize + sizeof(Page));
+	if (maxNumPages > kNoPage) {
+		maxNumPages = kNoPage;
+	}
+
+	pages_ = (Page*)arenaStart;
+	pagesStart_ = (arenaStart + maxNumPages * sizeof(Page) + kMaxSlotSize - 1) & ~(kMaxSlotSize - 1);
+	numPages_ = (arenaEnd > pagesStart_) ? (arenaEnd - pagesStart_) / kPageSize : 0;
+	pagesEnd_ = pagesStart_ + numPages_ * kPageSize;
+
+	// All pages start off free, in address order
+	freePages_ = kNoPage;
+	for (int32_t p = numPages_ - 1; p >= 0; p--) {
+		pages_[p] = Page{.next = freePages_, .prev = kNoPage};
+		freePages_ = p;
+	}
+	numFreePages_ = numPages_;
+
+	partialPages_.fill(kNoPage);
+	stats_ = {};
+}
+
+void* SlabAllocator::alloc(uint32_t requiredSize) {
+	int32_t c = getSizeClass(requiredSize);
+	if (c < 0) {
+		return nullptr;
+	}
+	SizeClassStats& stats = stats_[c];
+
+	uint16_t p = partialPages_[c];
+	if (p == kNoPage) {
+		// Grab a fresh page for this class
+		p = freePages_;
+		if (p == kNoPage) {
+			stats.numFailedAllocations++;
+			return nullptr;
+		}
+		freePages_ = pages_[p].next;
+		numFreePages_--;
+		pages_[p] = Page{.next = kNoPage, .prev = kNoPage, .sizeClass = (uint8_t)c};
+		linkPage(partialPages_[c], p);
+		stats.numPages++;
+	}
+
+	Page& page = pages_[p];
+	uint32_t slot;
+	if (page.freeList != 0) {
+		slot = page.freeList;
+		page.freeList = *(uint32_t*)slot;
+	}
+	else {
+		slot = getPageAddress(p) + page.numSlotsCarved * kSlotSizes[c];
+		page.numSlotsCarved++;
+	}
+	page.numSlotsUsed++;
+
+	if (page.numSlotsUsed == kPageSize / kSlotSizes[c]) {
+		unlinkPage(partialPages_[c], p);
+	}
+
+	stats.numSlotsUsed++;
+	if (stats.numSlotsUsed > stats.maxSlotsUsed) {
+		stats.maxSlotsUsed = stats.numSlotsUsed;
+	}
+	return (void*)slot;
+}
+
+void SlabAllocator::dealloc(void* address) {
+	uint16_t p = getPageIndex(address);
+	Page& page = pages_[p];
+	int32_t c = page.sizeClass;
+
+#if ALPHA_OR_BETA_VERSION
+	if (page.numSlotsUsed == 0 || ((uint32_t)address - getPageAddress(p)) % kSlotSizes[c]) {
+		FREEZE_WITH_ERROR("M006");
+	}
+#endif
+
+	// A full page isn't on its class's list, so it needs to go back on
+	if (page.numSlotsUsed == kPageSize / kSlotSizes[c]) {
+		linkPage(partialPages_[c], p);
+	}
+
+	*(uint32_t*)address = page.freeList;
+	page.freeList = (uint32_t)address;
+	page.numSlotsUsed--;
+	stats_[c].numSlotsUsed--;
+
+	// And an empty one can go to whichever class needs it next
+	if (page.numSlotsUsed == 0) {
+		unlinkPage(partialPages_[c], p);
+		page.next = freePages_;
+		freePages_ = p;
+		numFreePages_++;
+		stats_[c].numPages--;
+	}
+}
+
+float SlabAllocator::getOccupancy(int32_t sizeClass) const {
+	const SizeClassStats& stats = stats_[sizeClass];
+	if (stats.numPages == 0) {
+		return 1;
+	}
+	return (float)stats.numSlotsUsed / (float)(stats.numPages * (kPageSize / kSlotSizes[sizeClass]));
+}
+
+void SlabAllocator::linkPage(uint16_t& head, uint16_t pageIndex) {
+	Page& page = pages_[pageIndex];
+	page.prev = kNoPage;
+	page.next = head;
+	if (head != kNoPage) {
+		pages_[head].prev = pageIndex;
+	}
+	head = pageIndex;
+}
+
+void SlabAllocator::unlinkPage(uint16_t& head, uint16_t pageIndex) {
+	Page& page = pages_[pageIndex];
+	if (page.prev != kNoPage) {
+		pages_[page.prev].next = page.next;
+	}
+	else {
+		head = page.next;
+	}
+	if (page.next != kNoPage) {
+		pages_[page.next].prev = page.prev;
+	}
+	page.next = kNoPage;
+	page.prev = kNoPage;
+}
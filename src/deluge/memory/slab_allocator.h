@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// Size-classed slabs for small allocations. A contiguous arena is split into fixed-size pages. Each page in use holds
+/// slots of one size class. Allocating and freeing are O(1) and write no headers, because a slot's class comes from
+/// its page.
+///
+/// Pages with free slots are kept on a per-class list. A page which empties completely goes back to the arena for any
+/// class to use.
+class SlabAllocator {
+public:
+	static constexpr std::array<uint32_t, 4> kSlotSizes{16, 32, 64, 128};
+	static constexpr int32_t kNumSizeClasses = kSlotSizes.size();
+	static constexpr uint32_t kMaxSlotSize = kSlotSizes.back();
+	static constexpr uint32_t kPageSize = 1024;
+
+	struct SizeClassStats {
+		uint32_t numPages;
+		uint32_t numSlotsUsed;
+		uint32_t maxSlotsUsed;
+		/// Allocations of this class that found no free slot and no free page
+		uint32_t numFailedAllocations;
+	};
+
+	SlabAllocator() = default;
+	SlabAllocator(const SlabAllocator&) = delete;
+	SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+	/// The page table is kept at the start of the arena, the rest is pages
+	void setup(uint32_t arenaStart, uint32_t arenaEnd);
+
+	/// Returns nullptr if the size is too big for any class, or that class is full and there are no free pages
+	void* alloc(uint32_t requiredSize);
+	void dealloc(void* address);
+
+	[[nodiscard]] bool owns(void* address) const {
+		auto value = (uint32_t)address;
+		return value >= pagesStart_ && value < pagesEnd_;
+	}
+	[[nodiscard]] uint32_t getAllocatedSize(void* address) const {
+		return kSlotSizes[pages_[getPageIndex(address)].sizeClass];
+	}
+
+	[[nodiscard]] const SizeClassStats& getStats(int32_t sizeClass) const { return stats_[sizeClass]; }
+	/// Used slots' share of the slots in pages given to that class. 1 means no slack at all
+	[[nodiscard]] float getOccupancy(int32_t sizeClass) const;
+	[[nodiscard]] uint32_t getNumPages() const { return numPages_; }
+	[[nodiscard]] uint32_t getNumFreePages() const { return numFreePages_; }
+
+	static constexpr int32_t getSizeClass(uint32_t size) {
+		for (int32_t c = 0; c < kNumSizeClasses; c++) {
+			if (size <= kSlotSizes[c]) {
+				return c;
+			}
+		}
+		return -1;
+	}
+
+private:
+	static constexpr uint16_t kNoPage = 0xFFFF;
+
+	struct Page {
+		uint16_t next;
+		uint16_t prev;
+		uint16_t numSlotsUsed;
+		/// Slots past this have never been handed out, so aren't on the free list yet
+		uint16_t numSlotsCarved;
+		uint32_t freeList; // Address of first free slot, each of which holds the address of the next. 0 is none.
+		uint8_t sizeClass;
+	};
+
+	[[nodiscard]] uint32_t getPageIndex(void* address) const {
+		return ((uint32_t)address - pagesStart_) / kPageSize;
+	}
+	[[nodiscard]] uint32_t getPageAddress(uint32_t pageIndex) const { return pagesStart_ + pageIndex * kPageSize; }
+	void linkPage(uint16_t& head, uint16_t pageIndex);
+	void unlinkPage(uint16_t& head, uint16_t pageIndex);
+
+	Page* pages_ = nullptr;
+	uint32_t pagesStart_ = 0;
+	uint32_t pagesEnd_ = 0;
+	uint32_t numPages_ = 0;
+	uint32_t numFreePages_ = 0;
+	uint16_t freePages_ = kNoPage;
+	std::array<uint16_t, kNumSizeClasses> partialPages_{};
+	std::array<SizeClassStats, kNumSizeClasses> stats_{};
+};
@@ -213,6 +213,7 @@ bool Clip::isActiveOnOutput() {
 // Note: it's now the caller's job to increment currentPos before calling this! But we check here whether it's looped
 // and needs setting back to "0". We may change the TimelineCounter in the modelStack if new Clip got created.
 void Clip::processCurrentPos(ModelStackWithTimelineCounter* modelStack, uint32_t ticksSinceLast) {
+	eventSchedule.processed(playbackHandler.lastSwungTickActioned);
 
 	// Firstly, a bit of stuff that has to be dealt with ideally before calling posReachedEnd(), and definitely before
 	// we think about pingponging while in reverse. The consequence of not doing this is only apparent in one special
@@ -627,6 +628,7 @@ void Clip::getActiveModControllable(ModelStackWithTimelineCounter* modelStack) {
 }
 
 void Clip::expectEvent() {
+	eventSchedule.invalidate();
 	playbackHandler.expectEvent();
 }
 
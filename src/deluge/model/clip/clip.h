@@ -23,6 +23,7 @@
 #include "gui/waveform/waveform_render_data.h"
 #include "io/midi/learned_midi.h"
 #include "model/clip/clip.h"
+#include "model/clip/clip_event_schedule.h"
 #include "model/sample/sample_controls.h"
 #include "model/sample/sample_holder_for_clip.h"
 #include "model/sample/sample_playback_guide.h"
@@ -203,6 +204,8 @@ public:
 	int64_t fillEventAtTickCount;
 	bool overdubsShouldCloneOutput;
 
+	ClipEventSchedule eventSchedule; // When Session::doTickForward() next needs to process this Clip
+
 	// START ~ new Automation Clip View Variables
 	bool onAutomationClipView; // new to save the view that you are currently in
 	                           //(e.g. if you leave clip and want to come back where you left off)
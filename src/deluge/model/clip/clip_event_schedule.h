@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/// Keeps track of when Session::doTickForward() next needs to process a Clip, so that a sparse one can be left alone
+/// until then. Times are swung ticks, as in PlaybackHandler::lastSwungTickActioned.
+///
+/// What's worked out only holds while nothing else has processed the Clip since, and nothing has invalidated it - as
+/// Clip::expectEvent() does whenever an edit might have brought an event sooner.
+class ClipEventSchedule {
+public:
+	/// Call whenever the Clip is processed, from anywhere
+	void processed(int64_t now) { lastProcessed = now; }
+
+	/// Call when the Clip might now have an event sooner than was worked out
+	void invalidate() { workedOutAt = kNotWorkedOut; }
+
+	bool isWorkedOut() const { return workedOutAt == lastProcessed; }
+
+	/// Only meaningful if isWorkedOut(). 0 or less if the Clip is due now
+	int64_t ticksTilDue(int64_t now) const { return nextEventDue - now; }
+
+	/// How far the Clip has come since it was last processed, for its ParamManager to catch up on
+	int32_t ticksSinceProcessed(int64_t now) const { return (int32_t)(now - lastProcessed); }
+
+	/// Call just before processing the Clip at now
+	void beginWorkingOut(int64_t now) { workedOutAt = now; }
+
+	/// Call just after, with the ticks til the Clip's own next event as processing left them
+	void workedOut(int64_t now, int32_t ticksTilNextEvent) {
+		if (ticksTilNextEvent == 2147483647) {
+			invalidate(); // Processing got cut short, so it's not known - have it processed every tick again
+		}
+		else {
+			nextEventDue = now + ticksTilNextEvent;
+		}
+	}
+
+private:
+	static constexpr int64_t kNotWorkedOut = -2; // Which lastProcessed never is, even before the Clip's first processed
+
+	int64_t lastProcessed{-1};
+	int64_t nextEventDue{0};
+	int64_t workedOutAt{kNotWorkedOut};
+};
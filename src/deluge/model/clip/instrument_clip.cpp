@@ -49,6 +49,7 @@
 #include "processing/engines/cv_engine.h"
 #include "processing/sound/sound_instrument.h"
 #include "storage/storage_manager.h"
+#include "util/container/tag_table.h"
 #include "util/firmware_version.h"
 #include "util/try.h"
 #include <cmath>
@@ -710,6 +711,7 @@ void InstrumentClip::processCurrentPos(ModelStackWithTimelineCounter* modelStack
 #endif
 			ticksTilNextNoteRowEvent = loopLength - lastProcessedPos;
 		}
+		int32_t ticksTilLoopPoint = ticksTilNextNoteRowEvent;
 
 		static PendingNoteOnList pendingNoteOnList; // Making this static, which it really should have always been,
 		                                            // actually didn't help max stack usage at all somehow...
@@ -718,17 +720,34 @@ void InstrumentClip::processCurrentPos(ModelStackWithTimelineCounter* modelStack
 		for (int32_t i = 0; i < noteRows.getNumElements(); i++) {
 			NoteRow* thisNoteRow = noteRows.getElement(i);
 
+			// Big kits mostly have nothing happening in most of their NoteRows at any one time, so leave those until
+			// their own next event. Independent play positions get moved along by incrementPos() as the Clip goes, so
+			// those always get processed
+			if (!allNoteRowsDue && !thisNoteRow->hasIndependentPlayPos()
+			    && thisNoteRow->ticksTilProcessingDue > noteRowsNumTicksBehindClip) {
+				thisNoteRow->ticksTilProcessingDue -= noteRowsNumTicksBehindClip;
+				thisNoteRow->ticksSkippedSinceProcessed += noteRowsNumTicksBehindClip;
+				if (thisNoteRow->ticksTilProcessingDue < ticksTilNextNoteRowEvent) {
+					ticksTilNextNoteRowEvent = thisNoteRow->ticksTilProcessingDue;
+				}
+				continue;
+			}
+
 			ModelStackWithNoteRow* modelStackWithNoteRow =
 			    modelStack->addNoteRow(getNoteRowId(thisNoteRow, i), thisNoteRow);
 
-			int32_t noteRowTicksTilNextEvent =
-			    thisNoteRow->processCurrentPos(modelStackWithNoteRow, noteRowsNumTicksBehindClip, &pendingNoteOnList);
+			int32_t noteRowTicksTilNextEvent = thisNoteRow->processCurrentPos(
+			    modelStackWithNoteRow, noteRowsNumTicksBehindClip + thisNoteRow->ticksSkippedSinceProcessed,
+			    &pendingNoteOnList);
+			thisNoteRow->ticksTilProcessingDue = noteRowTicksTilNextEvent;
+			thisNoteRow->ticksSkippedSinceProcessed = 0;
 			if (noteRowTicksTilNextEvent < ticksTilNextNoteRowEvent) {
 				ticksTilNextNoteRowEvent = noteRowTicksTilNextEvent;
 			}
 		}
 
 		noteRowsNumTicksBehindClip = 0;
+		allNoteRowsDue = (ticksTilNextNoteRowEvent >= ticksTilLoopPoint);
 
 		// Count up how many of each probability there are
 		uint8_t probabilityCount[kNumProbabilityValues];
@@ -2427,6 +2446,18 @@ void InstrumentClip::writeDataToFile(Serializer& writer, Song* song) {
 	}
 }
 
+// Every tag InstrumentClip::readFromFile() handles itself, so it doesn't need a strcmp() for each one
+constexpr auto instrumentClipTags = deluge::makeTagTable({
+    "clipName", "inKeyMode", "instrumentPresetSlot", "instrumentPresetSubSlot", "instrumentPresetName",
+    "instrumentPresetFolder", "midiChannel", "midiChannelSuffix", "cvChannel", "midiBank", "midiSub", "midiPGM",
+    "yScroll", "keyboardLayout", "yScrollKeyboard", "keyboardRowInterval", "drumsScrollOffset", "drumsZoomLevel",
+    "inKeyScrollOffset", "inKeyRowInterval", "crossScreenEditLevel", "onKeyboardScreen",
+    "onAutomationInstrumentClipView", "lastSelectedParamID", "lastSelectedParamKind", "lastSelectedParamShortcutX",
+    "lastSelectedParamShortcutY", "lastSelectedParamArrayPosition", "lastSelectedInstrumentType",
+    "lastSelectedPatchSource", "affectEntire", "soundMidiCommand", "modKnobs", "arpeggiator", "instrument", "sound",
+    "synth", "kit", "soundParams", "kitParams", "midiParams", "noteRows", "pitchBend", "yExpression", "channelPressure",
+    "expressionData", "bendRange", "bendRangeMPE", "columnControls"});
+
 Error InstrumentClip::readFromFile(Deserializer& reader, Song* song) {
 
 	Error error;
@@ -2465,22 +2496,27 @@ someError:
 
 		int32_t temp;
 
-		if (!strcmp(tagName, "clipName")) {
+		int32_t tag = instrumentClipTags.find(tagName);
+		switch (tag) {
+		case instrumentClipTags["clipName"]: {
 			reader.readTagOrAttributeValueString(&name);
+			break;
 		}
-		else if (!strcmp(tagName, "inKeyMode")) {
+		case instrumentClipTags["inKeyMode"]: {
 			inScaleMode = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "instrumentPresetSlot")) {
+		case instrumentClipTags["instrumentPresetSlot"]: {
 			int32_t slotHere = reader.readTagOrAttributeValueInt();
 			String slotChars;
 			slotChars.setInt(slotHere, 3);
 			slotChars.concatenate(&instrumentPresetName);
 			instrumentPresetName.set(&slotChars);
+			break;
 		}
 
-		else if (!strcmp(tagName, "instrumentPresetSubSlot")) {
+		case instrumentClipTags["instrumentPresetSubSlot"]: {
 			int32_t subSlotHere = reader.readTagOrAttributeValueInt();
 			if (subSlotHere >= 0 && subSlotHere < 26) {
 				char buffer[2];
@@ -2488,129 +2524,158 @@ someError:
 				buffer[1] = 0;
 				instrumentPresetName.concatenate(buffer);
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "instrumentPresetName")) {
+		case instrumentClipTags["instrumentPresetName"]: {
 			reader.readTagOrAttributeValueString(&instrumentPresetName);
+			break;
 		}
 
-		else if (!strcmp(tagName, "instrumentPresetFolder")) {
+		case instrumentClipTags["instrumentPresetFolder"]: {
 			reader.readTagOrAttributeValueString(&instrumentPresetDirPath);
 			dirPathHasBeenSpecified = true;
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiChannel")) {
+		case instrumentClipTags["midiChannel"]: {
 			outputTypeWhileLoading = OutputType::MIDI_OUT;
 
 			// if (!instrument) instrument = reader.createNewNonAudioInstrument(OutputType::MIDI_OUT, 0, -1);
 			instrumentPresetSlot = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiChannelSuffix")) {
+		case instrumentClipTags["midiChannelSuffix"]: {
 			instrumentPresetSubSlot = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "cvChannel")) {
+		case instrumentClipTags["cvChannel"]: {
 			outputTypeWhileLoading = OutputType::CV;
 
 			// if (!instrument) instrument = reader.createNewNonAudioInstrument(OutputType::CV, 0, -1);
 			instrumentPresetSlot = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiBank")) {
+		case instrumentClipTags["midiBank"]: {
 			midiBank = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiSub")) {
+		case instrumentClipTags["midiSub"]: {
 			midiSub = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiPGM")) {
+		case instrumentClipTags["midiPGM"]: {
 			midiPGM = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "yScroll")) {
+		case instrumentClipTags["yScroll"]: {
 			yScroll = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "keyboardLayout")) {
+		case instrumentClipTags["keyboardLayout"]: {
 			keyboardState.currentLayout = (KeyboardLayoutType)reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "yScrollKeyboard")) {
+		case instrumentClipTags["yScrollKeyboard"]: {
 			keyboardState.isomorphic.scrollOffset = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "keyboardRowInterval")) {
+		case instrumentClipTags["keyboardRowInterval"]: {
 			keyboardState.isomorphic.rowInterval = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "drumsScrollOffset")) {
+		case instrumentClipTags["drumsScrollOffset"]: {
 			keyboardState.drums.scroll_offset = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "drumsZoomLevel")) {
+		case instrumentClipTags["drumsZoomLevel"]: {
 			keyboardState.drums.zoom_level = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "inKeyScrollOffset")) {
+		case instrumentClipTags["inKeyScrollOffset"]: {
 			keyboardState.inKey.scrollOffset = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "inKeyRowInterval")) {
+		case instrumentClipTags["inKeyRowInterval"]: {
 			keyboardState.inKey.rowInterval = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "crossScreenEditLevel")) {
+		case instrumentClipTags["crossScreenEditLevel"]: {
 			wrapEditLevel = reader.readTagOrAttributeValueInt();
 			wrapEditing = true;
+			break;
 		}
 
-		else if (!strcmp(tagName, "onKeyboardScreen")) {
+		case instrumentClipTags["onKeyboardScreen"]: {
 			onKeyboardScreen = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "onAutomationInstrumentClipView")) {
+		case instrumentClipTags["onAutomationInstrumentClipView"]: {
 			onAutomationClipView = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedParamID")) {
+		case instrumentClipTags["lastSelectedParamID"]: {
 			lastSelectedParamID = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedParamKind")) {
+		case instrumentClipTags["lastSelectedParamKind"]: {
 			lastSelectedParamKind = static_cast<params::Kind>(reader.readTagOrAttributeValueInt());
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedParamShortcutX")) {
+		case instrumentClipTags["lastSelectedParamShortcutX"]: {
 			lastSelectedParamShortcutX = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedParamShortcutY")) {
+		case instrumentClipTags["lastSelectedParamShortcutY"]: {
 			lastSelectedParamShortcutY = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedParamArrayPosition")) {
+		case instrumentClipTags["lastSelectedParamArrayPosition"]: {
 			lastSelectedParamArrayPosition = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedInstrumentType")) {
+		case instrumentClipTags["lastSelectedInstrumentType"]: {
 			lastSelectedOutputType = static_cast<OutputType>(reader.readTagOrAttributeValueInt());
+			break;
 		}
 
-		else if (!strcmp(tagName, "lastSelectedPatchSource")) {
+		case instrumentClipTags["lastSelectedPatchSource"]: {
 			lastSelectedPatchSource = static_cast<PatchSource>(reader.readTagOrAttributeValueInt());
+			break;
 		}
 
-		else if (!strcmp(tagName, "affectEntire")) {
+		case instrumentClipTags["affectEntire"]: {
 			affectEntire = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "soundMidiCommand")) { // Only for pre V2.0 song files
+		case instrumentClipTags["soundMidiCommand"]: { // Only for pre V2.0 song files
 			soundMidiCommand.readChannelFromFile(reader);
+			break;
 		}
 
-		else if (!strcmp(tagName, "modKnobs")) { // Pre V2.0 only - for compatibility
+		case instrumentClipTags["modKnobs"]: { // Pre V2.0 only - for compatibility
 
 			outputTypeWhileLoading = OutputType::MIDI_OUT;
 
@@ -2639,9 +2704,10 @@ someError:
 			if (loopLength) {
 				paramManager.getMIDIParamCollection()->makeInterpolatedCCsGoodAgain(loopLength);
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "arpeggiator")) {
+		case instrumentClipTags["arpeggiator"]: {
 			reader.match('{');
 			while (*(tagName = reader.readNextTagOrAttributeName())) {
 				bool readAndExited = arpSettings.readCommonTagsFromFile(reader, tagName, nullptr);
@@ -2655,11 +2721,12 @@ someError:
 				}
 			}
 			reader.match('}'); // End arpeggiator value object.
+			break;
 		}
 
 		// For song files from before V2.0, where Instruments were stored within the Clip.
 		// Loading Instrument from another Clip.
-		else if (!strcmp(tagName, "instrument")) {
+		case instrumentClipTags["instrument"]: {
 			reader.match('{');
 			if (*(tagName = reader.readNextTagOrAttributeName())) {
 				if (!strcmp(tagName, "referToTrackId")) {
@@ -2685,10 +2752,12 @@ someError:
 					reader.exitTag("referToTrackId");
 				}
 			}
+			break;
 		}
 
 		// For song files from before V2.0, where Instruments were stored within the Clip
-		else if (!strcmp(tagName, "sound") || !strcmp(tagName, "synth")) {
+		case instrumentClipTags["sound"]:
+		case instrumentClipTags["synth"]: {
 			if (!output) {
 				{
 					void* instrumentMemory = GeneralMemoryAllocator::get().allocMaxSpeed(sizeof(SoundInstrument));
@@ -2719,10 +2788,11 @@ loadInstrument:
 				// Add the Instrument to the Song
 				song->addOutput(output);
 			}
+			break;
 		}
 
 		// For song files from before V2.0, where Instruments were stored within the Clip
-		else if (!strcmp(tagName, "kit")) {
+		case instrumentClipTags["kit"]: {
 			if (!output) {
 				void* instrumentMemory = GeneralMemoryAllocator::get().allocMaxSpeed(sizeof(Kit));
 				if (!instrumentMemory) {
@@ -2738,9 +2808,10 @@ loadInstrument:
 				output = kit;
 				goto loadInstrument;
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "soundParams")) {
+		case instrumentClipTags["soundParams"]: {
 			outputTypeWhileLoading = OutputType::SYNTH;
 
 			// Normal case - load in brand new ParamManager
@@ -2768,9 +2839,10 @@ createNewParamManager:
 				}
 			}
 			Sound::readParamsFromFile(reader, &paramManager, readAutomationUpToPos);
+			break;
 		}
 
-		else if (!strcmp(tagName, "kitParams")) {
+		case instrumentClipTags["kitParams"]: {
 			outputTypeWhileLoading = OutputType::KIT;
 			error = paramManager.setupUnpatched();
 			if (error != Error::NONE) {
@@ -2781,9 +2853,10 @@ createNewParamManager:
 			reader.match('{');
 			GlobalEffectableForClip::readParamsFromFile(reader, &paramManager, readAutomationUpToPos);
 			reader.match('}');
+			break;
 		}
 
-		else if (!strcmp(tagName, "midiParams")) {
+		case instrumentClipTags["midiParams"]: {
 			outputTypeWhileLoading = OutputType::MIDI_OUT;
 			error = paramManager.setupMIDI();
 			if (error != Error::NONE) {
@@ -2794,9 +2867,10 @@ createNewParamManager:
 			if (error != Error::NONE) {
 				goto someError;
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "noteRows")) {
+		case instrumentClipTags["noteRows"]: {
 			reader.match('[');
 			int32_t minY = -32768;
 			while (reader.match('{') && *(tagName = reader.readNextTagOrAttributeName())) {
@@ -2814,10 +2888,11 @@ createNewParamManager:
 				reader.exitTag(nullptr, true); // leave box.
 			}
 			reader.match(']');
+			break;
 		}
 
 		// These are the expression params for MPE
-		else if (!strcmp(tagName, "pitchBend")) {
+		case instrumentClipTags["pitchBend"]: {
 			temp = 0;
 doReadExpressionParam:
 			paramManager.ensureExpressionParamSetExists();
@@ -2826,45 +2901,51 @@ doReadExpressionParam:
 			if (expressionParams) {
 				expressionParams->readParam(reader, summary, temp, readAutomationUpToPos);
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "yExpression")) {
+		case instrumentClipTags["yExpression"]: {
 			temp = 1;
 			goto doReadExpressionParam;
 		}
 
-		else if (!strcmp(tagName, "channelPressure")) {
+		case instrumentClipTags["channelPressure"]: {
 			temp = 2;
 			goto doReadExpressionParam;
 		} // -----------------------------------------------------------------------------------
 
-		else if (!strcmp(tagName, "expressionData")) {
+		case instrumentClipTags["expressionData"]: {
 			paramManager.ensureExpressionParamSetExists();
 			ParamCollectionSummary* summary = paramManager.getExpressionParamSetSummary();
 			ExpressionParamSet* expressionParams = (ExpressionParamSet*)summary->paramCollection;
 			if (expressionParams) {
 				expressionParams->readFromFile(reader, summary, readAutomationUpToPos);
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "bendRange")) {
+		case instrumentClipTags["bendRange"]: {
 			temp = BEND_RANGE_MAIN;
 doReadBendRange:
 			ExpressionParamSet* expressionParams = paramManager.getOrCreateExpressionParamSet();
 			if (expressionParams) {
 				expressionParams->bendRanges[temp] = reader.readTagOrAttributeValueInt();
 			}
+			break;
 		}
 
-		else if (!strcmp(tagName, "bendRangeMPE")) {
+		case instrumentClipTags["bendRangeMPE"]: {
 			temp = BEND_RANGE_FINGER_LEVEL;
 			goto doReadBendRange;
 		}
-		else if (!strcmp(tagName, "columnControls")) {
+		case instrumentClipTags["columnControls"]: {
 			keyboardState.columnControl.readFromFile(reader);
+			break;
 		}
-		else {
+		default: {
 			readTagFromFile(reader, tagName, song, &readAutomationUpToPos);
+			break;
+		}
 		}
 
 		reader.exitTag();
@@ -4358,6 +4439,7 @@ returnNull:
 
 void InstrumentClip::expectEvent() {
 	ticksTilNextNoteRowEvent = 0;
+	allNoteRowsDue = true;
 	Clip::expectEvent();
 }
 
@@ -112,6 +112,10 @@ public:
 
 	int32_t ticksTilNextNoteRowEvent{};
 	int32_t noteRowsNumTicksBehindClip{};
+	/// Whether the next processCurrentPos() should process every NoteRow, rather than only those with an event due -
+	/// after expectEvent() (which anything changing what a NoteRow will do next calls), or at the loop point, which
+	/// NoteRows without an independent play position rely on the Clip to come back for
+	bool allNoteRowsDue{true};
 
 	LearnedMIDI soundMidiCommand; // This is now handled by the Instrument, but for loading old songs, we need to
 	                              // capture and store this
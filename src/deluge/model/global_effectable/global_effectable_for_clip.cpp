@@ -24,6 +24,7 @@
 #include "model/action/action.h"
 #include "model/action/action_logger.h"
 #include "processing/engines/audio_engine.h"
+#include "processing/engines/render_breakdown.h"
 #include <limits>
 #include <string.h>
 // #include <algorithm>
@@ -91,6 +92,7 @@ GlobalEffectableForClip::GlobalEffectableForClip() {
 	int32_t sidechainVolumeParam = unpatchedParams->getValue(params::UNPATCHED_SIDECHAIN_VOLUME);
 	int32_t postReverbVolume = paramNeutralValues[params::GLOBAL_VOLUME_POST_REVERB_SEND];
 	if (sidechainVolumeParam != std::numeric_limits<q31_t>::min()) {
+		TIME_RENDER_STAGE(SIDECHAIN);
 		if (sideChainHitPending != 0) {
 			sidechain.registerHit(sideChainHitPending);
 		}
@@ -143,6 +145,7 @@ GlobalEffectableForClip::GlobalEffectableForClip() {
 	                           pan, true);
 
 	if (compThreshold > 0) {
+		TIME_RENDER_STAGE(COMPRESSOR);
 		compressor.renderVolNeutral(global_effectable_audio, volumePostFX);
 	}
 	else {
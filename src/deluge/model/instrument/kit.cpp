@@ -35,6 +35,7 @@
 #include "model/drum/non_audio_drum.h"
 #include "model/note/note_row.h"
 #include "model/song/song.h"
+#include "modulation/midi/learned_cc_index.h"
 #include "modulation/params/param_set.h"
 #include "modulation/patch/patch_cable_set.h"
 #include "playback/mode/playback_mode.h"
@@ -422,6 +423,7 @@ void Kit::addDrum(Drum* newDrum) {
 	*prevPointer = newDrum;
 
 	newDrum->kit = this;
+	LearnedCCIndex::invalidate();
 }
 
 void Kit::removeDrum(Drum* drum) {
@@ -435,6 +437,7 @@ void Kit::removeDrumFromLinkedList(Drum* drum) {
 	while (*prevPointer) {
 		if (*prevPointer == drum) {
 			*prevPointer = drum->next;
+			LearnedCCIndex::invalidate();
 			return;
 		}
 		prevPointer = &((*prevPointer)->next);
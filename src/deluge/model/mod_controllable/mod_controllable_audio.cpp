@@ -36,6 +36,7 @@
 #include "model/clip/instrument_clip.h"
 #include "model/note/note_row.h"
 #include "model/song/song.h"
+#include "modulation/midi/learned_cc_index.h"
 #include "modulation/params/param_set.h"
 #include "processing/engines/audio_engine.h"
 #include "processing/sound/sound.h"
@@ -67,7 +68,10 @@ ModControllableAudio::ModControllableAudio() {
 	clippingAmount = 0;
 
 	SyncLevel syncLevel;
-	Song* song = preLoadedSong;
+	Song* song = songBeingPreloaded;
+	if (!song) {
+		song = preLoadedSong;
+	}
 	if (!song) {
 		song = currentSong;
 	}
@@ -83,6 +87,9 @@ ModControllableAudio::ModControllableAudio() {
 ModControllableAudio::~ModControllableAudio() {
 	// delay.discardBuffers(); // No! The DelayBuffers will themselves destruct and do this
 	delete grainFX;
+	if (midiKnobArray.getNumElements()) {
+		LearnedCCIndex::invalidate();
+	}
 }
 
 void ModControllableAudio::cloneFrom(ModControllableAudio* other) {
@@ -95,8 +102,10 @@ void ModControllableAudio::cloneFrom(ModControllableAudio* other) {
 	filterRoute = other->filterRoute;
 	sidechain.cloneFrom(&other->sidechain);
 	midiKnobArray.cloneFrom(&other->midiKnobArray); // Could fail if no RAM... not too big a concern
+	LearnedCCIndex::invalidate();
 	delay = other->delay;
 	stutterConfig = other->stutterConfig;
+	convolution.cloneFrom(other->convolution);
 }
 
 void ModControllableAudio::initParams(ParamManager* paramManager) {
@@ -172,6 +181,9 @@ void ModControllableAudio::processFX(std::span<StereoSample> buffer, ModFXType m
 		}
 	}
 
+	// Convolution --------------------------------------------------------------------------
+	convolution.process(buffer);
+
 	// Delay ----------------------------------------------------------------------------------
 	delay.process(buffer, delayWorkingState);
 }
@@ -466,6 +478,14 @@ void ModControllableAudio::writeTagsToFile(Serializer& writer) {
 	writer.writeAttribute("reverse", stutterConfig.reversed);
 	writer.writeAttribute("pingPong", stutterConfig.pingPong);
 	writer.closeTag();
+
+	// Convolution
+	if (convolution.isActive()) {
+		writer.writeOpeningTagBeginning("convolution");
+		writer.writeAttribute("fileName", convolution.getFilePath().get());
+		writer.writeAttribute("mix", convolution.mix);
+		writer.closeTag();
+	}
 }
 
 void ModControllableAudio::writeParamAttributesToFile(Serializer& writer, ParamManager* paramManager,
@@ -629,6 +649,26 @@ Error ModControllableAudio::readTagFromFile(Deserializer& reader, char const* ta
 		reader.exitTag("stutter", true);
 	}
 
+	else if (!strcmp(tagName, "convolution")) {
+		String filePath;
+		reader.match('{');
+		while (*(tagName = reader.readNextTagOrAttributeName())) {
+			if (!strcmp(tagName, "fileName")) {
+				reader.readTagOrAttributeValueString(&filePath);
+				reader.exitTag("fileName");
+			}
+			else if (!strcmp(tagName, "mix")) {
+				convolution.mix = reader.readTagOrAttributeValueInt();
+				reader.exitTag("mix");
+			}
+			else {
+				reader.exitTag(tagName);
+			}
+		}
+		reader.exitTag("convolution", true);
+		convolution.setFilePath(filePath);
+	}
+
 	else if (!strcmp(tagName, "delay")) {
 		// Set default values in case they are not configured
 		delay.syncType = SYNC_TYPE_EVEN;
@@ -805,6 +845,7 @@ doReadPatchedParam:
 				if (p != params::GLOBAL_NONE && p != params::PLACEHOLDER_RANGE) {
 					MIDIKnob* newKnob = midiKnobArray.insertKnobAtEnd();
 					if (newKnob) {
+						LearnedCCIndex::invalidate();
 						newKnob->midiInput.cable = cable;
 						newKnob->midiInput.channelOrZone = channel;
 						newKnob->midiInput.noteOrCC = ccNumber;
@@ -1318,6 +1359,7 @@ char const* ModControllableAudio::getHPFModeDisplayName() {
 // This can get called either for hibernation, or because drum now has no active noteRow
 void ModControllableAudio::wontBeRenderedForAWhile() {
 	delay.discardBuffers();
+	convolution.startSkippingRendering();
 	endStutter(nullptr);
 }
 
@@ -1382,6 +1424,7 @@ bool ModControllableAudio::learnKnob(MIDICable* cable, ParamDescriptor paramDesc
 		}
 
 midiKnobFound:
+		LearnedCCIndex::invalidate();
 		knob->midiInput.noteOrCC = whichKnob;
 		knob->midiInput.channelOrZone = midiChannel;
 		knob->midiInput.cable = cable;
@@ -1408,6 +1451,7 @@ bool ModControllableAudio::unlearnKnobs(ParamDescriptor paramDescriptor, Song* s
 		if (knob->paramDescriptor == paramDescriptor) {
 			anythingFound = true;
 			midiKnobArray.deleteAtIndex(k);
+			LearnedCCIndex::invalidate();
 		}
 		else {
 			k++;
@@ -20,6 +20,7 @@
 #include "definitions_cxx.hpp"
 #include "deluge/dsp/granular/GranularProcessor.h"
 #include "dsp/compressor/rms_feedback.h"
+#include "dsp/convolution/convolution_fx.h"
 #include "dsp/delay/delay.h"
 #include "dsp/stereo_sample.h"
 #include "hid/button.h"
@@ -102,6 +103,9 @@ public:
 	Delay delay;
 	StutterConfig stutterConfig;
 
+	// User IR, after the EQ and before the delay
+	ConvolutionFX convolution;
+
 	bool sampleRateReductionOnLastTime;
 	uint8_t clippingAmount; // Song probably doesn't currently use this?
 	FilterMode lpfMode;
@@ -40,6 +40,7 @@
 #include "processing/sound/sound_drum.h"
 #include "processing/sound/sound_instrument.h"
 #include "storage/storage_manager.h"
+#include "util/container/tag_table.h"
 #include "util/functions.h"
 #include "util/lookuptables/lookuptables.h"
 #include <new>
@@ -3193,6 +3194,12 @@ uint32_t NoteRow::getNumNotes() {
 	return notes.getNumElements();
 }
 
+// Every tag NoteRow::readFromFile() handles itself, so it doesn't need a strcmp() for each one
+constexpr auto noteRowTags = deluge::makeTagTable({
+    "muted", "y", "colourOffset", "drumIndex", "gateOutput", "muteMidiCommand", "soundMidiCommand", "length",
+    "sequenceDirection", "bendRange", "soundParams", "notes", "noteData", "noteDataWithLift",
+    "noteDataWithIteranceAndFill", "noteDataWithSplitProb", "expressionData"});
+
 Error NoteRow::readFromFile(Deserializer& reader, int32_t* minY, InstrumentClip* parentClip, Song* song,
                             int32_t readAutomationUpToPos) {
 	char const* tagName;
@@ -3207,53 +3214,65 @@ Error NoteRow::readFromFile(Deserializer& reader, int32_t* minY, InstrumentClip*
 
 		uint16_t noteHexLength;
 
-		if (!strcmp(tagName, "muted")) {
+		int32_t tag = noteRowTags.find(tagName);
+		switch (tag) {
+		case noteRowTags["muted"]: {
 			muted = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "y")) {
+		case noteRowTags["y"]: {
 			y = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "colourOffset")) {
+		case noteRowTags["colourOffset"]: {
 			colourOffset = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "drumIndex")) {
+		case noteRowTags["drumIndex"]: {
 			drum = (Drum*)reader.readTagOrAttributeValueInt(); // Sneaky - we store an integer in place of this pointer,
 			                                                   // then swap it back to something meaningful later
+			break;
 		}
 
-		else if (!strcmp(tagName, "gateOutput")) {
+		case noteRowTags["gateOutput"]: {
 			int32_t gateChannel = reader.readTagOrAttributeValueInt();
 			gateChannel = std::clamp<int32_t>(gateChannel, 0, NUM_GATE_CHANNELS - 1);
 
 			drum = (Drum*)(0xFFFFFFFE - gateChannel);
+			break;
 		}
 
-		else if (!strcmp(tagName, "muteMidiCommand")) {
+		case noteRowTags["muteMidiCommand"]: {
 			muteMIDICommand.readNoteFromFile(reader);
+			break;
 		}
 
-		else if (!strcmp(tagName, "soundMidiCommand")) {
+		case noteRowTags["soundMidiCommand"]: {
 			midiInput.readNoteFromFile(reader);
+			break;
 		}
 
-		else if (!strcmp(tagName, "length")) {
+		case noteRowTags["length"]: {
 			loopLengthIfIndependent = reader.readTagOrAttributeValueInt();
 			readAutomationUpToPos = loopLengthIfIndependent; // So we can read automation right up to the actual
 			                                                 // length of this NoteRow.
+			break;
 		}
 
-		else if (!strcmp(tagName, "sequenceDirection")) {
+		case noteRowTags["sequenceDirection"]: {
 			sequenceDirectionMode = stringToSequenceDirectionMode(reader.readTagOrAttributeValue());
+			break;
 		}
 
-		else if (!strcmp(tagName, "bendRange")) {
+		case noteRowTags["bendRange"]: {
 			newBendRange = reader.readTagOrAttributeValueInt();
+			break;
 		}
 
-		else if (!strcmp(tagName, "soundParams")) {
+		case noteRowTags["soundParams"]: {
 
 			// Sneaky sorta hack for 2016 files - allow more params to be loaded into a ParamManager that
 			// already had some loading done by the Drum
@@ -3279,10 +3298,11 @@ Error NoteRow::readFromFile(Deserializer& reader, int32_t* minY, InstrumentClip*
 
 finishedNormalStuff:
 			Sound::readParamsFromFile(reader, &paramManager, readAutomationUpToPos);
+			break;
 		}
 
 		// Notes stored as XML (before V1.4) - NOT CONVERTED TO ALSO WORK WITH JSON.
-		else if (!strcmp(tagName, "notes")) {
+		case noteRowTags["notes"]: {
 			// Read each Note
 			uint32_t minPos = 0;
 			while (*(tagName = reader.readNextTagOrAttributeName())) {
@@ -3342,16 +3362,13 @@ finishedNormalStuff:
 					reader.exitTag(tagName);
 				}
 			}
+			break;
 		}
 
 		// Notes stored as hex data (V1.4 onwards)
-		else if (!strcmp(tagName, "noteData")) {
+		case noteRowTags["noteData"]: {
 			noteHexLength = 20;
 doReadNoteData:
-			int32_t minPos = 0;
-
-			int32_t numElementsToAllocateFor = 0;
-
 			if (!reader.prepareToReadTagOrAttributeValueOneCharAtATime()) {
 				goto getOut;
 			}
@@ -3363,175 +3380,43 @@ doReadNoteData:
 				}
 			}
 
-			while (true) {
-
-				// Every time we've reached the end of a cluster...
-				if (numElementsToAllocateFor <= 0) {
-
-					// See how many more chars before the end of the cluster. If there are any...
-					uint32_t charsRemaining = reader.getNumCharsRemainingInValueBeforeEndOfCluster();
-					if (charsRemaining) {
-
-						// Allocate space for the right number of notes, and remember how long it'll be before
-						// we need to do this check again
-						numElementsToAllocateFor = (uint32_t)(charsRemaining - 1) / noteHexLength + 1;
-						notes.ensureEnoughSpaceAllocated(
-						    numElementsToAllocateFor); // If it returns false... oh well. We'll fail later
-					}
-				}
-
-				char const* hexChars = reader.readNextCharsOfTagOrAttributeValue(noteHexLength);
-				if (!hexChars) {
-					goto getOut;
-				}
-
-				int32_t pos = hexToIntFixedLength(hexChars, 8);
-				int32_t length = hexToIntFixedLength(&hexChars[8], 8);
-				uint8_t velocity = hexToIntFixedLength(&hexChars[16], 2);
-				uint8_t lift, probability, fill;
-				Iterance iterance;
-
-				if (noteHexLength == 28) { // if reading custom iterance and fill
-					fill = hexToIntFixedLength(&hexChars[26], 2);
-					iterance = Iterance::fromInt(hexToIntFixedLength(&hexChars[22], 4));
-					probability = hexToIntFixedLength(&hexChars[20], 2);
-					lift = hexToIntFixedLength(&hexChars[18], 2);
-					if (lift == 0 || lift > 127) {
-						goto useDefaultLift;
-					}
-				}
-				else if (noteHexLength == 26) { // if nightly firmware 1.3 with no custom iterances
-					fill = hexToIntFixedLength(&hexChars[24], 2);
-					iterance = Iterance::fromPresetIndex(hexToIntFixedLength(&hexChars[22], 2));
-					probability = hexToIntFixedLength(&hexChars[20], 2);
-					lift = hexToIntFixedLength(&hexChars[18], 2);
-					if (lift == 0 || lift > 127) {
-						goto useDefaultLift;
-					}
-				}
-				else if (noteHexLength == 22) { // If reading lift...
-					probability = hexToIntFixedLength(&hexChars[20], 2);
-
-					if (probability == kOldFillProbabilityValue || probability == kOldNotFillProbabilityValue) {
-						if (probability == kOldFillProbabilityValue) {
-							fill = FillMode::FILL;
-						}
-						else {
-							fill = FillMode::NOT_FILL;
-						}
-						iterance = kDefaultIteranceValue;    // iterance off
-						probability = kNumProbabilityValues; // 100% probability
-					}
-					else if (probability > kNumProbabilityValues
-					         && probability <= kNumProbabilityValues + kNumIterancePresets) {
-						fill = FillMode::OFF;
-						iterance = iterancePresets[probability - kNumProbabilityValues - 1];
-						probability = kNumProbabilityValues; // 100% probability
-					}
-					else {
-						fill = FillMode::OFF;
-						iterance = kDefaultIteranceValue; // iterance off
-					}
-					lift = hexToIntFixedLength(&hexChars[18], 2);
-					if (lift == 0 || lift > 127) {
-						goto useDefaultLift;
-					}
-				}
-				else { // Or if no lift here to read
-					probability = hexToIntFixedLength(&hexChars[18], 2);
-
-					if (probability == kOldFillProbabilityValue || probability == kOldNotFillProbabilityValue) {
-						if (probability == kOldFillProbabilityValue) {
-							fill = FillMode::FILL;
-						}
-						else {
-							fill = FillMode::NOT_FILL;
-						}
-						iterance = kDefaultIteranceValue;    // iterance off
-						probability = kNumProbabilityValues; // 100% probability
-					}
-					else if (probability > kNumProbabilityValues
-					         && probability <= kNumProbabilityValues + kNumIterancePresets) {
-						fill = FillMode::OFF;
-						iterance = iterancePresets[probability - kNumProbabilityValues - 1];
-						probability = kNumProbabilityValues; // 100% probability
-					}
-					else {
-						fill = FillMode::OFF;
-						iterance = kDefaultIteranceValue; // iterance off
-					}
-
-					lift = hexToIntFixedLength(&hexChars[18], 2);
-					if (lift == 0 || lift > 127) {
-						goto useDefaultLift;
-					}
-
-useDefaultLift:
-					lift = kDefaultLiftValue;
-				}
-
-				// See if that's all allowed
-				if (length <= 0) {
-					length = 1; // This happened somehow in Simon Wollwage's song, May 2020
-				}
-				if (pos < minPos || pos > kMaxSequenceLength - length) {
-					continue;
-				}
-				if (velocity == 0 || velocity > 127) {
-					velocity = 64;
-				}
-				if ((probability & 127) > kNumProbabilityValues || probability >= (kNumProbabilityValues | 128)) {
-					probability = kNumProbabilityValues;
-				}
-				if (fill < FillMode::OFF || fill > FillMode::FILL) {
-					fill = FillMode::OFF;
-				}
-
-				minPos = pos + length;
-
-				// Ok, make the note
-				int32_t i = notes.insertAtKey(pos, true);
-				if (i == -1) {
-					return Error::INSUFFICIENT_RAM;
+			{
+				Error error = readNoteData(reader, noteHexLength);
+				if (error != Error::NONE) {
+					return error;
 				}
-				Note* newNote = notes.getElement(i);
-				newNote->setLength(length);
-				newNote->setVelocity(velocity);
-				newNote->setLift(lift);
-				newNote->setProbability(probability);
-				newNote->setIterance(iterance);
-				newNote->setFill(fill);
-
-				numElementsToAllocateFor--;
 			}
 getOut: {}
+			break;
 		}
 
 		// Notes stored as hex data including lift (V3.2 onwards)
-		else if (!strcmp(tagName, "noteDataWithLift")) {
+		case noteRowTags["noteDataWithLift"]: {
 			noteHexLength = 22;
 			goto doReadNoteData;
 		}
 
 		// Notes stored as hex data in nightly firmware 1.3 with no custom iterances
-		else if (!strcmp(tagName, "noteDataWithIteranceAndFill")) {
+		case noteRowTags["noteDataWithIteranceAndFill"]: {
 			noteHexLength = 26;
 			goto doReadNoteData;
 		}
 
 		// Notes stored as hex data including custom iterance and fill (community firmware 1.3 onwards)
-		else if (!strcmp(tagName, "noteDataWithSplitProb")) {
+		case noteRowTags["noteDataWithSplitProb"]: {
 			noteHexLength = 28;
 			goto doReadNoteData;
 		}
 
-		else if (!strcmp(tagName, "expressionData")) {
+		case noteRowTags["expressionData"]: {
 			paramManager.ensureExpressionParamSetExists();
 			ParamCollectionSummary* summary = paramManager.getExpressionParamSetSummary();
 			ExpressionParamSet* expressionParams = (ExpressionParamSet*)summary->paramCollection;
 			if (expressionParams) {
 				expressionParams->readFromFile(reader, summary, readAutomationUpToPos);
 			}
+			break;
+		}
 		}
 
 		reader.exitTag();
@@ -3550,6 +3435,155 @@ getOut: {}
 	return Error::NONE;
 }
 
+// Reads hex note data, from just past its "0x" to the end of the value
+Error NoteRow::readNoteData(Deserializer& reader, int32_t noteHexLength) {
+	int32_t minPos = 0;
+
+	int32_t numElementsToAllocateFor = 0;
+
+	while (true) {
+
+		// Every time we've reached the end of a cluster...
+		if (numElementsToAllocateFor <= 0) {
+
+			// See how many more chars before the end of the cluster. If there are any...
+			uint32_t charsRemaining = reader.getNumCharsRemainingInValueBeforeEndOfCluster();
+			if (charsRemaining) {
+
+				// Allocate space for the right number of notes, and remember how long it'll be before we need to do
+				// this check again
+				numElementsToAllocateFor = (uint32_t)(charsRemaining - 1) / noteHexLength + 1;
+				notes.ensureEnoughSpaceAllocated(
+				    numElementsToAllocateFor); // If it returns false... oh well. We'll fail later
+			}
+		}
+
+		char const* hexChars = reader.readNextCharsOfTagOrAttributeValue(noteHexLength);
+		if (!hexChars) {
+			return Error::NONE;
+		}
+
+		int32_t pos = hexToIntFixedLength(hexChars, 8);
+		int32_t length = hexToIntFixedLength(&hexChars[8], 8);
+		uint8_t velocity = hexToIntFixedLength(&hexChars[16], 2);
+		uint8_t lift, probability, fill;
+		Iterance iterance;
+
+		if (noteHexLength == 28) { // if reading custom iterance and fill
+			fill = hexToIntFixedLength(&hexChars[26], 2);
+			iterance = Iterance::fromInt(hexToIntFixedLength(&hexChars[22], 4));
+			probability = hexToIntFixedLength(&hexChars[20], 2);
+			lift = hexToIntFixedLength(&hexChars[18], 2);
+			if (lift == 0 || lift > 127) {
+				goto useDefaultLift;
+			}
+		}
+		else if (noteHexLength == 26) { // if nightly firmware 1.3 with no custom iterances
+			fill = hexToIntFixedLength(&hexChars[24], 2);
+			iterance = Iterance::fromPresetIndex(hexToIntFixedLength(&hexChars[22], 2));
+			probability = hexToIntFixedLength(&hexChars[20], 2);
+			lift = hexToIntFixedLength(&hexChars[18], 2);
+			if (lift == 0 || lift > 127) {
+				goto useDefaultLift;
+			}
+		}
+		else if (noteHexLength == 22) { // If reading lift...
+			probability = hexToIntFixedLength(&hexChars[20], 2);
+
+			if (probability == kOldFillProbabilityValue || probability == kOldNotFillProbabilityValue) {
+				if (probability == kOldFillProbabilityValue) {
+					fill = FillMode::FILL;
+				}
+				else {
+					fill = FillMode::NOT_FILL;
+				}
+				iterance = kDefaultIteranceValue;    // iterance off
+				probability = kNumProbabilityValues; // 100% probability
+			}
+			else if (probability > kNumProbabilityValues
+			         && probability <= kNumProbabilityValues + kNumIterancePresets) {
+				fill = FillMode::OFF;
+				iterance = iterancePresets[probability - kNumProbabilityValues - 1];
+				probability = kNumProbabilityValues; // 100% probability
+			}
+			else {
+				fill = FillMode::OFF;
+				iterance = kDefaultIteranceValue; // iterance off
+			}
+			lift = hexToIntFixedLength(&hexChars[18], 2);
+			if (lift == 0 || lift > 127) {
+				goto useDefaultLift;
+			}
+		}
+		else { // Or if no lift here to read
+			probability = hexToIntFixedLength(&hexChars[18], 2);
+
+			if (probability == kOldFillProbabilityValue || probability == kOldNotFillProbabilityValue) {
+				if (probability == kOldFillProbabilityValue) {
+					fill = FillMode::FILL;
+				}
+				else {
+					fill = FillMode::NOT_FILL;
+				}
+				iterance = kDefaultIteranceValue;    // iterance off
+				probability = kNumProbabilityValues; // 100% probability
+			}
+			else if (probability > kNumProbabilityValues
+			         && probability <= kNumProbabilityValues + kNumIterancePresets) {
+				fill = FillMode::OFF;
+				iterance = iterancePresets[probability - kNumProbabilityValues - 1];
+				probability = kNumProbabilityValues; // 100% probability
+			}
+			else {
+				fill = FillMode::OFF;
+				iterance = kDefaultIteranceValue; // iterance off
+			}
+
+			lift = hexToIntFixedLength(&hexChars[18], 2);
+			if (lift == 0 || lift > 127) {
+				goto useDefaultLift;
+			}
+
+useDefaultLift:
+			lift = kDefaultLiftValue;
+		}
+
+		// See if that's all allowed
+		if (length <= 0) {
+			length = 1; // This happened somehow in Simon Wollwage's song, May 2020
+		}
+		if (pos < minPos || pos > kMaxSequenceLength - length) {
+			continue;
+		}
+		if (velocity == 0 || velocity > 127) {
+			velocity = 64;
+		}
+		if ((probability & 127) > kNumProbabilityValues || probability >= (kNumProbabilityValues | 128)) {
+			probability = kNumProbabilityValues;
+		}
+		if (fill < FillMode::OFF || fill > FillMode::FILL) {
+			fill = FillMode::OFF;
+		}
+
+		minPos = pos + length;
+
+		// Ok, make the note
+		int32_t i = notes.insertAtKey(pos, true);
+		if (i == -1) {
+			return Error::INSUFFICIENT_RAM;
+		}
+		Note* newNote = notes.getElement(i);
+		newNote->setLength(length);
+		newNote->setVelocity(velocity);
+		newNote->setLift(lift);
+		newNote->setProbability(probability);
+		newNote->setIterance(iterance);
+		newNote->setFill(fill);
+
+		numElementsToAllocateFor--;
+	}
+}
+
 void NoteRow::writeToFile(Serializer& writer, int32_t drumIndex, InstrumentClip* clip) {
 	writer.writeOpeningTagBeginning("noteRow", true);
 
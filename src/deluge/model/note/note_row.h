@@ -113,6 +113,7 @@ public:
 	void resumePlayback(ModelStackWithNoteRow* modelStack, bool clipMayMakeSound);
 	void writeToFile(Serializer& writer, int32_t drumIndex, InstrumentClip* clip);
 	Error readFromFile(Deserializer& reader, int32_t*, InstrumentClip*, Song* song, int32_t readAutomationUpToPos);
+	Error readNoteData(Deserializer& reader, int32_t noteHexLength);
 	inline int32_t getNoteCode() { return y; }
 	void writeToFlash();
 	void readFromFlash(InstrumentClip* parentClip);
@@ -163,6 +164,11 @@ public:
 	/// compared with the time since this NoteRow started (i.e., time from the end during reversed playback).
 	uint32_t ignoreNoteOnsBefore_;
 
+	/// Kept up by InstrumentClip::processCurrentPos(), which doesn't process this NoteRow again until its next event
+	/// (as returned by processCurrentPos() here) is due, other than when everything is due anyway
+	int32_t ticksTilProcessingDue{0};
+	int32_t ticksSkippedSinceProcessed{0};
+
 	int32_t getDefaultProbability();
 	Iterance getDefaultIterance();
 	int32_t getDefaultFill(ModelStackWithNoteRow* modelStack);
@@ -24,8 +24,10 @@
 #include "memory/general_memory_allocator.h"
 #include "model/sample/sample_cache.h"
 #include "model/sample/sample_perc_cache_zone.h"
+#include "model/sample/sample_summary.h"
 #include "processing/engines/audio_engine.h"
 #include "storage/audio/audio_file_manager.h"
+#include "storage/audio/sample_analysis_cache.h"
 #include "storage/cluster/cluster.h"
 #include "storage/multi_range/multisample_range.h"
 #include <cmath>
@@ -67,7 +69,9 @@ Sample::Sample()
 	lengthInSamples = 0;
 	rawDataFormat = RawDataFormat::NATIVE;
 	midiNote = MIDI_NOTE_UNSET;
+	detectedPitch.midiNote = MIDI_NOTE_UNSET;
 	partOfFolderBeingLoaded = false;
+	numReasonsForNextSong = 0;
 
 	minValueFound = 2147483647;
 	maxValueFound = -2147483648;
@@ -78,6 +82,13 @@ Sample::Sample()
 	percCacheClusters[0] = nullptr;
 	percCacheClusters[1] = nullptr;
 
+	summary = nullptr;
+
+	fileSizeOnCard = 0;
+	summaryNumFramesOnCard = 0;
+	analysisUnsaved = false;
+	summaryUnsaved = false;
+
 	fileLoopStartSamples = 0;
 	fileLoopEndSamples = 0;
 	midiNoteFromFile = -1;
@@ -108,6 +119,10 @@ Sample::~Sample() {
 
 	deletePercCache(true);
 
+	if (summary != nullptr) {
+		summary->destroy();
+	}
+
 	for (int32_t i = 0; i < caches.getNumElements(); i++) {
 		SampleCacheElement* element = (SampleCacheElement*)caches.getElementAddress(i);
 		element->cache->~SampleCache();
@@ -1032,6 +1047,12 @@ void Sample::workOutMIDINote(bool doingSingleCycle, float minFreqHz, float maxFr
 			midiNote = midiNoteFromFile;
 		}
 
+		// Or if we detected it before, maybe on an earlier load, looking for the same thing...
+		else if (detectedPitch.midiNote != MIDI_NOTE_UNSET && detectedPitch.minFreqHz == minFreqHz
+		         && detectedPitch.maxFreqHz == maxFreqHz && detectedPitch.doPrimeTest == doPrimeTest) {
+			midiNote = detectedPitch.midiNote;
+		}
+
 		// And finally, detect the pitch the hard way
 		else {
 			freq = determinePitch(doingSingleCycle, minFreqHz, maxFreqHz, doPrimeTest);
@@ -1043,6 +1064,11 @@ void Sample::workOutMIDINote(bool doingSingleCycle, float minFreqHz, float maxFr
 			else {
 calculateMIDINote:
 				midiNote = 69 + log2f(freq / 440) * 12;
+
+				if (!doingSingleCycle) {
+					detectedPitch = {minFreqHz, maxFreqHz, doPrimeTest, midiNote};
+					analysisChanged();
+				}
 			}
 		}
 	}
@@ -1697,6 +1723,111 @@ void Sample::convertDataOnAnyClustersIfNecessary() {
 	}
 }
 
+// Starts off covering numFrames, but grows if later Clusters (e.g. of a recording) go past that
+SampleSummary* Sample::getOrCreateSummary(uint32_t numFrames) {
+	if (summary == nullptr && audioDataStartPosBytes != 0) {
+		// If we worked it all out on an earlier load, that'll save reading the whole file again
+		if (summaryNumFramesOnCard != 0 && SampleAnalysisCache::loadSummary(*this)) {
+			return summary;
+		}
+		summary = SampleSummary::create(this, numFrames);
+	}
+	return summary;
+}
+
+// Call when a Cluster has been loaded or recorded, while it still has a "reason". Does nothing if there's no summary
+// being kept for this Sample
+void Sample::summariseCluster(int32_t clusterIndex, Cluster const& cluster) {
+	SampleCluster* sampleCluster = clusters.getElement(clusterIndex);
+	if (summary == nullptr || sampleCluster->summarised || audioDataStartPosBytes == 0) {
+		return;
+	}
+
+	uint32_t clusterEndByte = (uint32_t)(clusterIndex + 1) << Cluster::size_magnitude;
+	if (clusterEndByte <= audioDataStartPosBytes) {
+		return;
+	}
+	uint32_t clusterEndFrame = (clusterEndByte - audioDataStartPosBytes) / (byteDepth * numChannels);
+	clusterEndFrame = std::min<uint64_t>(clusterEndFrame, lengthInSamples);
+
+	// If we can't get the memory to cover this Cluster, we just don't summarise it
+	if (!growSummaryToCover(clusterEndFrame)) {
+		return;
+	}
+
+	summary->addCluster(clusterIndex, cluster);
+	sampleCluster->summarised = true;
+	if (fileSizeOnCard != 0 && !summaryUnsaved) {
+		summaryUnsaved = true;
+		audioFileManager.analysisMayBeUnsaved = true;
+	}
+}
+
+// If the summary's not big enough, doubles it - or more, if that's still not enough. Returns false if there's no
+// summary or no memory for a bigger one
+bool Sample::growSummaryToCover(uint32_t numFrames) {
+	if (summary == nullptr) {
+		return false;
+	}
+	if (numFrames > summary->getNumFrames()) {
+		SampleSummary* biggerSummary =
+		    SampleSummary::create(this, std::max(numFrames, summary->getNumFrames() * 2), summary);
+		if (biggerSummary == nullptr) {
+			return false;
+		}
+		biggerSummary->copyFrom(*summary);
+		summary->destroy();
+		summary = biggerSummary;
+	}
+	return true;
+}
+
+// Call once the Sample's finished loading or recording. Starts keeping a summary, if it's long enough to ever get
+// drawn zoomed out, and puts in whatever audio's in memory now - the rest goes in as its Clusters get loaded
+void Sample::startSummary() {
+	if (lengthInSamples < SampleSummary::kMinFramesToSummarise) {
+		return;
+	}
+
+	// Make sure it covers the whole Sample first, so nothing gets allocated - which could steal a Cluster without a
+	// "reason" out from under us - while we go through them
+	if (getOrCreateSummary(lengthInSamples) == nullptr || !growSummaryToCover(lengthInSamples)) {
+		return;
+	}
+
+	for (int32_t c = 0; c < clusters.getNumElements(); c++) {
+		Cluster* cluster = clusters.getElement(c)->cluster;
+		if (cluster != nullptr && cluster->loaded) {
+			summariseCluster(c, *cluster);
+		}
+	}
+}
+
+// Must be called before the audio in any Cluster gets changed
+void Sample::deleteSummary() {
+	if (summary != nullptr) {
+		summary->destroy();
+		summaryStolen();
+	}
+}
+
+void Sample::summaryStolen() {
+	summary = nullptr;
+	summaryUnsaved = false;
+	for (int32_t c = 0; c < clusters.getNumElements(); c++) {
+		clusters.getElement(c)->summarised = false;
+	}
+}
+
+// Call when something's been worked out that the analysis sidecar should have. It gets written later, from
+// AudioFileManager::slowRoutine()
+void Sample::analysisChanged() {
+	if (fileSizeOnCard != 0) {
+		analysisUnsaved = true;
+		audioFileManager.analysisMayBeUnsaved = true;
+	}
+}
+
 int32_t Sample::getMaxPeakFromZero() {
 	// Comes out one >> of the value we actually want
 	int32_t halfValue = std::abs(getFoundValueCentrePoint() >> 1) + (maxValueFound >> 2) - (minValueFound >> 2);
@@ -1731,6 +1862,12 @@ void Sample::finalizeAfterLoad(uint32_t fileSize) {
 	audioDataLengthBytes = lengthInSamples * bytesPerSample; // Make sure it's an exact number of samples
 
 	workOutBitMask();
+
+	// Pick up anything we worked out about this file last time, rather than doing it all again
+	fileSizeOnCard = fileSize;
+	SampleAnalysisCache::load(*this);
+
+	startSummary();
 }
 
 #if ALPHA_OR_BETA_VERSION
@@ -47,6 +47,7 @@ class SampleCache;
 class MultisampleRange;
 class TimeStretcher;
 class SampleHolder;
+class SampleSummary;
 
 class Sample final : public AudioFile {
 public:
@@ -73,6 +74,13 @@ public:
 	bool getAveragesForCrossfade(int32_t* totals, int32_t startBytePos, int32_t crossfadeLengthSamples,
 	                             int32_t playDirection, int32_t lengthToAverageEach);
 	void convertDataOnAnyClustersIfNecessary();
+	SampleSummary* getOrCreateSummary(uint32_t numFrames);
+	void summariseCluster(int32_t clusterIndex, Cluster const& cluster);
+	bool growSummaryToCover(uint32_t numFrames);
+	void startSummary();
+	void summaryStolen();
+	void deleteSummary();
+	void analysisChanged();
 	int32_t getMaxPeakFromZero();
 	int32_t getFoundValueCentrePoint();
 	int32_t getValueSpan();
@@ -130,12 +138,25 @@ public:
 	bool partOfFolderBeingLoaded;
 	bool fileExplicitlySpecifiesSelfAsWaveTable;
 
+	// How many of numReasonsToBeLoaded are only there to keep data warm for the song waiting to be swapped in. While
+	// that's all there is, the Clusters go in the NEXT_SONG queues rather than the CURRENT_SONG ones
+	int32_t numReasonsForNextSong;
+
 #if SAMPLE_DO_LOCKS
 	bool lock;
 #endif
 
 	float midiNote; // -999 means not worked out yet. -1000 means error working out
 
+	// The last pitch found by determinePitch(), and what it was looking for. Kept in the analysis sidecar, so that
+	// loading the same file again with the same settings doesn't have to detect it again
+	struct DetectedPitch {
+		float minFreqHz;
+		float maxFreqHz;
+		bool doPrimeTest;
+		float midiNote; // -999 means none
+	} detectedPitch;
+
 	// int32_t valueSpan; // -2147483648 means both these are uninitialized
 	int32_t minValueFound;
 	int32_t maxValueFound;
@@ -148,6 +169,15 @@ public:
 	Cluster** percCacheClusters[2]; // One for each play-direction: 0=forwards; 1=reversed
 	int32_t numPercCacheClusters;
 
+	SampleSummary* summary; // Peaks for drawing the waveform zoomed out. Started once the Sample's loaded or recorded
+
+	// Size of the file this was loaded from, or 0 if it wasn't (yet). With the first Cluster's address, this is what
+	// finds the analysis sidecar - see SampleAnalysisCache
+	uint32_t fileSizeOnCard;
+	uint32_t summaryNumFramesOnCard; // 0 if the sidecar doesn't have a summary
+	bool analysisUnsaved;            // Something's been worked out which isn't in the sidecar yet
+	bool summaryUnsaved;             // Only saved once the summary's complete
+
 	int32_t beginningOffsetForPitchDetection;
 	bool beginningOffsetForPitchDetectionFound;
 
@@ -43,4 +43,5 @@ public:
 	int8_t minValue = 127;
 	int8_t maxValue = -128;
 	bool investigatedWholeLength = false;
+	bool summarised = false; // Whether this Cluster's audio has been added to the Sample's SampleSummary
 };
@@ -164,7 +164,16 @@ void SampleHolder::claimClusterReasons(bool reversed, int32_t clusterLoadInstruc
 	// unassignAllReasons(); // This now happens as part of reassessPosForMarker(), called below
 
 	int32_t playDirection = reversed ? -1 : 1;
-	int32_t bytesPerSample = audioFile->numChannels * ((Sample*)audioFile)->byteDepth;
+	claimClusterReasonsForMarker(clustersForStart, getStartPlaybackAtByte(reversed), playDirection,
+	                             clusterLoadInstruction);
+}
+
+uint32_t SampleHolder::getStartPlaybackAtByte(bool reversed) {
+	return getStartPlaybackAtByte(*(Sample*)audioFile, reversed);
+}
+
+uint32_t SampleHolder::getStartPlaybackAtByte(Sample& sample, bool reversed) {
+	int32_t bytesPerSample = sample.numChannels * sample.byteDepth;
 
 	// This code basically copied from VoiceSource::setupPlaybackBounds()
 	int32_t startPlaybackAtSample;
@@ -176,15 +185,15 @@ void SampleHolder::claimClusterReasons(bool reversed, int32_t clusterLoadInstruc
 		}
 	}
 	else {
-		startPlaybackAtSample = getEndPos() - 1 + kMarkerSamplesBeforeToClaim;
-		if (startPlaybackAtSample > ((Sample*)audioFile)->lengthInSamples - 1) {
-			startPlaybackAtSample = ((Sample*)audioFile)->lengthInSamples - 1;
+		// endPos may not have been set up yet if this isn't our audioFile
+		uint64_t endPlaybackAtSample = (endPos == 0) ? sample.lengthInSamples : std::min(endPos, sample.lengthInSamples);
+		startPlaybackAtSample = endPlaybackAtSample - 1 + kMarkerSamplesBeforeToClaim;
+		if (startPlaybackAtSample > sample.lengthInSamples - 1) {
+			startPlaybackAtSample = sample.lengthInSamples - 1;
 		}
 	}
 
-	int32_t startPlaybackAtByte = ((Sample*)audioFile)->audioDataStartPosBytes + startPlaybackAtSample * bytesPerSample;
-
-	claimClusterReasonsForMarker(clustersForStart, startPlaybackAtByte, playDirection, clusterLoadInstruction);
+	return sample.audioDataStartPosBytes + startPlaybackAtSample * bytesPerSample;
 }
 
 void SampleHolder::claimClusterReasonsForMarker(Cluster** clusters, uint32_t startPlaybackAtByte, int32_t playDirection,
@@ -38,6 +38,10 @@ public:
 	int64_t getDurationInSamples(bool forTimeStretching = false);
 	void beenClonedFrom(SampleHolder const* other, bool reversed);
 	virtual void claimClusterReasons(bool reversed, int32_t clusterLoadInstruction = CLUSTER_ENQUEUE);
+	/// The byte in the file that playback from the start marker begins reading at, with a little margin before it
+	uint32_t getStartPlaybackAtByte(bool reversed);
+	/// The same, for a Sample which isn't (yet) this holder's audioFile
+	uint32_t getStartPlaybackAtByte(Sample& sample, bool reversed);
 	int32_t getLengthInSamplesAtSystemSampleRate(bool forTimeStretching = false);
 	int32_t getLoopLengthAtSystemSampleRate(bool forTimeStretching = false);
 	void setAudioFile(AudioFile* newAudioFile, bool reversed = false, bool manuallySelected = false,
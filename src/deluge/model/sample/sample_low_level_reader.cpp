@@ -27,6 +27,7 @@
 #include "model/voice/voice_sample_playback_guide.h"
 #include "storage/audio/audio_file_manager.h"
 #include "storage/cluster/cluster.h"
+#include <algorithm>
 
 void SampleLowLevelReader::unassignAllReasons(bool wontBeUsedAgain) {
 	for (int32_t l = 0; l < kNumClustersLoadedAhead; l++) {
@@ -147,6 +148,8 @@ void SampleLowLevelReader::setupReassessmentLocation(SamplePlaybackGuide* guide,
 	int32_t endPlaybackAtByte;
 	int32_t finalClusterIndex = guide->getFinalClusterIndex(sample, shouldObeyMarkers(), &endPlaybackAtByte);
 
+	guardBytesPastReassessment = 0;
+
 	// Is this the final Cluster?
 	if (currentClusterIndex == finalClusterIndex) {
 		int32_t bytePosWithinClusterToStopAt = endPlaybackAtByte & (Cluster::size - 1);
@@ -188,6 +191,16 @@ void SampleLowLevelReader::setupReassessmentLocation(SamplePlaybackGuide* guide,
 			}
 #endif
 			reassessmentLocation = clusters[0]->data + endPosWithinCurrentCluster;
+
+			// Whole samples which fit in the guard bytes after the one straddling the Cluster end, but not past where
+			// playback will stop if that's early in the next Cluster
+			int32_t guardBytes = ((int32_t)Cluster::guardSize / bytesPerSample - 1) * bytesPerSample;
+			if (currentClusterIndex + 1 == finalClusterIndex) {
+				int32_t bytesUntilStop =
+				    endPlaybackAtByte - currentClusterIndex * Cluster::size - endPosWithinCurrentCluster;
+				guardBytes = std::clamp<int32_t>(bytesUntilStop, 0, guardBytes);
+			}
+			guardBytesPastReassessment = guardBytes;
 		}
 
 		// Playing backwards
@@ -324,6 +337,15 @@ bool SampleLowLevelReader::assignClusters(SamplePlaybackGuide* guide, Sample* sa
 	return true;
 }
 
+// Only once the next Cluster has loaded and been copied into the current one's guard bytes can we read on past the
+// reassessmentLocation
+int32_t SampleLowLevelReader::getGuardBytesReadable() const {
+	if (!guardBytesPastReassessment || !clusters[0]->guardBytesFilled || !clusters[1] || !clusters[1]->loaded) {
+		return 0;
+	}
+	return guardBytesPastReassessment;
+}
+
 bool SampleLowLevelReader::moveOnToNextCluster(SamplePlaybackGuide* guide, Sample* sample, int32_t priorityRating) {
 
 #if ALPHA_OR_BETA_VERSION
@@ -450,8 +472,7 @@ void SampleLowLevelReader::fillInterpolationBufferRetrospectively(Sample* sample
 	if (clusters[0] == nullptr) {
 		// zero and return ASAP
 		for (int32_t i = startI; i < bufferSize; i++) {
-			interpolator_.buffer_l[i] = 0;
-			interpolator_.buffer_r[i] = 0;
+			interpolator_.set(i, 0, 0);
 		}
 		return;
 	}
@@ -466,17 +487,16 @@ void SampleLowLevelReader::fillInterpolationBufferRetrospectively(Sample* sample
 
 		// If there was valid audio data there...
 		if (bytesPastClusterStart >= 0) {
-			interpolator_.buffer_l[i] = *(int16_t*)(thisPlayPos + 2);
+			interpolator_.setL(i, *(int16_t*)(thisPlayPos + 2));
 
 			if (sample->numChannels == 2) {
-				interpolator_.buffer_r[i] = *(int16_t*)(thisPlayPos + 2 + sample->byteDepth);
+				interpolator_.setR(i, *(int16_t*)(thisPlayPos + 2 + sample->byteDepth));
 			}
 		}
 
 		// Or if not, just write zeros
 		else {
-			interpolator_.buffer_l[i] = 0;
-			interpolator_.buffer_r[i] = 0;
+			interpolator_.set(i, 0, 0);
 		}
 	}
 }
@@ -488,8 +508,7 @@ bool SampleLowLevelReader::fillInterpolationBufferForward(SamplePlaybackGuide* g
 	if (clusters[0] == nullptr) {
 		// zero and exit fast
 		for (int32_t i = numSpacesToFill - 1; i >= 0; i--) {
-			interpolator_.buffer_l[i] = 0;
-			interpolator_.buffer_r[i] = 0;
+			interpolator_.set(i, 0, 0);
 			currentPlayPos++;
 			if ((uint32_t)currentPlayPos >= interpolationBufferSize) {
 				return false;
@@ -502,17 +521,16 @@ bool SampleLowLevelReader::fillInterpolationBufferForward(SamplePlaybackGuide* g
 	for (int32_t i = numSpacesToFill - 1; i >= 0; i--) {
 		bool stillGoing = changeClusterIfNecessary(guide, sample, loopingAtLowLevel, priorityRating);
 		if (!stillGoing) {
-			interpolator_.buffer_l[i] = 0;
-			interpolator_.buffer_r[i] = 0;
+			interpolator_.set(i, 0, 0);
 			currentPlayPos++;
 			if ((uint32_t)currentPlayPos >= interpolationBufferSize) {
 				return false;
 			}
 		}
 
-		interpolator_.buffer_l[i] = *(int16_t*)(currentPlayPos + 2);
+		interpolator_.setL(i, *(int16_t*)(currentPlayPos + 2));
 		if (sample->numChannels == 2) {
-			interpolator_.buffer_r[i] = *(int16_t*)(currentPlayPos + 2 + sample->byteDepth);
+			interpolator_.setR(i, *(int16_t*)(currentPlayPos + 2 + sample->byteDepth));
 		}
 
 		// And move forward one more
@@ -563,6 +581,14 @@ bool SampleLowLevelReader::considerUpcomingWindow(SamplePlaybackGuide* guide, Sa
 	// Interpolating
 	if (phaseIncrement != kMaxSampleValue) {
 
+		// If the last window read on into the guard bytes, move properly into the next Cluster before anything else
+		// looks at the play position
+		if (clusters[0] && getGuardBytesReadable()) {
+			if (!changeClusterIfNecessary(guide, sample, loopingAtLowLevel, priorityRating)) {
+				return false;
+			}
+		}
+
 		// But if we weren't interpolating last time...
 		if (!interpolationBufferSizeLastTime) {
 			interpolationBufferSizeLastTime = interpolationBufferSize;
@@ -607,9 +633,9 @@ bool SampleLowLevelReader::considerUpcomingWindow(SamplePlaybackGuide* guide, Sa
 				int32_t offset = difference >> 1;
 
 				for (int32_t i = 0; i < interpolationBufferSize; i++) {
-					interpolator_.buffer_l[i] = interpolator_.buffer_l[i + offset];
+					interpolator_.setL(i, interpolator_.getL(i + offset));
 					if (sample->numChannels == 2) {
-						interpolator_.buffer_r[i] = interpolator_.buffer_r[i + offset];
+						interpolator_.setR(i, interpolator_.getR(i + offset));
 					}
 				}
 
@@ -639,9 +665,9 @@ bool SampleLowLevelReader::considerUpcomingWindow(SamplePlaybackGuide* guide, Sa
 				int32_t offset = difference >> 1;
 
 				for (int32_t i = 0; i < interpolationBufferSizeLastTime; i++) {
-					interpolator_.buffer_l[i + offset] = interpolator_.buffer_l[i];
+					interpolator_.setL(i + offset, interpolator_.getL(i));
 					if (sample->numChannels == 2) {
-						interpolator_.buffer_r[i + offset] = interpolator_.buffer_r[i];
+						interpolator_.setR(i + offset, interpolator_.getR(i));
 					}
 				}
 
@@ -654,9 +680,9 @@ bool SampleLowLevelReader::considerUpcomingWindow(SamplePlaybackGuide* guide, Sa
 
 				// If still here, fill far end with zeros. Not perfect, but it'll do.
 				for (int32_t i = (interpolationBufferSize - offset); i < interpolationBufferSize; i++) {
-					interpolator_.buffer_l[i] = 0;
+					interpolator_.setL(i, 0);
 					if (sample->numChannels == 2) {
-						interpolator_.buffer_r[i] = 0;
+						interpolator_.setR(i, 0);
 					}
 				}
 
@@ -781,6 +807,7 @@ doZeroes:
 				if (ALPHA_OR_BETA_VERSION && bytesLeftWhichMayBeRead < 0) {
 					FREEZE_WITH_ERROR("E148");
 				}
+				bytesLeftWhichMayBeRead += getGuardBytesReadable();
 
 				int32_t bytesWeWantToRead = samplesWeWantToReadThisWindow * bytesPerSample;
 				shouldShorten = (bytesWeWantToRead > bytesLeftWhichMayBeRead);
@@ -846,6 +873,7 @@ doZeroes:
 		if (ALPHA_OR_BETA_VERSION && bytesLeftWhichMayBeRead <= 0) {
 			FREEZE_WITH_ERROR("E001");
 		}
+		bytesLeftWhichMayBeRead += getGuardBytesReadable();
 
 		// If there are actually less bytes remaining than we ideally wanted for this window...
 		if (*numSamples * bytesPerSample > bytesLeftWhichMayBeRead) {
@@ -863,17 +891,16 @@ doZeroes:
 
 void SampleLowLevelReader::bufferIndividualSampleForInterpolation(int32_t numChannels, int32_t byteDepth,
                                                                   char* __restrict__ playPosNow) {
-	interpolator_.pushL(*(int16_t*)(playPosNow + 2));
 	if (numChannels == 2) {
-		interpolator_.pushR(*(int16_t*)(playPosNow + 2 + byteDepth));
+		interpolator_.push(*(int16_t*)(playPosNow + 2), *(int16_t*)(playPosNow + 2 + byteDepth));
+	}
+	else {
+		interpolator_.push(*(int16_t*)(playPosNow + 2));
 	}
 }
 
 void SampleLowLevelReader::bufferZeroForInterpolation(int32_t numChannels) {
-	interpolator_.pushL(0);
-	if (numChannels == 2) {
-		interpolator_.pushR(0);
-	}
+	interpolator_.push(0, 0);
 	currentPlayPos++;
 }
 
@@ -909,29 +936,29 @@ void SampleLowLevelReader::jumpForwardLinear(int32_t numChannels, int32_t byteDe
 
 		if (numChannels == 2) {
 			if (numSamplesToJumpForward >= 2) {
-				interpolator_.buffer_l[1] = *(int16_t*)(currentPlayPos + 2);
-				interpolator_.buffer_r[1] = *(int16_t*)(currentPlayPos + 2 + byteDepth);
+				interpolator_.setL(1, *(int16_t*)(currentPlayPos + 2));
+				interpolator_.setR(1, *(int16_t*)(currentPlayPos + 2 + byteDepth));
 				currentPlayPos += jumpAmount;
 			}
 			else {
-				interpolator_.buffer_l[1] = interpolator_.buffer_l[0];
-				interpolator_.buffer_r[1] = interpolator_.buffer_r[0];
+				interpolator_.setL(1, interpolator_.getL(0));
+				interpolator_.setR(1, interpolator_.getR(0));
 			}
-			interpolator_.buffer_r[0] = *(int16_t*)(currentPlayPos + 2 + byteDepth);
+			interpolator_.setR(0, *(int16_t*)(currentPlayPos + 2 + byteDepth));
 		}
 
 		else {
 			if (numSamplesToJumpForward >= 2) {
-				interpolator_.buffer_l[1] = *(int16_t*)(currentPlayPos + 2);
+				interpolator_.setL(1, *(int16_t*)(currentPlayPos + 2));
 				currentPlayPos += jumpAmount;
 			}
 			else {
-				interpolator_.buffer_l[1] = interpolator_.buffer_l[0];
+				interpolator_.setL(1, interpolator_.getL(0));
 			}
 		}
 
 		// Putting these down here did speed things up!
-		interpolator_.buffer_l[0] = *(int16_t*)(currentPlayPos + 2);
+		interpolator_.setL(0, *(int16_t*)(currentPlayPos + 2));
 		currentPlayPos += jumpAmount;
 	}
 }
@@ -991,9 +1018,8 @@ void SampleLowLevelReader::readSamplesResampled(int32_t** __restrict__ oscBuffer
 
 					if (numChannels == 2) {
 						while (true) {
-							interpolator_.buffer_l[numSamplesToJumpForward] = sourceL;
-							interpolator_.buffer_r[numSamplesToJumpForward] =
-							    *(int16_t*)(currentPlayPosNow + byteDepth);
+							interpolator_.setL(numSamplesToJumpForward, sourceL);
+							interpolator_.setR(numSamplesToJumpForward, *(int16_t*)(currentPlayPosNow + byteDepth));
 							currentPlayPosNow += jumpAmount;
 							if (!numSamplesToJumpForward) {
 								goto skipFirstSmooth;
@@ -1006,7 +1032,7 @@ void SampleLowLevelReader::readSamplesResampled(int32_t** __restrict__ oscBuffer
 					else {
 						while (true) {
 							currentPlayPosNow += jumpAmount;
-							interpolator_.buffer_l[numSamplesToJumpForward] = sourceL;
+							interpolator_.setL(numSamplesToJumpForward, sourceL);
 							if (!numSamplesToJumpForward) {
 								goto skipFirstSmooth;
 							}
@@ -1227,6 +1253,7 @@ void SampleLowLevelReader::cloneFrom(SampleLowLevelReader* other, bool stealReas
 	currentPlayPos = other->currentPlayPos;
 	reassessmentLocation = other->reassessmentLocation;
 	clusterStartLocation = other->clusterStartLocation;
+	guardBytesPastReassessment = other->guardBytesPastReassessment;
 	reassessmentAction = other->reassessmentAction;
 	interpolationBufferSizeLastTime = other->interpolationBufferSizeLastTime;
 }
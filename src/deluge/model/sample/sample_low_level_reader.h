@@ -93,6 +93,9 @@ public:
 	char* currentPlayPos;
 	char* reassessmentLocation;
 	char* clusterStartLocation; // You're allowed to read from this location, but not move any further "back" past it
+	// How far past the reassessmentLocation a window may read on into the current Cluster's guard bytes, if they've
+	// been filled, before we move properly into the next Cluster
+	int32_t guardBytesPastReassessment = 0;
 	uint8_t reassessmentAction;
 	int8_t interpolationBufferSizeLastTime; // 0 if was previously switched off
 
@@ -101,6 +104,7 @@ public:
 	std::array<Cluster*, kNumClustersLoadedAhead> clusters = {nullptr, nullptr};
 
 private:
+	[[nodiscard]] int32_t getGuardBytesReadable() const;
 	bool assignClusters(SamplePlaybackGuide* guide, Sample* sample, int32_t clusterIndex, int32_t priorityRating);
 	bool fillInterpolationBufferForward(SamplePlaybackGuide* guide, Sample* sample, int32_t interpolationBufferSize,
 	                                    bool loopingAtLowLevel, int32_t numSpacesToFill, int32_t priorityRating);
@@ -576,6 +576,16 @@ Error SampleRecorder::writeOneCompletedCluster() {
 
 	Error error = writeCluster(writingClusterIndex, Cluster::size);
 
+	// Summarise the recording as we go, while its Clusters are still sure to be in memory, so it's all there once
+	// we're done and drawing it zoomed out never has to read it back
+	Cluster* writtenCluster = sample->clusters.getElement(writingClusterIndex)->cluster;
+	if (writtenCluster != nullptr) {
+		uint32_t clusterEndByte = (uint32_t)firstUnwrittenClusterIndex << Cluster::size_magnitude;
+		sample->getOrCreateSummary((clusterEndByte - sample->audioDataStartPosBytes)
+		                           / (sample->byteDepth * sample->numChannels));
+		sample->summariseCluster(writingClusterIndex, *writtenCluster);
+	}
+
 	// We no longer have a reason to require this Cluster to be kept in memory
 	if (!keepingReasonsForFirstClusters || writingClusterIndex >= kNumClustersLoadedAhead) {
 		Cluster* cluster = sample->clusters.getElement(writingClusterIndex)->cluster;
@@ -787,6 +797,10 @@ Error SampleRecorder::finalizeRecordedFile() {
 	    * (sample->byteDepth
 	       * sample->numChannels); // Ensure whole number of samples (surely it already would be though?)
 
+	// Now the length's known, the final Cluster can go in too - or, if altering the file threw the summary away, as
+	// much of it as is still in memory
+	sample->startSummary();
+
 	if (sample->tempFilePathForRecording.isEmpty()) {
 		sampleBrowser.lastFilePathLoaded.set(&sample->filePath);
 	}
@@ -1179,6 +1193,9 @@ Error SampleRecorder::alterFile(MonitoringAction action, int32_t lshiftAmount, u
                                 uint64_t dataLengthAfterAction) {
 
 	D_PRINTLN("altering file");
+
+	// The audio's about to change, so any summary of it will be wrong
+	sample->deleteSummary();
 	int32_t currentReadClusterIndex = 0;
 	int32_t currentWriteClusterIndex = 0;
 
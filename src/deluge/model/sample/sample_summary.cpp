@@ -0,0 +1,238 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "model/sample/sample_summary.h"
+#if IN_UNIT_TESTS
+#include "sample_summary_mocks.h"
+#else
+#include "memory/general_memory_allocator.h"
+#include "model/sample/sample.h"
+#include "storage/cluster/cluster.h"
+#endif
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+SampleSummary::SampleSummary(Sample* newSample, uint32_t numFrames) : sample(newSample) {
+	Bin* nextBins = reinterpret_cast<Bin*>(this + 1);
+	for (int32_t l = 0; l < kNumLevels; l++) {
+		numBins[l] = numFrames >> kBinSizeMagnitudes[l];
+		bins[l] = nextBins;
+		std::fill_n(bins[l], numBins[l], Bin{32767, -32768, 0});
+		nextBins += numBins[l];
+	}
+}
+
+size_t SampleSummary::getAllocationSize(uint32_t numFrames) {
+	size_t size = sizeof(SampleSummary);
+	for (int32_t l = 0; l < kNumLevels; l++) {
+		size += (numFrames >> kBinSizeMagnitudes[l]) * sizeof(Bin);
+	}
+	return size;
+}
+
+// Rounds the length up to a whole number of the biggest bins, so every level divides evenly and a bigger summary can
+// take over a smaller one's bins as they are
+SampleSummary* SampleSummary::create(Sample* sample, uint32_t numFrames, void* dontStealFromThing) {
+	constexpr int32_t topMagnitude = kBinSizeMagnitudes[kNumLevels - 1];
+	numFrames = (((std::max<uint32_t>(numFrames, 1) - 1) >> topMagnitude) + 1) << topMagnitude;
+
+	void* memory = GeneralMemoryAllocator::get().allocStealable(getAllocationSize(numFrames), dontStealFromThing);
+	if (memory == nullptr) {
+		return nullptr;
+	}
+
+	auto* summary = new (memory) SampleSummary(sample, numFrames);
+	GeneralMemoryAllocator::get().putStealableInAppropriateQueue(summary);
+	return summary;
+}
+
+void SampleSummary::destroy() {
+	this->~SampleSummary(); // Removes from stealable list
+	delugeDealloc(this);
+}
+
+void SampleSummary::copyFrom(SampleSummary const& other) {
+	for (int32_t l = 0; l < kNumLevels; l++) {
+		std::copy_n(other.bins[l], std::min(numBins[l], other.numBins[l]), bins[l]);
+	}
+}
+
+// The Cluster must be loaded, with its data converted to native format. Only whole frames inside the Cluster are read -
+// one straddling either boundary is left out, which makes no difference you could see
+void SampleSummary::addCluster(int32_t clusterIndex, Cluster const& cluster) {
+	int32_t byteDepth = sample->byteDepth;
+	int32_t numChannels = sample->numChannels;
+	int32_t bytesPerFrame = byteDepth * numChannels;
+
+	uint32_t clusterStartByte = clusterIndex << Cluster::size_magnitude;
+	uint32_t clusterEndByte = clusterStartByte + Cluster::size;
+	if (clusterEndByte <= sample->audioDataStartPosBytes) {
+		return;
+	}
+
+	uint32_t startFrame = 0;
+	if (clusterStartByte > sample->audioDataStartPosBytes) {
+		startFrame = (clusterStartByte - sample->audioDataStartPosBytes + bytesPerFrame - 1) / bytesPerFrame;
+	}
+	uint32_t endFrame = (clusterEndByte - sample->audioDataStartPosBytes) / bytesPerFrame;
+	endFrame = std::min<uint64_t>(endFrame, sample->lengthInSamples);
+	endFrame = std::min(endFrame, getNumFrames());
+	if (endFrame <= startFrame) {
+		return;
+	}
+
+	// Misalign, to align with non-32-bit data - which can take us a little before the start of the Cluster's data, so
+	// keep the offset signed
+	int32_t startByteInCluster = sample->audioDataStartPosBytes + startFrame * bytesPerFrame - clusterStartByte;
+	char const* frame = &cluster.data[startByteInCluster + byteDepth - 4];
+
+	uint32_t frameNow = startFrame;
+	while (frameNow < endFrame) {
+		uint32_t binIndex = frameNow >> kBinSizeMagnitudes[0];
+		uint32_t binEndFrame = std::min(endFrame, (binIndex + 1) << kBinSizeMagnitudes[0]);
+
+		int32_t minHere = 32767;
+		int32_t maxHere = -32768;
+		uint64_t sumSquares = 0;
+
+		for (; frameNow < binEndFrame; frameNow++) {
+			for (int32_t c = 0; c < numChannels; c++) {
+				int32_t value = *(int32_t*)(frame + c * byteDepth) >> 16;
+				minHere = std::min(minHere, value);
+				maxHere = std::max(maxHere, value);
+				sumSquares += value * value;
+			}
+			frame += bytesPerFrame;
+		}
+
+		// A bin straddling two Clusters gets half of its mean from each, whichever order they're added in
+		Bin& bin = bins[0][binIndex];
+		bin.min = std::min<int32_t>(bin.min, minHere);
+		bin.max = std::max<int32_t>(bin.max, maxHere);
+		bin.meanSquare += sumSquares / (numChannels << kBinSizeMagnitudes[0]);
+	}
+
+	rebuildParents(startFrame, endFrame);
+}
+
+// Bins at each level above the first are just worked out again from their children - it's only a handful of them
+void SampleSummary::rebuildParents(uint32_t startFrame, uint32_t endFrame) {
+	for (int32_t l = 1; l < kNumLevels; l++) {
+		int32_t childMagnitude = kBinSizeMagnitudes[l] - kBinSizeMagnitudes[l - 1];
+
+		for (uint32_t b = startFrame >> kBinSizeMagnitudes[l]; b <= (endFrame - 1) >> kBinSizeMagnitudes[l]; b++) {
+			Bin parent{32767, -32768, 0};
+			uint64_t sumMeanSquares = 0;
+			Bin const* child = &bins[l - 1][b << childMagnitude];
+			for (int32_t c = 0; c < (1 << childMagnitude); c++, child++) {
+				parent.min = std::min(parent.min, child->min);
+				parent.max = std::max(parent.max, child->max);
+				sumMeanSquares += child->meanSquare;
+			}
+			parent.meanSquare = sumMeanSquares >> childMagnitude;
+			bins[l][b] = parent;
+		}
+	}
+}
+
+bool SampleSummary::allClustersSummarised(uint32_t startFrame, uint32_t endFrame) {
+	int32_t bytesPerFrame = sample->byteDepth * sample->numChannels;
+	endFrame = std::min<uint64_t>(endFrame, sample->lengthInSamples);
+
+	// Include the Clusters holding any straddling frame at either end, since those bins got some of their frames too
+	int32_t startCluster = (sample->audioDataStartPosBytes + startFrame * bytesPerFrame) >> Cluster::size_magnitude;
+	int32_t endCluster = (sample->audioDataStartPosBytes + endFrame * bytesPerFrame - 1) >> Cluster::size_magnitude;
+	if (endCluster >= sample->clusters.getNumElements()) {
+		return false;
+	}
+
+	for (int32_t c = startCluster; c <= endCluster; c++) {
+		if (!sample->clusters.getElement(c)->summarised) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Whether every Cluster with audio in it has been added
+bool SampleSummary::isComplete() {
+	return sample->lengthInSamples != 0 && allClustersSummarised(0, getNumFrames());
+}
+
+// Returns false if the range is too short to use the bins for, or they haven't all been filled yet - in which case
+// the caller will have to go and read the audio itself
+bool SampleSummary::getPeaks(uint32_t startFrame, uint32_t endFrame, int32_t* min, int32_t* max, int32_t* rms) {
+	if (endFrame <= startFrame || endFrame > getNumFrames()) {
+		return false;
+	}
+	uint32_t numFrames = endFrame - startFrame;
+
+	// Use the coarsest level which still has enough bins to cover the range
+	int32_t level = kNumLevels - 1;
+	while ((numFrames >> (kBinSizeMagnitudes[level] + kMinBinsPerColMagnitude)) == 0) {
+		if (--level < 0) {
+			return false;
+		}
+	}
+
+	int32_t magnitude = kBinSizeMagnitudes[level];
+	uint32_t firstBin = startFrame >> magnitude;
+	uint32_t lastBin = (endFrame - 1) >> magnitude;
+
+	if (!allClustersSummarised(firstBin << magnitude, (lastBin + 1) << magnitude)) {
+		return false;
+	}
+
+	int32_t minHere = 32767;
+	int32_t maxHere = -32768;
+	uint64_t sumMeanSquares = 0;
+	for (uint32_t b = firstBin; b <= lastBin; b++) {
+		Bin const& bin = bins[level][b];
+		minHere = std::min<int32_t>(minHere, bin.min);
+		maxHere = std::max<int32_t>(maxHere, bin.max);
+		sumMeanSquares += bin.meanSquare;
+	}
+
+	*min = minHere << 16;
+	*max = maxHere << 16;
+	if (rms != nullptr) {
+		// Each bin's mean is over its full size, so the Sample's last, partial bin comes out low. Summing them back up
+		// and dividing by only the frames which are really there weights each bin by how much audio it has
+		uint64_t rangeEndFrame = std::min<uint64_t>((uint64_t)(lastBin + 1) << magnitude, sample->lengthInSamples);
+		uint64_t numRealFrames = rangeEndFrame - std::min<uint64_t>(rangeEndFrame, (uint64_t)firstBin << magnitude);
+		uint64_t meanSquare = numRealFrames ? (sumMeanSquares << magnitude) / numRealFrames : 0;
+		*rms = static_cast<int32_t>(std::sqrt(static_cast<float>(meanSquare))) << 16;
+	}
+
+	GeneralMemoryAllocator::get().putStealableInAppropriateQueue(this); // Recently used
+	return true;
+}
+
+bool SampleSummary::mayBeStolen(void* thingNotToStealFrom) {
+	return thingNotToStealFrom != this && thingNotToStealFrom != sample;
+}
+
+void SampleSummary::steal(char const* errorCode) {
+	sample->summaryStolen();
+}
+
+StealableQueue SampleSummary::getAppropriateQueue() {
+	// Much like a perc cache - cheap to keep, but it'd take reading the whole file again to get it back
+	return sample->numReasonsToBeLoaded ? StealableQueue::CURRENT_SONG_SAMPLE_DATA_PERC_CACHE
+	                                    : StealableQueue::NO_SONG_SAMPLE_DATA_PERC_CACHE;
+}
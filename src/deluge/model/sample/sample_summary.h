@@ -0,0 +1,77 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "definitions_cxx.hpp"
+#include "memory/stealable.h"
+#include <array>
+#include <cstdint>
+
+class Cluster;
+class Sample;
+
+/// Min, max and RMS of a Sample's audio at a few resolutions, so that a long waveform can be drawn zoomed out without
+/// reading (or loading) its Clusters again. Each Cluster gets added once, as it's loaded or recorded - see
+/// SampleCluster::summarised - and a bin is only trusted once every Cluster it covers has been added. Lives in
+/// stealable memory, with the bins for all levels following this object in the same allocation.
+class SampleSummary final : public Stealable {
+public:
+	struct Bin {
+		int16_t min;
+		int16_t max;
+		uint32_t meanSquare; // Of the top 16 bits of each value, across all channels
+	};
+
+	constexpr static int32_t kNumLevels = 3;
+	// 256, 4096 and 65536 frames per bin
+	constexpr static std::array<int32_t, kNumLevels> kBinSizeMagnitudes = {8, 12, 16};
+	// Each column must cover at least this many bins before we'll use them, so the bins at either end don't smear too
+	// much of the neighbouring columns into it
+	constexpr static int32_t kMinBinsPerColMagnitude = 2;
+	constexpr static uint32_t kMinFramesToSummarise = 1 << (kBinSizeMagnitudes[0] + kMinBinsPerColMagnitude);
+
+	static SampleSummary* create(Sample* sample, uint32_t numFrames, void* dontStealFromThing = nullptr);
+	void destroy();
+
+	void copyFrom(SampleSummary const& other);
+	void addCluster(int32_t clusterIndex, Cluster const& cluster);
+	bool getPeaks(uint32_t startFrame, uint32_t endFrame, int32_t* min, int32_t* max, int32_t* rms = nullptr);
+	[[nodiscard]] uint32_t getNumFrames() const { return numBins[0] << kBinSizeMagnitudes[0]; }
+	bool isComplete();
+
+	/// Bins for all levels, one after the other - for keeping them on the card
+	[[nodiscard]] Bin* getAllBins() const { return bins[0]; }
+	[[nodiscard]] static size_t getAllBinsSize(uint32_t numFrames) {
+		return getAllocationSize(numFrames) - sizeof(SampleSummary);
+	}
+
+	bool mayBeStolen(void* thingNotToStealFrom) override;
+	void steal(char const* errorCode) override;
+	StealableQueue getAppropriateQueue() override;
+
+	Sample* sample;
+
+private:
+	SampleSummary(Sample* newSample, uint32_t numFrames);
+	static size_t getAllocationSize(uint32_t numFrames);
+	void rebuildParents(uint32_t startFrame, uint32_t endFrame);
+	bool allClustersSummarised(uint32_t startFrame, uint32_t endFrame);
+
+	std::array<uint32_t, kNumLevels> numBins;
+	std::array<Bin*, kNumLevels> bins;
+};
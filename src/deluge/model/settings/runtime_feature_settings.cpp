@@ -199,6 +199,21 @@ void RuntimeFeatureSettings::init() {
 	SetupOnOffSetting(settings[RuntimeFeatureSettingType::TrimFromStartOfAudioClip],
 	                  STRING_FOR_COMMUNITY_FEATURE_TRIM_FROM_START_OF_AUDIO_CLIP, "trimFromStartOfAudioClip",
 	                  RuntimeFeatureStateToggle::On);
+
+	// Deadline scheduling
+	SetupOnOffSetting(settings[RuntimeFeatureSettingType::DeadlineScheduling],
+	                  STRING_FOR_COMMUNITY_FEATURE_DEADLINE_SCHEDULING, "deadlineScheduling",
+	                  RuntimeFeatureStateToggle::Off);
+
+	// Binary song files
+	SetupOnOffSetting(settings[RuntimeFeatureSettingType::BinarySongFiles],
+	                  STRING_FOR_COMMUNITY_FEATURE_BINARY_SONG_FILES, "binarySongFiles",
+	                  RuntimeFeatureStateToggle::Off);
+
+	// Preload next song
+	SetupOnOffSetting(settings[RuntimeFeatureSettingType::PreloadNextSong],
+	                  STRING_FOR_COMMUNITY_FEATURE_PRELOAD_NEXT_SONG, "preloadNextSong",
+	                  RuntimeFeatureStateToggle::Off);
 }
 
 void RuntimeFeatureSettings::readSettingsFromFile() {
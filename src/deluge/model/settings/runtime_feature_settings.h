@@ -66,6 +66,9 @@ enum RuntimeFeatureSettingType : uint32_t {
 	AlternativeTapTempoBehaviour,
 	HorizontalMenus,
 	TrimFromStartOfAudioClip,
+	DeadlineScheduling,
+	BinarySongFiles,
+	PreloadNextSong,
 	MaxElement // Keep as boundary
 };
 
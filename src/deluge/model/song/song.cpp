@@ -50,6 +50,7 @@
 #include "model/settings/runtime_feature_settings.h"
 #include "model/song/clip_iterators.h"
 #include "model/voice/voice_sample.h"
+#include "modulation/midi/learned_cc_index.h"
 #include "modulation/patch/patch_cable_set.h"
 #include "playback/mode/arrangement.h"
 #include "playback/mode/session.h"
@@ -3206,6 +3207,7 @@ void Song::addOutput(Output* output, bool atStart) {
 		*prevPointer = output;
 		output->next = nullptr;
 	}
+	LearnedCCIndex::invalidate();
 
 	if (output->soloingInArrangementMode) {
 		anyOutputsSoloingInArrangement = true;
@@ -3261,6 +3263,7 @@ int32_t Song::removeOutputFromMainList(
 	}
 
 	*prevPointer = output->next;
+	LearnedCCIndex::invalidate();
 
 	AudioEngine::mustUpdateReverbParamsBeforeNextRender = true;
 
@@ -3430,6 +3433,7 @@ traverseClips:
 
 	// Put the newInstrument into the master list
 	*prevPointer = newOutput;
+	LearnedCCIndex::invalidate();
 	if (outputRecordingOldOutput) {
 		((AudioOutput*)outputRecordingOldOutput)->setOutputRecordingFrom(newOutput);
 	}
@@ -5105,6 +5109,7 @@ void Song::replaceOutputLowLevel(Output* newOutput, Output* oldOutput) {
 	for (prevPointer = &firstOutput; *prevPointer != oldOutput; prevPointer = &(*prevPointer)->next) {}
 	newOutput->next = oldOutput->next;
 	*prevPointer = newOutput;
+	LearnedCCIndex::invalidate();
 
 	// Migrate all ClipInstances from oldInstrument to newInstrument
 	newOutput->clipInstances.swapStateWith(&oldOutput->clipInstances);
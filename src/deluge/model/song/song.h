@@ -479,3 +479,4 @@ private:
 
 extern Song* currentSong;
 extern Song* preLoadedSong;
+extern Song* songBeingPreloaded; // While LoadSongUI reads the next song in the background, before it's preLoadedSong
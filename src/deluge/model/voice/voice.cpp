@@ -314,7 +314,8 @@ activenessDetermined:
 			if (unisonParts[u].sources[s].active) {
 				bool success =
 				    unisonParts[u].sources[s].noteOn(this, source, &guides[s], samplesLate, sound.oscRetriggerPhase[s],
-				                                     resetEnvelopes, sound.synthMode, velocity);
+				                                     resetEnvelopes, sound.synthMode, velocity,
+				                                     sourceOscillators[s].phase[u], sourceOscillators[s].feedback[u]);
 				if (!success) [[unlikely]] {
 					return false; // This shouldn't really ever happen I don't think really...
 				}
@@ -327,10 +328,10 @@ activenessDetermined:
 		for (int32_t u = 0; u < sound.numUnison; u++) {
 			for (int32_t m = 0; m < kNumModulators; m++) {
 				if (sound.modulatorRetriggerPhase[m] != 0xFFFFFFFF) {
-					unisonParts[u].modulatorPhase[m] = initialPhase + sound.modulatorRetriggerPhase[m];
+					modulatorOscillators[m].phase[u] = initialPhase + sound.modulatorRetriggerPhase[m];
 				}
 				if (resetEnvelopes) {
-					unisonParts[u].modulatorFeedback[m] = 0;
+					modulatorOscillators[m].feedback[u] = 0;
 				}
 			}
 		}
@@ -405,12 +406,12 @@ void Voice::setupPorta(const Sound& sound) {
 void Voice::randomizeOscPhases(const Sound& sound) {
 	for (int32_t u = 0; u < sound.numUnison; u++) {
 		for (int32_t s = 0; s < kNumSources; s++) {
-			unisonParts[u].sources[s].oscPos = getNoise();
+			sourceOscillators[s].phase[u] = getNoise();
 			// TODO: we should do sample play pos, too
 		}
 		if (sound.getSynthMode() == SynthMode::FM) {
 			for (int32_t m = 0; m < kNumModulators; m++) {
-				unisonParts[u].modulatorPhase[m] = getNoise();
+				modulatorOscillators[m].phase[u] = getNoise();
 			}
 		}
 	}
@@ -516,13 +517,13 @@ makeInactive: // Frequency too high to render! (Higher than 22.05kHz)
 
 		// If only one unison
 		if (sound.numUnison == 1) {
-			unisonParts[0].sources[s].phaseIncrementStoredValue = phaseIncrement;
+			sourceOscillators[s].phaseIncrement[0] = phaseIncrement;
 		}
 
 		// Or if multiple unison
 		else {
 			for (int32_t u = 0; u < sound.numUnison; u++) {
-				unisonParts[u].sources[s].phaseIncrementStoredValue = sound.unisonDetuners[u].detune(phaseIncrement);
+				sourceOscillators[s].phaseIncrement[u] = sound.unisonDetuners[u].detune(phaseIncrement);
 			}
 		}
 	}
@@ -549,7 +550,7 @@ makeInactive: // Frequency too high to render! (Higher than 22.05kHz)
 			else {
 				// Frequency too high to render! (Higher than 22.05kHz)
 				for (int32_t u = 0; u < sound.numUnison; u++) {
-					unisonParts[u].modulatorPhaseIncrement[m] = 0xFFFFFFFF; // Means "inactive"
+					modulatorOscillators[m].phaseIncrement[u] = 0xFFFFFFFF; // Means "inactive"
 				}
 				continue;
 			}
@@ -559,13 +560,13 @@ makeInactive: // Frequency too high to render! (Higher than 22.05kHz)
 
 			// If only one unison
 			if (sound.numUnison == 1) {
-				unisonParts[0].modulatorPhaseIncrement[m] = phaseIncrement;
+				modulatorOscillators[m].phaseIncrement[0] = phaseIncrement;
 			}
 
 			// Or if multiple unison
 			else {
 				for (int32_t u = 0; u < sound.numUnison; u++) {
-					unisonParts[u].modulatorPhaseIncrement[m] = sound.unisonDetuners[u].detune(phaseIncrement);
+					modulatorOscillators[m].phaseIncrement[u] = sound.unisonDetuners[u].detune(phaseIncrement);
 				}
 			}
 		}
@@ -934,7 +935,7 @@ uint32_t Voice::getLocalLFOPhaseIncrement(LFO_ID lfoId, deluge::modulation::para
 					// Work out the actual sample read rate, from the "native" read rate for the last unison, combined
 					// with the "pitch adjust" amount, and the pitch adjust for this source alone. If the pitch goes
 					// crazy-high, this will fall through and prevent auto-release from happening
-					uint32_t actualSampleReadRate = voiceUnisonPartSource->phaseIncrementStoredValue;
+					uint32_t actualSampleReadRate = sourceOscillators[s].phaseIncrement[sound.numUnison - 1];
 					if (!adjustPitch(actualSampleReadRate, overallPitchAdjust)) {
 						continue;
 					}
@@ -1110,7 +1111,7 @@ skipAutoRelease: {}
 	// Oscillator sync
 	if (doingOscSync) {
 		for (int32_t u = 0; u < sound.numUnison; u++) {
-			oscSyncPos[u] = unisonParts[u].sources[0].oscPos;
+			oscSyncPos[u] = sourceOscillators[0].phase[u];
 		}
 	}
 
@@ -1283,7 +1284,7 @@ skipAutoRelease: {}
 
 			uint32_t phaseIncrements[kNumSources];
 			for (int32_t s = 0; s < kNumSources; s++) {
-				phaseIncrements[s] = unisonParts[u].sources[s].phaseIncrementStoredValue;
+				phaseIncrements[s] = sourceOscillators[s].phaseIncrement[u];
 			}
 
 			// If overall pitch adjusted...
@@ -1338,7 +1339,7 @@ cantBeDoingOscSyncForFirstOsc:
 
 					dsp::Oscillator::renderOsc(
 					    oscType, 0, spareRenderingBuffer[s + 2], spareRenderingBuffer[s + 2] + numSamples, numSamples,
-					    phaseIncrements[s], pulseWidth, &unisonParts[u].sources[s].oscPos, false, 0,
+					    phaseIncrements[s], pulseWidth, &sourceOscillators[s].phase[u], false, 0,
 					    doingOscSyncThisOscillator, oscSyncPos[u], phaseIncrements[0], sound.oscRetriggerPhase[s],
 					    sourceWaveIndexIncrements[s], sourceWaveIndexesLastTime[s],
 					    static_cast<WaveTable*>(guides[s].audioFileHolder->audioFile));
@@ -1385,7 +1386,7 @@ cantBeDoingOscSyncForFirstOsc:
 				// If overall pitch adjusted, adjust modulator pitches
 				uint32_t phaseIncrementModulator[kNumModulators];
 				for (int32_t m = 0; m < kNumModulators; m++) {
-					phaseIncrementModulator[m] = unisonParts[u].modulatorPhaseIncrement[m];
+					phaseIncrementModulator[m] = modulatorOscillators[m].phaseIncrement[u];
 					if (phaseIncrementModulator[m] == 0xFFFFFFFF) {
 						modulatorsActive[m] = false; // If frequency marked as too high
 					}
@@ -1427,37 +1428,37 @@ cantBeDoingOscSyncForFirstOsc:
 					}
 
 					// Render mod1
-					renderSineWaveWithFeedback(spareRenderingBuffer[2], numSamples, &unisonParts[u].modulatorPhase[1],
+					renderSineWaveWithFeedback(spareRenderingBuffer[2], numSamples, &modulatorOscillators[1].phase[u],
 					                           modulatorAmplitudeLastTime[1], phaseIncrementModulator[1],
 					                           paramFinalValues[params::LOCAL_MODULATOR_1_FEEDBACK],
-					                           &unisonParts[u].modulatorFeedback[1], false,
+					                           &modulatorOscillators[1].feedback[u], false,
 					                           modulatorAmplitudeIncrements[1]);
 
 					// If mod1 is modulating mod0...
 					if (sound.modulator1ToModulator0) {
 						// .. render modulator0, receiving the FM from mod1
 						renderFMWithFeedback(spareRenderingBuffer[2], numSamples, nullptr,
-						                     &unisonParts[u].modulatorPhase[0], modulatorAmplitudeLastTime[0],
+						                     &modulatorOscillators[0].phase[u], modulatorAmplitudeLastTime[0],
 						                     phaseIncrementModulator[0],
 						                     paramFinalValues[params::LOCAL_MODULATOR_0_FEEDBACK],
-						                     &unisonParts[u].modulatorFeedback[0], modulatorAmplitudeIncrements[0]);
+						                     &modulatorOscillators[0].feedback[u], modulatorAmplitudeIncrements[0]);
 					}
 
 					// Otherwise, so long as modulator0 is in fact active, render it separately and add it
 					else if (modulatorsActive[0]) {
 						renderSineWaveWithFeedback(
-						    spareRenderingBuffer[2], numSamples, &unisonParts[u].modulatorPhase[0],
+						    spareRenderingBuffer[2], numSamples, &modulatorOscillators[0].phase[u],
 						    modulatorAmplitudeLastTime[0], phaseIncrementModulator[0],
-						    paramFinalValues[params::LOCAL_MODULATOR_0_FEEDBACK], &unisonParts[u].modulatorFeedback[0],
+						    paramFinalValues[params::LOCAL_MODULATOR_0_FEEDBACK], &modulatorOscillators[0].feedback[u],
 						    true, modulatorAmplitudeIncrements[0]);
 					}
 				}
 				else {
 					if (modulatorsActive[0]) {
 						renderSineWaveWithFeedback(
-						    spareRenderingBuffer[2], numSamples, &unisonParts[u].modulatorPhase[0],
+						    spareRenderingBuffer[2], numSamples, &modulatorOscillators[0].phase[u],
 						    modulatorAmplitudeLastTime[0], phaseIncrementModulator[0],
-						    paramFinalValues[params::LOCAL_MODULATOR_0_FEEDBACK], &unisonParts[u].modulatorFeedback[0],
+						    paramFinalValues[params::LOCAL_MODULATOR_0_FEEDBACK], &modulatorOscillators[0].feedback[u],
 						    false, modulatorAmplitudeIncrements[0]);
 					}
 					else {
@@ -1465,9 +1466,9 @@ noModulatorsActive:
 						for (int32_t s = 0; s < kNumSources; s++) {
 							if (sourceAmplitudes[s]) {
 								renderSineWaveWithFeedback(
-								    fmOscBuffer, numSamples, &unisonParts[u].sources[s].oscPos, sourceAmplitudesNow[s],
+								    fmOscBuffer, numSamples, &sourceOscillators[s].phase[u], sourceAmplitudesNow[s],
 								    phaseIncrements[s], paramFinalValues[params::LOCAL_CARRIER_0_FEEDBACK + s],
-								    &unisonParts[u].sources[s].carrierFeedback, true, sourceAmplitudeIncrements[s]);
+								    &sourceOscillators[s].feedback[u], true, sourceAmplitudeIncrements[s]);
 							}
 						}
 
@@ -1479,10 +1480,10 @@ noModulatorsActive:
 				for (int32_t s = 0; s < kNumSources; s++) {
 					if (sourceAmplitudes[s]) {
 						renderFMWithFeedbackAdd(
-						    fmOscBuffer, numSamples, spareRenderingBuffer[2], &unisonParts[u].sources[s].oscPos,
+						    fmOscBuffer, numSamples, spareRenderingBuffer[2], &sourceOscillators[s].phase[u],
 						    sourceAmplitudesNow[s], phaseIncrements[s],
 						    paramFinalValues[params::LOCAL_CARRIER_0_FEEDBACK + s],
-						    &unisonParts[u].sources[s].carrierFeedback, sourceAmplitudeIncrements[s]);
+						    &sourceOscillators[s].feedback[u], sourceAmplitudeIncrements[s]);
 					}
 				}
 
@@ -1952,6 +1953,17 @@ void Voice::renderBasicSource(Sound& sound, ParamManagerForTimeline* paramManage
 
 	GeneralMemoryAllocator::get().checkStack("Voice::renderBasicSource");
 
+	// Plain table waves going into a mono buffer don't need each unison part to have its own buffer for panning or
+	// sync, so they can all be summed in one pass
+	if (!stereoBuffer && !doOscSync && !getPhaseIncrements && sound.numUnison > 1) {
+		uint32_t pulseWidth = (uint32_t)lshiftAndSaturate<1>(paramFinalValues[params::LOCAL_OSC_A_PHASE_WIDTH + s]);
+		if (dsp::Oscillator::canRenderUnisonBatch(sound.sources[s].oscType, pulseWidth)) {
+			renderBasicSourceUnisonBatch(sound, s, oscBuffer, numSamples, sourceAmplitude, overallPitchAdjust,
+			                             amplitudeIncrement);
+			return;
+		}
+	}
+
 	// For each unison part
 	for (int32_t u = 0; u < sound.numUnison; u++) {
 
@@ -1974,7 +1986,7 @@ instantUnassign:
 			continue;
 		}
 
-		uint32_t phaseIncrement = voiceUnisonPartSource->phaseIncrementStoredValue;
+		uint32_t phaseIncrement = sourceOscillators[s].phaseIncrement[u];
 
 		// Overall pitch adjustment
 		if (!adjustPitch(phaseIncrement, overallPitchAdjust)) {
@@ -1995,7 +2007,7 @@ pitchTooHigh:
 			getPhaseIncrements[u] = phaseIncrement;
 
 			if (getOutAfterPhaseIncrements) {
-				voiceUnisonPartSource->oscPos += phaseIncrement * numSamples;
+				sourceOscillators[s].phase[u] += phaseIncrement * numSamples;
 				continue;
 			}
 		}
@@ -2068,21 +2080,21 @@ pitchTooHigh:
 				// Or, normal - it needs a bit more explanation.
 				else {
 					// We have to ignore any pitch modulation, aka the "patched" value for phaseIncrement: we have to
-					// use phaseIncrementStoredValue instead, which is the pre-modulation/patching value. But we also
+					// use the stored phaseIncrement instead, which is the pre-modulation/patching value. But we also
 					// have to forget about the timeStretchRatio we calculated above with the call to
 					// getPitchAndSpeedParams(), and instead calculate a special version of this with this call to
 					// getSpeedParamForNoSyncing(), which is what getPitchAndSpeedParams() itself calls when not in
 					// STRETCH mode, which we've already determined we're not in, and crucially pass it the not-patched
-					// voiceUnisonPartSource->phaseIncrementStoredValue. This fix was done in September 2020 after bug
+					// sourceOscillators[s].phaseIncrement[u]. This fix was done in September 2020 after bug
 					// report from Clyde.
 					uint32_t timeStretchRatioWithoutModulation = voiceUnisonPartSource->getSpeedParamForNoSyncing(
-					    &sound.sources[s], voiceUnisonPartSource->phaseIncrementStoredValue,
+					    &sound.sources[s], sourceOscillators[s].phaseIncrement[u],
 					    ((SampleHolder*)guides[s].audioFileHolder)->neutralPhaseIncrement);
 
 					// Cool, so now we've got phaseIncrement and timeStretchRatio equivalent values which will indicate
 					// our correct play position into the sample regardless of pitch modulation (almost always vibrato).
 					rawSamplesLate =
-					    ((((uint64_t)voiceSample->pendingSamplesLate * voiceUnisonPartSource->phaseIncrementStoredValue)
+					    ((((uint64_t)voiceSample->pendingSamplesLate * sourceOscillators[s].phaseIncrement[u])
 					      >> 24)
 					     * timeStretchRatioWithoutModulation)
 					    >> 24;
@@ -2429,7 +2441,7 @@ dontUseCache: {}
 
 			dsp::Oscillator::renderOsc(
 			    sound.sources[s].oscType, sourceAmplitude, renderBuffer, oscBufferEnd, numSamples, phaseIncrement,
-			    pulseWidth, &unisonParts[u].sources[s].oscPos, true, amplitudeIncrement, doOscSync,
+			    pulseWidth, &sourceOscillators[s].phase[u], true, amplitudeIncrement, doOscSync,
 			    oscSyncPosThisUnison, oscSyncPhaseIncrementsThisUnison, oscRetriggerPhase, waveIndexIncrement,
 			    sourceWaveIndexesLastTime[s], static_cast<WaveTable*>(guides[s].audioFileHolder->audioFile));
 
@@ -2444,6 +2456,46 @@ dontUseCache: {}
 	}
 }
 
+void Voice::renderBasicSourceUnisonBatch(Sound& sound, int32_t s, int32_t* __restrict__ oscBuffer, int32_t numSamples,
+                                         int32_t sourceAmplitude, int32_t overallPitchAdjust,
+                                         int32_t amplitudeIncrement) {
+	UnisonOscillatorState& oscillators = sourceOscillators[s];
+
+	// Gather the parts that are actually going to sound, with their pitch adjustments applied
+	std::array<uint32_t, kMaxNumVoicesUnison> phaseIncrements;
+	std::array<uint32_t, kMaxNumVoicesUnison> phases;
+	std::array<int32_t, kMaxNumVoicesUnison> partIndexes;
+	int32_t numParts = 0;
+
+	for (int32_t u = 0; u < sound.numUnison; u++) {
+		if (!unisonParts[u].sources[s].active) {
+			continue;
+		}
+
+		uint32_t phaseIncrement = oscillators.phaseIncrement[u];
+		if (!adjustPitch(phaseIncrement, overallPitchAdjust)
+		    || !adjustPitch(phaseIncrement, paramFinalValues[params::LOCAL_OSC_A_PITCH_ADJUST + s])) {
+			continue;
+		}
+
+		phaseIncrements[numParts] = phaseIncrement;
+		phases[numParts] = oscillators.phase[u];
+		partIndexes[numParts] = u;
+		numParts++;
+	}
+
+	if (!numParts) {
+		return;
+	}
+
+	dsp::Oscillator::renderOscUnison(sound.sources[s].oscType, sourceAmplitude, oscBuffer, oscBuffer + numSamples,
+	                                 numSamples, phaseIncrements.data(), phases.data(), numParts, amplitudeIncrement);
+
+	for (int32_t i = 0; i < numParts; i++) {
+		oscillators.phase[partIndexes[i]] = phases[i];
+	}
+}
+
 bool Voice::doFastRelease(uint32_t releaseIncrement) {
 	if (doneFirstRender) {
 		envelopes[0].unconditionalRelease(EnvelopeStage::FAST_RELEASE, releaseIncrement);
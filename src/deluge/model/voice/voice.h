@@ -36,7 +36,11 @@ public:
 
 	Patcher patcher;
 
-	// Stores all oscillator positions and stuff, for each Source within each Unison too
+	// Hot oscillator state, one entry per Source / FM modulator, each holding every unison part side by side
+	UnisonOscillatorState sourceOscillators[kNumSources];
+	UnisonOscillatorState modulatorOscillators[kNumModulators];
+
+	// Stores the rest of the per-unison state (sample readers, live pitch shifters, DX voices), for each Source
 	VoiceUnisonPart unisonParts[kMaxNumVoicesUnison];
 
 	// Stores overall info on each Source (basically just sample memory bounds), for the play-through associated with
@@ -131,6 +135,8 @@ private:
 	                       bool* unisonPartBecameInactive, int32_t overallPitchAdjust, bool doOscSync,
 	                       uint32_t* oscSyncPos, uint32_t* oscSyncPhaseIncrements, int32_t amplitudeIncrement,
 	                       uint32_t* getPhaseIncrements, bool getOutAfterPhaseIncrements, int32_t waveIndexIncrement);
+	void renderBasicSourceUnisonBatch(Sound& sound, int32_t s, int32_t* oscBuffer, int32_t numSamples,
+	                                  int32_t sourceAmplitude, int32_t overallPitchAdjust, int32_t amplitudeIncrement);
 	static bool adjustPitch(uint32_t& phaseIncrement, int32_t adjustment);
 
 	void renderSineWaveWithFeedback(int32_t* thisSample, int32_t numSamples, uint32_t* phase, int32_t amplitude,
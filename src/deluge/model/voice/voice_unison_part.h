@@ -19,10 +19,18 @@
 
 #include "definitions_cxx.hpp"
 #include "model/voice/voice_unison_part_source.h"
+#include <array>
+
+/// The per-sample oscillator state of one source (or FM modulator) for every unison part. This is kept as a
+/// structure of arrays rather than inside each VoiceUnisonPart so that the state of all unison parts is contiguous
+/// and can be loaded into vector lanes together.
+struct UnisonOscillatorState {
+	// FKA oscPos. Not used for Sample playback / rate conversion position - only waves, including wavetable.
+	alignas(16) std::array<uint32_t, kMaxNumVoicesUnison> phase;
+	alignas(16) std::array<uint32_t, kMaxNumVoicesUnison> phaseIncrement;
+	alignas(16) std::array<int32_t, kMaxNumVoicesUnison> feedback;
+};
 
 struct VoiceUnisonPart {
-	uint32_t modulatorPhase[kNumModulators];
-	uint32_t modulatorPhaseIncrement[kNumModulators];
-	int32_t modulatorFeedback[kNumModulators];
 	VoiceUnisonPartSource sources[kNumSources];
 };
@@ -30,7 +30,7 @@
 
 bool VoiceUnisonPartSource::noteOn(Voice* voice, Source* source, VoiceSamplePlaybackGuide* guide, uint32_t samplesLate,
                                    uint32_t oscRetriggerPhase, bool resetEverything, SynthMode synthMode,
-                                   uint8_t velocity) {
+                                   uint8_t velocity, uint32_t& oscPos, int32_t& carrierFeedback) {
 
 	if (synthMode != SynthMode::FM && source->oscType == OscType::SAMPLE) {
 
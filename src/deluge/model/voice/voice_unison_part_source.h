@@ -32,16 +32,14 @@ class VoiceUnisonPartSource {
 public:
 	VoiceUnisonPartSource() = default;
 	bool noteOn(Voice* voice, Source* source, VoiceSamplePlaybackGuide* voiceSource, uint32_t samplesLate,
-	            uint32_t oscPhase, bool resetEverything, SynthMode synthMode, uint8_t velocity);
+	            uint32_t oscPhase, bool resetEverything, SynthMode synthMode, uint8_t velocity, uint32_t& oscPos,
+	            int32_t& carrierFeedback);
 	void unassign(bool deletingSong);
 	bool getPitchAndSpeedParams(Source* source, VoiceSamplePlaybackGuide* voiceSource, uint32_t* phaseIncrement,
 	                            uint32_t* timeStretchRatio, uint32_t* noteLengthInSamples);
 	uint32_t getSpeedParamForNoSyncing(Source* source, int32_t phaseIncrement, int32_t pitchAdjustNeutralValue);
 
-	uint32_t oscPos; // FKA phase. No longer used for Sample playback / rate conversion position. Only waves, including
-	                 // wavetable.
-	uint32_t phaseIncrementStoredValue;
-	int32_t carrierFeedback;
+	// Oscillator phase, phase increment and carrier feedback live in Voice::sourceOscillators
 	bool active;
 	VoiceSample* voiceSample = nullptr;
 	LivePitchShifter* livePitchShifter = nullptr;
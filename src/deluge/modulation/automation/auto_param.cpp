@@ -32,6 +32,7 @@
 #include "model/settings/runtime_feature_settings.h"
 #include "model/song/song.h"
 #include "modulation/automation/copied_param_automation.h"
+#include "modulation/automation/interpolation_step.h"
 #include "modulation/params/param_collection.h"
 #include "modulation/params/param_node.h"
 #include "playback/mode/playback_mode.h"
@@ -827,23 +828,30 @@ void AutoParam::setupInterpolation(ParamNode* nextNodeInOurDirection, int32_t ef
 	}
 }
 
+// Advances any interpolation by a whole window at once - see getInterpolationIncrement().
 // Returns whether a change was made to currentValue
 bool AutoParam::tickSamples(int32_t numSamples) {
 	if (!valueIncrementPerHalfTick) {
 		return false;
 	}
 
-	int32_t oldValue = currentValue;
-	currentValue +=
-	    multiply_32x32_rshift32_rounded(valueIncrementPerHalfTick, playbackHandler.getTimePerInternalTickInverse()) * 6
-	    * numSamples;
+	int64_t increment = getInterpolationIncrement(valueIncrementPerHalfTick,
+	                                              playbackHandler.getTimePerInternalTickInverse(), numSamples);
+
+	if (!increment) {
+		return false;
+	}
+
+	int64_t newValue = (int64_t)currentValue + increment;
 
 	// Ensure no overflow
-	bool overflowOccurred = (valueIncrementPerHalfTick >= 0) ? (currentValue < oldValue) : (currentValue > oldValue);
-	if (overflowOccurred) {
+	if (newValue > 2147483647 || newValue < -2147483648) {
 		currentValue = (valueIncrementPerHalfTick >= 0) ? 2147483647 : -2147483648;
 		valueIncrementPerHalfTick = 0;
 	}
+	else {
+		currentValue = newValue;
+	}
 
 	return true;
 }
@@ -0,0 +1,38 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/// Shifts a 16.16 fixed point number down to a whole one, rounding to nearest with halves away from 0, so that a
+/// falling ramp moves exactly as far as the matching rising one
+inline int64_t roundedFromFixed16(int64_t value) {
+	return (value >= 0) ? ((value + (1 << 15)) >> 16) : -((-value + (1 << 15)) >> 16);
+}
+
+/// How far an interpolating AutoParam moves over one window of samples, rounded to the nearest unit of the value.
+/// Whatever rounds away isn't carried over to the next window: a unit is 2^-32 of a param's range, so a ramp slow
+/// enough to lose anything that matters would take the best part of a year to cross it.
+///
+/// timePerInternalTickInverse is as given by PlaybackHandler::getTimePerInternalTickInverse(), and there are 6 half
+/// ticks' worth of samples per (sample times that inverse), as AutoParam has always counted them.
+inline int64_t getInterpolationIncrement(int32_t valueIncrementPerHalfTick, uint32_t timePerInternalTickInverse,
+                                         int32_t numSamples) {
+	int64_t incrementPerSample = roundedFromFixed16((int64_t)valueIncrementPerHalfTick * timePerInternalTickInverse);
+	return roundedFromFixed16(incrementPerSample * 6 * numSamples);
+}
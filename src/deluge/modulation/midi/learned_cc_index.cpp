@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "modulation/midi/learned_cc_index.h"
+#include <utility>
+
+LearnedCCIndex learnedCCIndex{};
+
+uint32_t LearnedCCIndex::generation = 1;
+
+void LearnedCCIndex::startBuilding(Song const* song) {
+	builtForSong = song;
+	builtGeneration = generation;
+	numTargets = 0;
+	overflowed = false;
+}
+
+void LearnedCCIndex::add(uint8_t channel, uint8_t ccNumber, Target const& target) {
+	if (numTargets == kMaxTargets) {
+		overflowed = true;
+		return;
+	}
+	targets[numTargets] = target;
+	keys[numTargets] = getKey(channel, ccNumber);
+	numTargets++;
+}
+
+void LearnedCCIndex::finishBuilding() {
+	// Counting sort. First count each key's targets, and turn those counts into where each key's targets start
+	firstEntry.fill(0);
+	for (int32_t i = 0; i < numTargets; i++) {
+		firstEntry[keys[i]]++;
+	}
+	uint16_t start = 0;
+	for (int32_t key = 0; key < kNumKeys; key++) {
+		uint16_t count = firstEntry[key];
+		firstEntry[key] = start;
+		start += count;
+	}
+
+	// Work out where each target goes, keeping the order they were added in within each key. This leaves each key's
+	// entry pointing at the start of the next key, so shift them all along one afterwards
+	for (int32_t i = 0; i < numTargets; i++) {
+		keys[i] = firstEntry[keys[i]]++;
+	}
+	for (int32_t key = kNumKeys; key > 0; key--) {
+		firstEntry[key] = firstEntry[key - 1];
+	}
+	firstEntry[0] = 0;
+
+	// And move them there, in place, one cycle of the permutation at a time
+	for (int32_t i = 0; i < numTargets; i++) {
+		while (keys[i] != i) {
+			uint16_t destination = keys[i];
+			std::swap(targets[i], targets[destination]);
+			std::swap(keys[i], keys[destination]);
+		}
+	}
+}
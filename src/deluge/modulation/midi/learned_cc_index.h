@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+class Drum;
+class ModControllableAudio;
+class Output;
+class Song;
+
+/// Maps an incoming (channel, CC) straight to the ModControllableAudios with a knob learned to it, so a CC doesn't
+/// have to be offered to every knob of every Output in the Song. Cable matching is still left to the knobs
+/// themselves, as a knob learned without a cable (or with inputs not differentiated by device) matches any of them.
+///
+/// Rather than being patched up in place, the index is rebuilt the next time it's needed after anything calls
+/// invalidate() - learning or unlearning a knob, reading or cloning knobs, or Outputs and Drums being added to or
+/// removed from the Song.
+class LearnedCCIndex {
+public:
+	struct Target {
+		Output* output;
+		ModControllableAudio* modControllable;
+		/// Set if modControllable is a Drum, whose NoteRow in the Output's activeClip then has to be found
+		Drum* drum;
+	};
+
+	static constexpr int32_t kMaxTargets = 512;
+
+	static void invalidate() { generation++; }
+	bool needsRebuilding(Song const* song) const { return song != builtForSong || builtGeneration != generation; }
+
+	void startBuilding(Song const* song);
+	/// Targets for the same (channel, CC) are handed back in the order they were added. Anything that doesn't fit
+	/// leaves the index overflowed, in which case the caller has to go back to offering CCs to everything.
+	void add(uint8_t channel, uint8_t ccNumber, Target const& target);
+	void finishBuilding();
+
+	bool hasOverflowed() const { return overflowed; }
+	std::span<Target const> getTargets(uint8_t channel, uint8_t ccNumber) const {
+		int32_t key = getKey(channel, ccNumber);
+		return {targets.data() + firstEntry[key], targets.data() + firstEntry[key + 1]};
+	}
+
+private:
+	static constexpr int32_t kNumKeys = 16 * 128;
+	static int32_t getKey(uint8_t channel, uint8_t ccNumber) { return (channel << 7) | ccNumber; }
+
+	static uint32_t generation;
+
+	std::array<Target, kMaxTargets> targets;
+	/// Each target's key while building, then where it needs to move to when they're sorted
+	std::array<uint16_t, kMaxTargets> keys;
+	std::array<uint16_t, kNumKeys + 1> firstEntry{};
+	int32_t numTargets = 0;
+	Song const* builtForSong = nullptr;
+	uint32_t builtGeneration = 0;
+	bool overflowed = false;
+};
+
+extern LearnedCCIndex learnedCCIndex;
@@ -140,7 +140,7 @@ void ParamSet::tickSamples(int32_t numSamples, ModelStackWithParamCollection* mo
 
 	int32_t oldValue = param->getCurrentValue();
 	bool shouldNotify = param->tickSamples(numSamples);
-	if (shouldNotify) { // Should always actually be true...
+	if (shouldNotify) { // Not if this window's share of a very slow ramp came to nothing
 		ModelStackWithAutoParam* modelStackWithAutoParam = modelStack->addAutoParam(p, param);
 		notifyParamModifiedInSomeWay(modelStackWithAutoParam, oldValue, false, true, true);
 	}
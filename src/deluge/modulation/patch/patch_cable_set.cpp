@@ -566,7 +566,7 @@ void PatchCableSet::tickSamples(int32_t numSamples, ModelStackWithParamCollectio
 
 	int32_t oldValue = param->getCurrentValue();
 	bool shouldNotify = param->tickSamples(numSamples);
-	if (shouldNotify) { // Should always actually be true...
+	if (shouldNotify) { // Not if this window's share of a very slow ramp came to nothing
 		notifyParamModifiedInSomeWay(modelStackWithAutoParam, oldValue, false, true, true);
 	}
 
@@ -34,7 +34,10 @@ SideChain::SideChain() {
 	// current song, or even better the one being preloaded. Default sync level is used obviously for the default synth
 	// sound if no SD card inserted, but also some synth presets, possibly just older ones, are saved without this so it
 	// can be set to the default at the time of loading.
-	Song* song = preLoadedSong;
+	Song* song = songBeingPreloaded;
+	if (!song) {
+		song = preLoadedSong;
+	}
 	if (!song) {
 		song = currentSong;
 	}
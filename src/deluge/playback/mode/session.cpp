@@ -2432,13 +2432,34 @@ void Session::doTickForward(int32_t posIncrement) {
 				clip = clip->output->getActiveClip();
 			}
 
+			int64_t now = playbackHandler.lastSwungTickActioned;
+			int32_t ticksSinceLast = posIncrement;
+
+			// Sparse InstrumentClips can be left alone until they next have something to do, so long as nothing has
+			// processed them or called expectEvent() on them since that was worked out. Their NoteRows and
+			// ParamManagers catch up on the ticks skipped once they are processed
+			if (clip->type == ClipType::INSTRUMENT && clip->eventSchedule.isWorkedOut()) {
+				int64_t ticksTilDue = clip->eventSchedule.ticksTilDue(now);
+				if (ticksTilDue > 0) {
+					playbackHandler.swungTicksTilNextEvent =
+					    std::min<int64_t>(ticksTilDue, playbackHandler.swungTicksTilNextEvent);
+					continue;
+				}
+				ticksSinceLast = clip->eventSchedule.ticksSinceProcessed(now);
+			}
+
 			ModelStackWithTimelineCounter* modelStackWithTimelineCounter = modelStack->addTimelineCounter(clip);
 
+			// Work out this Clip's own next event on its own, but still with the others'
+			int32_t swungTicksTilOtherEvents = playbackHandler.swungTicksTilNextEvent;
+			playbackHandler.swungTicksTilNextEvent = 2147483647;
+			clip->eventSchedule.beginWorkingOut(now); // Unless processing calls expectEvent()
+
 			// No need to do the actual incrementing - that's been done for all Clips (except ones which have only just
 			// launched), up in considerLaunchEvent()
 
 			// May create new Clip and put it in the ModelStack - we'll check below.
-			clip->processCurrentPos(modelStackWithTimelineCounter, posIncrement);
+			clip->processCurrentPos(modelStackWithTimelineCounter, ticksSinceLast);
 
 			// NOTE: posIncrement is the number of ticks which we incremented by in considerLaunchEvent(). But for Clips
 			// which were only just launched in there, well the won't have been incremented, so it would be more correct
@@ -2455,6 +2476,10 @@ void Session::doTickForward(int32_t posIncrement) {
 					view.activeModControllableModelStack.paramManager = &newClip->paramManager;
 				}
 			}
+
+			clip->eventSchedule.workedOut(now, playbackHandler.swungTicksTilNextEvent);
+			playbackHandler.swungTicksTilNextEvent =
+			    std::min(swungTicksTilOtherEvents, playbackHandler.swungTicksTilNextEvent);
 		}
 	}
 
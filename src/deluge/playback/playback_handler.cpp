@@ -59,6 +59,7 @@
 #include "model/settings/runtime_feature_settings.h"
 #include "model/song/song.h"
 #include "model/sync.h"
+#include "modulation/midi/learned_cc_index.h"
 #include "playback/mode/arrangement.h"
 #include "playback/mode/session.h"
 #include "processing/audio_output.h"
@@ -128,6 +129,8 @@ void PlaybackHandler::midiRoutine() {
 	for (int32_t i = 0; i < 12 && midiEngine.checkIncomingSerialMidi(); i++) {
 		;
 	}
+
+	midiEngine.dispatchQueuedMidiMessages();
 }
 
 // This function will be called repeatedly, at all times, to see if it's time to do a tick, and such
@@ -3061,29 +3064,110 @@ void PlaybackHandler::midiCCReceived(MIDICable& cable, uint8_t channel, uint8_t
 		}
 	}
 
+	// See if it's learned to a parameter
+	if (!isMPE) {
+		offerReceivedCCToLearnedParams(cable, channel, ccNumber, value, modelStack);
+	}
+
 	// Go through all Outputs...
 	for (Output* thisOutput = currentSong->firstOutput; thisOutput; thisOutput = thisOutput->next) {
-
-		// If it has an activeClip... (Hmm, interesting, we don't allow MIDI control of params when no activeClip?
-		// Yeah this checks out, as the various offerReceivedCCToLearnedParams()'s require a timelineCounter, but
-		// this seems restrictive for the user...)
 		if (thisOutput->getActiveClip()) {
-
 			ModelStackWithTimelineCounter* modelStackWithTimelineCounter =
 			    modelStack->addTimelineCounter(thisOutput->getActiveClip());
+			thisOutput->offerReceivedCC(modelStackWithTimelineCounter, cable, channel, ccNumber, value, doingMidiThru);
+		}
+	}
+}
 
-			if (!isMPE) {
-				// See if it's learned to a parameter
+// Only offers the CC to the ModControllableAudios with a knob learned to its channel and number, rather than to every
+// knob in the Song
+void PlaybackHandler::offerReceivedCCToLearnedParams(MIDICable& cable, uint8_t channel, uint8_t ccNumber,
+                                                     uint8_t value, ModelStack* modelStack) {
+	if (learnedCCIndex.needsRebuilding(currentSong)) {
+		rebuildLearnedCCIndex();
+	}
+
+	if (learnedCCIndex.hasOverflowed()) {
+		for (Output* thisOutput = currentSong->firstOutput; thisOutput; thisOutput = thisOutput->next) {
+			if (thisOutput->getActiveClip()) {
+				ModelStackWithTimelineCounter* modelStackWithTimelineCounter =
+				    modelStack->addTimelineCounter(thisOutput->getActiveClip());
 				// NOTE: this call may change modelStackWithTimelineCounter->timelineCounter etc!
 				thisOutput->offerReceivedCCToLearnedParams(cable, channel, ccNumber, value,
 				                                           modelStackWithTimelineCounter);
 			}
+		}
+		return;
+	}
 
-			thisOutput->offerReceivedCC(modelStackWithTimelineCounter, cable, channel, ccNumber, value, doingMidiThru);
+	for (LearnedCCIndex::Target const& target : learnedCCIndex.getTargets(channel, ccNumber)) {
+		// If it has an activeClip... (Hmm, interesting, we don't allow MIDI control of params when no activeClip?
+		// Yeah this checks out, as offerReceivedCCToLearnedParamsForClip() requires a timelineCounter, but this seems
+		// restrictive for the user...). Fetched again for each target, as an earlier one might have cloned it for
+		// arrangement recording
+		Clip* clip = target.output->getActiveClip();
+		if (!clip) {
+			continue;
 		}
+
+		int32_t noteRowIndex = -1;
+		if (target.drum && !((InstrumentClip*)clip)->getNoteRowForDrum(target.drum, &noteRowIndex)) {
+			continue;
+		}
+
+		ModelStackWithTimelineCounter* modelStackWithTimelineCounter = modelStack->addTimelineCounter(clip);
+		// NOTE: this call may change modelStackWithTimelineCounter->timelineCounter etc!
+		target.modControllable->offerReceivedCCToLearnedParamsForClip(cable, channel, ccNumber, value,
+		                                                              modelStackWithTimelineCounter, noteRowIndex);
 	}
 }
 
+static void addKnobsToLearnedCCIndex(Output* output, ModControllableAudio* modControllable, Drum* drum) {
+	MidiKnobArray& knobs = modControllable->midiKnobArray;
+	for (int32_t k = 0; k < knobs.getNumElements(); k++) {
+		LearnedMIDI& midiInput = knobs.getElement(k)->midiInput;
+
+		// MPE zones and 14-bit knobs never match a CC number
+		if (midiInput.channelOrZone >= 16 || midiInput.noteOrCC >= 128) {
+			continue;
+		}
+
+		// The ModControllableAudio deals with all its knobs for a CC at once, so only needs to be in there once for it
+		bool alreadyAdded = false;
+		for (int32_t j = 0; j < k; j++) {
+			LearnedMIDI& earlierInput = knobs.getElement(j)->midiInput;
+			if (earlierInput.channelOrZone == midiInput.channelOrZone && earlierInput.noteOrCC == midiInput.noteOrCC) {
+				alreadyAdded = true;
+				break;
+			}
+		}
+		if (!alreadyAdded) {
+			learnedCCIndex.add(midiInput.channelOrZone, midiInput.noteOrCC, {output, modControllable, drum});
+		}
+	}
+}
+
+void PlaybackHandler::rebuildLearnedCCIndex() {
+	learnedCCIndex.startBuilding(currentSong);
+
+	for (Output* thisOutput = currentSong->firstOutput; thisOutput; thisOutput = thisOutput->next) {
+		if (thisOutput->type == OutputType::SYNTH || thisOutput->type == OutputType::AUDIO) {
+			addKnobsToLearnedCCIndex(thisOutput, (ModControllableAudio*)thisOutput->toModControllable(), nullptr);
+		}
+		else if (thisOutput->type == OutputType::KIT) {
+			Kit* kit = (Kit*)thisOutput;
+			addKnobsToLearnedCCIndex(kit, (ModControllableAudio*)kit->toModControllable(), nullptr);
+			for (Drum* drum = kit->firstDrum; drum; drum = drum->next) {
+				if (drum->type == DrumType::SOUND) {
+					addKnobsToLearnedCCIndex(kit, (SoundDrum*)drum, drum);
+				}
+			}
+		}
+	}
+
+	learnedCCIndex.finishBuilding();
+}
+
 // noteCode -1 means channel-wide, including for MPE input (which then means it could still then just apply to one
 // note).
 void PlaybackHandler::aftertouchReceived(MIDICable& cable, int32_t channel, int32_t value, int32_t noteCode,
@@ -40,6 +40,7 @@ class Clip;
 class InstrumentClip;
 class Kit;
 class MIDICable;
+class ModelStack;
 class NoteRow;
 class Song;
 
@@ -263,6 +264,9 @@ private:
 	bool startIgnoringMidiClockInputIfNecessary();
 	uint32_t setTempoFromAudioClipLength(uint64_t loopLengthSamples, Action* action);
 	bool offerNoteToLearnedThings(MIDICable& cable, bool on, int32_t channel, int32_t note);
+	void offerReceivedCCToLearnedParams(MIDICable& cable, uint8_t channel, uint8_t ccNumber, uint8_t value,
+	                                    ModelStack* modelStack);
+	void rebuildLearnedCCIndex();
 	bool tryGlobalMIDICommands(MIDICable& cable, int32_t channel, int32_t note);
 	bool tryGlobalMIDICommandsOff(MIDICable& cable, int32_t channel, int32_t note);
 	void decideOnCurrentPlaybackMode();
@@ -45,6 +45,7 @@
 #include "modulation/patch/patch_cable_set.h"
 #include "processing/audio_output.h"
 #include "processing/engines/cv_engine.h"
+#include "processing/engines/render_breakdown.h"
 #include "processing/live/live_input_buffer.h"
 #include "processing/metronome/metronome.h"
 #include "processing/sound/sound.h"
@@ -130,6 +131,9 @@ constexpr int32_t direnessThreshold = numSamplesLimit - 30;
 // to the limit
 constexpr int MIN_VOICES = 7;
 
+// roughly every 10 seconds at typical window lengths
+constexpr uint32_t kRenderBreakdownReportWindows = 16384;
+
 dsp::Reverb reverb{};
 PLACE_INTERNAL_FRUNK SideChain reverbSidechain{};
 int32_t reverbSidechainVolume;
@@ -239,6 +243,10 @@ void init() {
 		staticVoices[i].nextUnassigned = (i == kNumVoicesStatic - 1) ? NULL : &staticVoices[i + 1];
 	}
 
+#if RENDER_BREAKDOWN_ENABLED
+	renderBreakdown.reportInterval = kRenderBreakdownReportWindows;
+#endif
+
 	i2sTXBufferPos = (uint32_t)getTxBufferStart();
 
 	i2sRXBufferPos = (uint32_t)getRxBufferStart()
@@ -678,6 +686,10 @@ void renderAudio(size_t numSamples) {
 	std::span renderingBuffer{renderingMemory.data(), numSamples};
 	std::span reverbBuffer{reverbMemory.data(), numSamples};
 
+#if RENDER_BREAKDOWN_ENABLED
+	renderBreakdown.beginWindow(numSamples);
+#endif
+
 	memset(&renderingMemory, 0, renderingBuffer.size_bytes());
 	memset(&reverbMemory, 0, reverbBuffer.size_bytes());
 
@@ -690,7 +702,7 @@ void renderAudio(size_t numSamples) {
 
 	// Render audio for song
 	if (currentSong) {
-
+		TIME_RENDER_STAGE(SONG);
 		currentSong->renderAudio(renderingBuffer, reverbBuffer.data(), sideChainHitPending);
 	}
 
@@ -708,6 +720,10 @@ void renderAudio(size_t numSamples) {
 
 	renderingBufferOutputPos = renderingMemory.begin();
 	renderingBufferOutputEnd = renderingMemory.begin() + numSamples;
+
+#if RENDER_BREAKDOWN_ENABLED
+	renderBreakdown.endWindow();
+#endif
 }
 
 void renderAudioForStemExport(size_t numSamples) {
@@ -858,6 +874,7 @@ void feedReverbBackdoorForGrain(int index, q31_t value) {
 	reverbMemory[index] += value;
 }
 void renderReverb(size_t numSamples) {
+	TIME_RENDER_STAGE(REVERB);
 	std::span renderingBuffer{renderingMemory.data(), numSamples};
 	std::span reverbBuffer{reverbMemory.data(), numSamples};
 
@@ -908,6 +925,7 @@ void renderReverb(size_t numSamples) {
 	}
 }
 void renderSamplePreview(size_t numSamples) { // Previewing sample
+	TIME_RENDER_STAGE(SAMPLE_PREVIEW);
 	std::span renderingBuffer{renderingMemory.data(), numSamples};
 	std::span reverbBuffer{reverbMemory.data(), numSamples};
 
@@ -923,6 +941,7 @@ void renderSamplePreview(size_t numSamples) { // Previewing sample
 }
 void renderSongFX(size_t numSamples) { // LPF and stutter for song (must happen after reverb mixed in, which is why it's
 	                                   // happening all the way out here
+	TIME_RENDER_STAGE(SONG_FX);
 	std::span renderingBuffer{renderingMemory.data(), numSamples};
 	std::span reverbBuffer{reverbMemory.data(), numSamples};
 
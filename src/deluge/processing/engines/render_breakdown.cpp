@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "processing/engines/render_breakdown.h"
+#include "OSLikeStuff/timers_interrupts/clock_type.h"
+#include "io/debug/log.h"
+#include <algorithm>
+
+namespace AudioEngine {
+
+RenderBreakdown renderBreakdown{};
+
+const char* renderStageToString(RenderStage stage) {
+	switch (stage) {
+	case RenderStage::SONG:
+		return "song";
+	case RenderStage::SOUND:
+		return "sound";
+	case RenderStage::VOICES:
+		return "voices";
+	case RenderStage::SIDECHAIN:
+		return "sidechain";
+	case RenderStage::COMPRESSOR:
+		return "compressor";
+	case RenderStage::REVERB:
+		return "reverb";
+	case RenderStage::SAMPLE_PREVIEW:
+		return "sample preview";
+	case RenderStage::SONG_FX:
+		return "song fx";
+	default:
+		return "";
+	}
+}
+
+void RenderBreakdown::beginWindow(uint32_t numSamples) {
+	for (auto& stage : stats_) {
+		stage.lastWindow = 0;
+	}
+	numSamples_ += numSamples;
+	windowStart_ = getTimerValue(0);
+}
+
+void RenderBreakdown::endWindow() {
+	windowTotal_ = getTimerValue(0) - windowStart_;
+	maxWindowTotal_ = std::max(maxWindowTotal_, windowTotal_);
+	for (auto& stage : stats_) {
+		stage.total += stage.lastWindow;
+		stage.max = std::max(stage.max, stage.lastWindow);
+	}
+	numWindows_++;
+
+	if (reportInterval != 0 && numWindows_ >= reportInterval) {
+		print();
+		reset();
+	}
+}
+
+float RenderBreakdown::getTicksPerSample(RenderStage stage) const {
+	if (numSamples_ == 0) {
+		return 0;
+	}
+	return static_cast<float>(getStats(stage).total) / static_cast<float>(numSamples_);
+}
+
+void RenderBreakdown::print() const {
+	if (numWindows_ == 0) {
+		return;
+	}
+	// Everything is reported in microseconds
+	constexpr float scale = 1000000.0f / DELUGE_CLOCKS_PERf;
+	D_PRINTLN("Render breakdown over %d windows, %d samples (avg / max us per window, us per sample):", numWindows_,
+	          static_cast<int32_t>(numSamples_));
+	for (int32_t s = 0; s < kNumRenderStages; s++) {
+		const StageStats& stage = stats_[s];
+		D_PRINTLN("%16s: %9.2f / %9.2f, %7.3f", renderStageToString(static_cast<RenderStage>(s)),
+		          scale * static_cast<float>(stage.total) / static_cast<float>(numWindows_), scale * stage.max,
+		          scale * getTicksPerSample(static_cast<RenderStage>(s)));
+	}
+	D_PRINTLN("Longest window: %9.2f us", scale * maxWindowTotal_);
+}
+
+void RenderBreakdown::reset() {
+	stats_ = {};
+	windowTotal_ = 0;
+	maxWindowTotal_ = 0;
+	numWindows_ = 0;
+	numSamples_ = 0;
+}
+
+} // namespace AudioEngine
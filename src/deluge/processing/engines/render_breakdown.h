@@ -0,0 +1,121 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+extern "C" {
+#include "RZA1/ostm/ostm.h"
+}
+
+// Per-stage accounting of where the audio routine spends its time. Compiled into debug builds by default since it
+// costs two timer reads per stage per window.
+#ifndef RENDER_BREAKDOWN_ENABLED
+#define RENDER_BREAKDOWN_ENABLED (ENABLE_TEXT_OUTPUT || IN_UNIT_TESTS)
+#endif
+
+namespace AudioEngine {
+
+/// Stages are measured inclusively - VOICES time is also counted within SOUND, and SOUND within SONG.
+enum class RenderStage : uint8_t {
+	SONG,
+	SOUND,
+	VOICES,
+	SIDECHAIN,
+	COMPRESSOR,
+	REVERB,
+	SAMPLE_PREVIEW,
+	SONG_FX,
+	kNumStages,
+};
+
+constexpr int32_t kNumRenderStages = static_cast<int32_t>(RenderStage::kNumStages);
+
+const char* renderStageToString(RenderStage stage);
+
+/// Accumulates timer ticks (OSTM, 33.33MHz) per render stage, per window and over a reporting period.
+class RenderBreakdown {
+public:
+	struct StageStats {
+		uint32_t lastWindow{0};
+		uint64_t total{0};
+		uint32_t max{0};
+	};
+
+	/// Call at the start of each render window, before any stage is timed
+	void beginWindow(uint32_t numSamples);
+	/// Call once the window has been fully rendered
+	void endWindow();
+
+	[[gnu::always_inline]] void add(RenderStage stage, uint32_t ticks) {
+		stats_[static_cast<int32_t>(stage)].lastWindow += ticks;
+	}
+
+	[[nodiscard]] const StageStats& getStats(RenderStage stage) const { return stats_[static_cast<int32_t>(stage)]; }
+	[[nodiscard]] uint32_t getNumWindows() const { return numWindows_; }
+	[[nodiscard]] uint64_t getNumSamples() const { return numSamples_; }
+	[[nodiscard]] uint32_t getLastWindowTotal() const { return windowTotal_; }
+
+	/// Average ticks spent in a stage per rendered sample, which is what voice-count regressions show up in
+	[[nodiscard]] float getTicksPerSample(RenderStage stage) const;
+
+	void print() const;
+	void reset();
+
+	/// Windows between automatic prints from endWindow(). 0 disables printing.
+	uint32_t reportInterval{0};
+
+private:
+	std::array<StageStats, kNumRenderStages> stats_{};
+	uint32_t windowStart_{0};
+	uint32_t windowTotal_{0};
+	uint32_t maxWindowTotal_{0};
+	uint32_t numWindows_{0};
+	uint64_t numSamples_{0};
+};
+
+extern RenderBreakdown renderBreakdown;
+
+/// Times the enclosing scope and adds it to the given stage of renderBreakdown
+class ScopedRenderStageTimer {
+public:
+	[[gnu::always_inline]] explicit ScopedRenderStageTimer(RenderStage stage)
+	    : stage_(stage), start_(getTimerValue(0)) {}
+	[[gnu::always_inline]] ~ScopedRenderStageTimer() { renderBreakdown.add(stage_, getTimerValue(0) - start_); }
+
+	ScopedRenderStageTimer(const ScopedRenderStageTimer&) = delete;
+	ScopedRenderStageTimer& operator=(const ScopedRenderStageTimer&) = delete;
+
+private:
+	RenderStage stage_;
+	uint32_t start_;
+};
+
+} // namespace AudioEngine
+
+#if RENDER_BREAKDOWN_ENABLED
+#define RENDER_STAGE_CONCAT_(a, b) a##b
+#define RENDER_STAGE_CONCAT(a, b) RENDER_STAGE_CONCAT_(a, b)
+#define TIME_RENDER_STAGE(stage)                                                                                       \
+	AudioEngine::ScopedRenderStageTimer RENDER_STAGE_CONCAT(renderStageTimer, __LINE__) {                              \
+		AudioEngine::RenderStage::stage                                                                                \
+	}
+#else
+#define TIME_RENDER_STAGE(stage)
+#endif
@@ -48,6 +48,7 @@
 #include "modulation/patch/patcher.h"
 #include "playback/playback_handler.h"
 #include "processing/engines/audio_engine.h"
+#include "processing/engines/render_breakdown.h"
 #include "processing/sound/sound_instrument.h"
 #include "storage/audio/audio_file_manager.h"
 #include "storage/flash_storage.h"
@@ -55,6 +56,7 @@
 #include "storage/multi_range/multisample_range.h"
 #include "storage/storage_manager.h"
 #include "util/comparison.h"
+#include "util/container/tag_table.h"
 #include "util/firmware_version.h"
 #include "util/functions.h"
 #include "util/misc.h"
@@ -456,31 +458,46 @@ void Sound::recalculatePatchingToParam(uint8_t p, ParamManagerForTimeline* param
 	ParamCollectionSummary* patchedParamsSummary = paramManager->getPatchedParamSetSummary();                          \
 	PatchedParamSet* patchedParams = (PatchedParamSet*)patchedParamsSummary->paramCollection;
 
+// Every tag Sound::readTagFromFileOrError() handles itself, so it doesn't need a strcmp() for each one
+constexpr auto soundTags = deluge::makeTagTable({
+    "osc1", "osc2", "mode", "oscillatorA", "oscillatorB", "modulator1", "modulator2", "arpeggiator", "transpose",
+    "noiseVolume", "ratchetAmount", "ratchetProbability", "chordPolyphony", "chordProbability", "reverseProbability",
+    "bassProbability", "noteProbability", "sequenceLength", "rhythm", "spreadVelocity", "spreadGate", "spreadOctave",
+    "portamento", "oscillatorReset", "unison", "oscAPitchAdjust", "oscBPitchAdjust", "mod1PitchAdjust",
+    "mod2PitchAdjust", "fileName", "cents", "continuous", "reversed", "zone", "ringMod", "modKnobs", "patchCables",
+    "volume", "pan", "pitchAdjust", "modFXType", "fx", "lfo1", "lfo2", "lfo3", "lfo4", "sideChainSend", "lpf", "hpf",
+    "envelope1", "envelope2", "envelope3", "envelope4", "polyphonic", "maxVoices", "voicePriority", "reverbAmount",
+    "defaultParams", "waveFold", "midiOutput"});
+
 // paramManager only required for old old song files, or for presets (because you'd be wanting to extract the
 // defaultParams into it). arpSettings optional - no need if you're loading a new V2.0 song where Instruments are all
 // separate from Clips and won't store any arp stuff.
 Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, ParamManagerForTimeline* paramManager,
                                     int32_t readAutomationUpToPos, ArpeggiatorSettings* arpSettings, Song* song) {
 
-	if (!strcmp(tagName, "osc1")) {
+	int32_t tag = soundTags.find(tagName);
+	switch (tag) {
+	case soundTags["osc1"]: {
 		reader.match('{');
 		Error error = readSourceFromFile(reader, 0, paramManager, readAutomationUpToPos);
 		if (error != Error::NONE) {
 			return error;
 		}
 		reader.exitTag("osc1", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "osc2")) {
+	case soundTags["osc2"]: {
 		reader.match('{');
 		Error error = readSourceFromFile(reader, 1, paramManager, readAutomationUpToPos);
 		if (error != Error::NONE) {
 			return error;
 		}
 		reader.exitTag("osc2", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "mode")) {
+	case soundTags["mode"]: {
 		char const* contents = reader.readTagOrAttributeValue();
 		if (synthMode != SynthMode::RINGMOD) { // Compatibility with old XML files
 			synthMode = stringToSynthMode(contents);
@@ -488,10 +505,11 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		// Uart::print("synth mode set to: ");
 		// Uart::println(synthMode);
 		reader.exitTag("mode");
+		break;
 	}
 
 	// Backwards-compatible reading of old-style oscs, from pre-mid-2016 files
-	else if (!strcmp(tagName, "oscillatorA")) {
+	case soundTags["oscillatorA"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 
@@ -525,9 +543,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("oscillatorA", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "oscillatorB")) {
+	case soundTags["oscillatorB"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "type")) {
@@ -561,9 +580,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("oscillatorB", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "modulator1")) {
+	case soundTags["modulator1"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "volume")) {
@@ -589,9 +609,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("modulator1", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "modulator2")) {
+	case soundTags["modulator2"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "volume")) {
@@ -624,9 +645,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("modulator2", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "arpeggiator")) {
+	case soundTags["arpeggiator"]: {
 		// Set default values in case they are not configured
 		arpSettings->syncType = SYNC_TYPE_EVEN;
 		arpSettings->syncLevel = SYNC_LEVEL_NONE;
@@ -649,112 +671,127 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("arpeggiator", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "transpose")) {
+	case soundTags["transpose"]: {
 		transpose = reader.readTagOrAttributeValueInt();
 		reader.exitTag("transpose");
+		break;
 	}
 
-	else if (!strcmp(tagName, "noiseVolume")) {
+	case soundTags["noiseVolume"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_NOISE_VOLUME, readAutomationUpToPos);
 		reader.exitTag("noiseVolume");
+		break;
 	}
 
-	else if (!strcmp(tagName, "ratchetAmount")) {
+	case soundTags["ratchetAmount"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_RATCHET_AMOUNT,
 		                           readAutomationUpToPos);
 		reader.exitTag("ratchetAmount");
+		break;
 	}
 
-	else if (!strcmp(tagName, "ratchetProbability")) {
+	case soundTags["ratchetProbability"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_RATCHET_PROBABILITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("ratchetProbability");
+		break;
 	}
 
-	else if (!strcmp(tagName, "chordPolyphony")) {
+	case soundTags["chordPolyphony"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_CHORD_POLYPHONY,
 		                           readAutomationUpToPos);
 		reader.exitTag("chordPolyphony");
+		break;
 	}
 
-	else if (!strcmp(tagName, "chordProbability")) {
+	case soundTags["chordProbability"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_CHORD_PROBABILITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("chordProbability");
+		break;
 	}
 
-	else if (!strcmp(tagName, "reverseProbability")) {
+	case soundTags["reverseProbability"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_REVERSE_PROBABILITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("reverseProbability");
+		break;
 	}
 
-	else if (!strcmp(tagName, "bassProbability")) {
+	case soundTags["bassProbability"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_BASS_PROBABILITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("bassProbability");
+		break;
 	}
 
-	else if (!strcmp(tagName, "noteProbability")) {
+	case soundTags["noteProbability"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_NOTE_PROBABILITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("noteProbability");
+		break;
 	}
 
-	else if (!strcmp(tagName, "sequenceLength")) {
+	case soundTags["sequenceLength"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_SEQUENCE_LENGTH,
 		                           readAutomationUpToPos);
 		reader.exitTag("sequenceLength");
+		break;
 	}
 
-	else if (!strcmp(tagName, "rhythm")) {
+	case soundTags["rhythm"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_RHYTHM, readAutomationUpToPos);
 		reader.exitTag("rhythm");
+		break;
 	}
 
-	else if (!strcmp(tagName, "spreadVelocity")) {
+	case soundTags["spreadVelocity"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_SPREAD_VELOCITY,
 		                           readAutomationUpToPos);
 		reader.exitTag("spreadVelocity");
+		break;
 	}
 
-	else if (!strcmp(tagName, "spreadGate")) {
+	case soundTags["spreadGate"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_SPREAD_GATE,
 		                           readAutomationUpToPos);
 		reader.exitTag("spreadGate");
+		break;
 	}
 
-	else if (!strcmp(tagName, "spreadOctave")) {
+	case soundTags["spreadOctave"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_ARP_SPREAD_OCTAVE,
 		                           readAutomationUpToPos);
 		reader.exitTag("spreadOctave");
+		break;
 	}
 
-	else if (!strcmp(tagName,
-	                 "portamento")) { // This is here for compatibility only for people (Lou and Ian) who saved songs
-		                              // with firmware in September 2016
+	case soundTags["portamento"]: { // This is here for compatibility only for people (Lou and Ian) who saved
+		                                         // songs with firmware in September 2016
 		ENSURE_PARAM_MANAGER_EXISTS
 		unpatchedParams->readParam(reader, unpatchedParamsSummary, params::UNPATCHED_PORTAMENTO, readAutomationUpToPos);
 		reader.exitTag("portamento");
+		break;
 	}
 
 	// For backwards compatibility. If off, switch off for all operators
-	else if (!strcmp(tagName, "oscillatorReset")) {
+	case soundTags["oscillatorReset"]: {
 		int32_t value = reader.readTagOrAttributeValueInt();
 		if (!value) {
 			for (int32_t s = 0; s < kNumSources; s++) {
@@ -765,9 +802,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("oscillatorReset");
+		break;
 	}
 
-	else if (!strcmp(tagName, "unison")) {
+	case soundTags["unison"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "num")) {
@@ -790,36 +828,41 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("unison", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "oscAPitchAdjust")) {
+	case soundTags["oscAPitchAdjust"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_OSC_A_PITCH_ADJUST, readAutomationUpToPos);
 		reader.exitTag("oscAPitchAdjust");
+		break;
 	}
 
-	else if (!strcmp(tagName, "oscBPitchAdjust")) {
+	case soundTags["oscBPitchAdjust"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_OSC_B_PITCH_ADJUST, readAutomationUpToPos);
 		reader.exitTag("oscBPitchAdjust");
+		break;
 	}
 
-	else if (!strcmp(tagName, "mod1PitchAdjust")) {
+	case soundTags["mod1PitchAdjust"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_MODULATOR_0_PITCH_ADJUST,
 		                         readAutomationUpToPos);
 		reader.exitTag("mod1PitchAdjust");
+		break;
 	}
 
-	else if (!strcmp(tagName, "mod2PitchAdjust")) {
+	case soundTags["mod2PitchAdjust"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_MODULATOR_1_PITCH_ADJUST,
 		                         readAutomationUpToPos);
 		reader.exitTag("mod2PitchAdjust");
+		break;
 	}
 
 	// Stuff from the early-2016 format, for compatibility
-	else if (!strcmp(tagName, "fileName")) {
+	case soundTags["fileName"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 
 		MultisampleRange* range = (MultisampleRange*)sources[0].getOrCreateFirstRange();
@@ -843,25 +886,29 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		    getParamFromUserValue(params::LOCAL_OSC_B_VOLUME, 0));
 
 		reader.exitTag("fileName");
+		break;
 	}
 
-	else if (!strcmp(tagName, "cents")) {
+	case soundTags["cents"]: {
 		int8_t newCents = reader.readTagOrAttributeValueInt();
 		// We don't need to call the setTranspose method here, because this will get called soon anyway, once the sample
 		// rate is known
 		sources[0].cents = (std::max((int8_t)-50, std::min((int8_t)50, newCents)));
 		reader.exitTag("cents");
+		break;
 	}
-	else if (!strcmp(tagName, "continuous")) {
+	case soundTags["continuous"]: {
 		sources[0].repeatMode = static_cast<SampleRepeatMode>(reader.readTagOrAttributeValueInt());
 		sources[0].repeatMode = std::min(sources[0].repeatMode, static_cast<SampleRepeatMode>(kNumRepeatModes - 1));
 		reader.exitTag("continuous");
+		break;
 	}
-	else if (!strcmp(tagName, "reversed")) {
+	case soundTags["reversed"]: {
 		sources[0].sampleControls.reversed = reader.readTagOrAttributeValueInt();
 		reader.exitTag("reversed");
+		break;
 	}
-	else if (!strcmp(tagName, "zone")) {
+	case soundTags["zone"]: {
 		reader.match('{');
 		MultisampleRange* range = (MultisampleRange*)sources[0].getOrCreateFirstRange();
 		if (!range) {
@@ -893,17 +940,19 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("zone", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "ringMod")) {
+	case soundTags["ringMod"]: {
 		int32_t contents = reader.readTagOrAttributeValueInt();
 		if (contents == 1) {
 			synthMode = SynthMode::RINGMOD;
 		}
 		reader.exitTag("ringMod");
+		break;
 	}
 
-	else if (!strcmp(tagName, "modKnobs")) {
+	case soundTags["modKnobs"]: {
 
 		int32_t k = 0;
 		int32_t w = 0;
@@ -960,42 +1009,48 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 		reader.exitTag("modKnobs");
 		reader.match(']');
+		break;
 	}
 
-	else if (!strcmp(tagName, "patchCables")) {
+	case soundTags["patchCables"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		paramManager->getPatchCableSet()->readPatchCablesFromFile(reader, readAutomationUpToPos);
 		reader.exitTag("patchCables");
+		break;
 	}
 
-	else if (!strcmp(tagName, "volume")) {
+	case soundTags["volume"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::GLOBAL_VOLUME_POST_FX, readAutomationUpToPos);
 		reader.exitTag("volume");
+		break;
 	}
 
-	else if (!strcmp(tagName, "pan")) {
+	case soundTags["pan"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_PAN, readAutomationUpToPos);
 		reader.exitTag("pan");
+		break;
 	}
 
-	else if (!strcmp(tagName, "pitchAdjust")) {
+	case soundTags["pitchAdjust"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_PITCH_ADJUST, readAutomationUpToPos);
 		reader.exitTag("pitchAdjust");
+		break;
 	}
 
-	else if (!strcmp(tagName, "modFXType")) {
+	case soundTags["modFXType"]: {
 		bool result =
 		    setModFXType(stringToFXType(reader.readTagOrAttributeValue())); // This might not work if not enough RAM
 		if (!result) {
 			display->displayError(Error::INSUFFICIENT_RAM);
 		}
 		reader.exitTag("modFXType");
+		break;
 	}
 
-	else if (!strcmp(tagName, "fx")) {
+	case soundTags["fx"]: {
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 
 			if (!strcmp(tagName, "type")) {
@@ -1044,9 +1099,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("fx");
+		break;
 	}
 
-	else if (!strcmp(tagName, "lfo1")) {
+	case soundTags["lfo1"]: {
 		// Set default values in case they are not configured.
 		lfoConfig[LFO1_ID].syncLevel = SYNC_LEVEL_NONE;
 		lfoConfig[LFO1_ID].syncType = SYNC_TYPE_EVEN;
@@ -1077,9 +1133,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 		reader.exitTag("lfo1", true);
 		resyncGlobalLFOs();
+		break;
 	}
 
-	else if (!strcmp(tagName, "lfo2")) {
+	case soundTags["lfo2"]: {
 		// Set default values in case they are not configured.
 		lfoConfig[LFO2_ID].syncLevel = SYNC_LEVEL_NONE;
 		lfoConfig[LFO2_ID].syncType = SYNC_TYPE_EVEN;
@@ -1110,9 +1167,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 		reader.exitTag("lfo2", true);
 		// No resync for LFO2
+		break;
 	}
 
-	else if (!strcmp(tagName, "lfo3")) {
+	case soundTags["lfo3"]: {
 		// Set default values in case they are not configured.
 		lfoConfig[LFO3_ID].syncLevel = SYNC_LEVEL_NONE;
 		lfoConfig[LFO3_ID].syncType = SYNC_TYPE_EVEN;
@@ -1143,9 +1201,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 		reader.exitTag("lfo3", true);
 		resyncGlobalLFOs();
+		break;
 	}
 
-	else if (!strcmp(tagName, "lfo4")) {
+	case soundTags["lfo4"]: {
 		// Set default values in case they are not configured.
 		lfoConfig[LFO4_ID].syncLevel = SYNC_LEVEL_NONE;
 		lfoConfig[LFO4_ID].syncType = SYNC_TYPE_EVEN;
@@ -1176,14 +1235,16 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 		reader.exitTag("lfo4", true);
 		// No resync for LFO4
+		break;
 	}
 
-	else if (!strcmp(tagName, "sideChainSend")) {
+	case soundTags["sideChainSend"]: {
 		sideChainSendLevel = reader.readTagOrAttributeValueInt();
 		reader.exitTag("sideChainSend");
+		break;
 	}
 
-	else if (!strcmp(tagName, "lpf")) {
+	case soundTags["lpf"]: {
 		bool switchedOn = true; // For backwards compatibility with pre November 2015 files
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
@@ -1223,9 +1284,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("lpf", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "hpf")) {
+	case soundTags["hpf"]: {
 		bool switchedOn = true; // For backwards compatibility with pre November 2015 files
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
@@ -1261,9 +1323,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("hpf", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "envelope1")) {
+	case soundTags["envelope1"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "attack")) {
@@ -1296,9 +1359,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("envelope1", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "envelope2")) {
+	case soundTags["envelope2"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "attack")) {
@@ -1331,9 +1395,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("envelope2", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "envelope3")) {
+	case soundTags["envelope3"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "attack")) {
@@ -1366,9 +1431,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("envelope3", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "envelope4")) {
+	case soundTags["envelope4"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "attack")) {
@@ -1401,40 +1467,47 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 		}
 
 		reader.exitTag("envelope3", true);
+		break;
 	}
 
-	else if (!strcmp(tagName, "polyphonic")) {
+	case soundTags["polyphonic"]: {
 		polyphonic = stringToPolyphonyMode(reader.readTagOrAttributeValue());
 		reader.exitTag("polyphonic");
+		break;
 	}
 
-	else if (!strcmp(tagName, "maxVoices")) {
+	case soundTags["maxVoices"]: {
 		maxVoiceCount = reader.readTagOrAttributeValueInt();
 		reader.exitTag("maxVoices");
+		break;
 	}
 
-	else if (!strcmp(tagName, "voicePriority")) {
+	case soundTags["voicePriority"]: {
 		voicePriority = static_cast<VoicePriority>(reader.readTagOrAttributeValueInt());
 		reader.exitTag("voicePriority");
+		break;
 	}
 
-	else if (!strcmp(tagName, "reverbAmount")) {
+	case soundTags["reverbAmount"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::GLOBAL_REVERB_AMOUNT, readAutomationUpToPos);
 		reader.exitTag("reverbAmount");
+		break;
 	}
 
-	else if (!strcmp(tagName, "defaultParams")) {
+	case soundTags["defaultParams"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		Sound::readParamsFromFile(reader, paramManager, readAutomationUpToPos);
 		reader.exitTag("defaultParams");
+		break;
 	}
-	else if (!strcmp(tagName, "waveFold")) {
+	case soundTags["waveFold"]: {
 		ENSURE_PARAM_MANAGER_EXISTS
 		patchedParams->readParam(reader, patchedParamsSummary, params::LOCAL_FOLD, readAutomationUpToPos);
 		reader.exitTag("waveFold");
+		break;
 	}
-	else if (!strcmp(tagName, "midiOutput")) {
+	case soundTags["midiOutput"]: {
 		reader.match('{');
 		while (*(tagName = reader.readNextTagOrAttributeName())) {
 			if (!strcmp(tagName, "channel")) {
@@ -1450,9 +1523,10 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 		}
 		reader.exitTag("midiOutput", true);
+		break;
 	}
 
-	else {
+	default: {
 		Error result =
 		    ModControllableAudio::readTagFromFile(reader, tagName, paramManager, readAutomationUpToPos, song);
 		if (result == Error::NONE) {}
@@ -1467,6 +1541,8 @@ Error Sound::readTagFromFileOrError(Deserializer& reader, char const* tagName, P
 			}
 			reader.exitTag();
 		}
+		break;
+	}
 	}
 
 	return Error::NONE;
@@ -2326,7 +2402,7 @@ void Sound::reassessRenderSkippingStatus(ModelStackWithSoundFlags* modelStack, b
 		if (skippingStatusNow) {
 
 			// We wanna start, skipping, but if MOD fx are on...
-			if ((modFXType_ != ModFXType::NONE) || compressor.getThreshold() > 0) {
+			if ((modFXType_ != ModFXType::NONE) || compressor.getThreshold() > 0 || convolution.isActive()) {
 
 				// If we didn't start the wait-time yet, start it now
 				if (!startSkippingRenderingAtTime) {
@@ -2352,7 +2428,8 @@ doCutModFXTail:
 						waitSamplesModfx = (90 * 441);
 					}
 					int32_t waitSamples =
-					    std::max(waitSamplesModfx, static_cast<int32_t>(compressor.getReleaseMS() * 44));
+					    std::max({waitSamplesModfx, static_cast<int32_t>(compressor.getReleaseMS() * 44),
+					              convolution.getTailLength()});
 					startSkippingRenderingAtTime = AudioEngine::audioSampleTimer + waitSamples;
 				}
 
@@ -2502,6 +2579,8 @@ void Sound::render(ModelStackWithThreeMainThings* modelStack, std::span<StereoSa
 		return;
 	}
 
+	TIME_RENDER_STAGE(SOUND);
+
 	ParamManagerForTimeline* paramManager = (ParamManagerForTimeline*)modelStack->paramManager;
 
 	// Do global LFO
@@ -2540,6 +2619,7 @@ void Sound::render(ModelStackWithThreeMainThings* modelStack, std::span<StereoSa
 
 	// Do sidechain
 	if (paramManager->getPatchCableSet()->isSourcePatchedToSomething(PatchSource::SIDECHAIN)) {
+		TIME_RENDER_STAGE(SIDECHAIN);
 		if (sideChainHitPending) {
 			sidechain.registerHit(sideChainHitPending);
 		}
@@ -2634,6 +2714,7 @@ void Sound::render(ModelStackWithThreeMainThings* modelStack, std::span<StereoSa
 	std::span sound_stereo{(StereoSample*)sound_memory, output.size()};
 
 	if (numVoicesAssigned) {
+		TIME_RENDER_STAGE(VOICES);
 
 		// Very often, we'll just apply panning here at the Sound level rather than the Voice level
 		bool applyingPanAtVoiceLevel =
@@ -2735,6 +2816,7 @@ void Sound::render(ModelStackWithThreeMainThings* modelStack, std::span<StereoSa
 	q31_t compThreshold = paramManager->getUnpatchedParamSet()->getValue(params::UNPATCHED_COMPRESSOR_THRESHOLD);
 	compressor.setThreshold(compThreshold);
 	if (compThreshold > 0) {
+		TIME_RENDER_STAGE(COMPRESSOR);
 		compressor.renderVolNeutral(sound_stereo, postFXVolume);
 	}
 	else {
@@ -2782,6 +2864,7 @@ void Sound::startSkippingRendering(ModelStackWithSoundFlags* modelStack) {
 
 	setSkippingRendering(true);
 	grainFX->startSkippingRendering();
+	convolution.startSkippingRendering();
 	stopParamLPF(modelStack);
 }
 
@@ -3378,9 +3461,10 @@ void Sound::setNumUnison(int32_t newNum, ModelStackWithSoundFlags* modelStack) {
 							newPart->active = oldPart->active;
 
 							if (newPart->active) {
-								newPart->oscPos = oldPart->oscPos;
-								newPart->phaseIncrementStoredValue = oldPart->phaseIncrementStoredValue;
-								newPart->carrierFeedback = oldPart->carrierFeedback;
+								UnisonOscillatorState& osc = thisVoice->sourceOscillators[s];
+								osc.phase[oldNum] = osc.phase[oldNum - 1];
+								osc.phaseIncrement[oldNum] = osc.phaseIncrement[oldNum - 1];
+								osc.feedback[oldNum] = osc.feedback[oldNum - 1];
 
 								newPart->voiceSample = AudioEngine::solicitVoiceSample();
 								if (!newPart->voiceSample) {
@@ -0,0 +1,565 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "definitions_cxx.hpp"
+#include "processing/engines/audio_engine.h"
+#include "storage/binary_format.h"
+#include "storage/storage_manager.h"
+#include "util/d_string.h"
+#include "util/firmware_version.h"
+#include "util/functions.h"
+#include <algorithm>
+#include <string.h>
+
+extern "C" {
+#include "fatfs/ff.h"
+}
+
+/*******************************************************************************
+
+    BinaryDeserializer
+
+********************************************************************************/
+
+using namespace BinaryFormat;
+
+BinaryDeserializer::BinaryDeserializer() {
+	reset();
+}
+
+BinaryDeserializer::BinaryDeserializer(uint8_t* inbuf, size_t buflen) : FileDeserializer(inbuf, buflen) {
+	reset();
+}
+
+void BinaryDeserializer::reset() {
+	resetReader();
+
+	song_firmware_version = FirmwareVersion{FirmwareVersion::Type::OFFICIAL, {}};
+
+	tagDepthFile = 0;
+	tagDepthCaller = 0;
+
+	valueKind = ValueKind::NONE;
+	reachedEndToken = false;
+	lowNibbleChar = 0;
+
+	numNames = 0;
+	namePoolUsed = 0;
+}
+
+bool BinaryDeserializer::readByte(uint8_t* byte) {
+	if (fileReadBufferCurrentPos < currentReadBufferEndPos) {
+		*byte = fileClusterBuffer[fileReadBufferCurrentPos++];
+		return true;
+	}
+	return readChar((char*)byte);
+}
+
+bool BinaryDeserializer::readBytes(char* dest, uint32_t numBytes) {
+	while (numBytes) {
+		if (fileReadBufferCurrentPos >= currentReadBufferEndPos) {
+			readFileClusterIfNecessary();
+			if (reachedBufferEnd) {
+				return false;
+			}
+			continue;
+		}
+		uint32_t numBytesHere = std::min(numBytes, bytesRemainingInBuffer());
+		if (dest) {
+			memcpy(dest, &fileClusterBuffer[fileReadBufferCurrentPos], numBytesHere);
+			dest += numBytesHere;
+		}
+		fileReadBufferCurrentPos += numBytesHere;
+		numBytes -= numBytesHere;
+	}
+	return true;
+}
+
+bool BinaryDeserializer::readVarint(uint32_t* value) {
+	uint32_t result = 0;
+	for (int32_t shift = 0; shift < 35; shift += 7) {
+		uint8_t byte;
+		if (!readByte(&byte)) {
+			return false;
+		}
+		result |= (uint32_t)(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Returns "" if the file's broken
+char const* BinaryDeserializer::readName() {
+	uint32_t ref;
+	if (!readVarint(&ref)) {
+		return "";
+	}
+
+	if (ref) {
+		if (ref > numNames) {
+			return "";
+		}
+		return &namePool[nameOffsets[ref - 1]];
+	}
+
+	uint32_t length;
+	if (!readVarint(&length)) {
+		return "";
+	}
+
+	if (shouldRememberName(numNames, namePoolUsed, length)) {
+		char* name = &namePool[namePoolUsed];
+		if (!readBytes(name, length)) {
+			return "";
+		}
+		name[length] = 0;
+		nameOffsets[numNames++] = namePoolUsed;
+		namePoolUsed += length + 1;
+		return name;
+	}
+
+	// Too long or no room left - hand it out from stringBuffer without remembering it, as the writer will have done
+	uint32_t numCharsToKeep = std::min<uint32_t>(length, kFilenameBufferSize - 1);
+	if (!readBytes(stringBuffer, numCharsToKeep) || !readBytes(NULL, length - numCharsToKeep)) {
+		return "";
+	}
+	stringBuffer[numCharsToKeep] = 0;
+	return stringBuffer;
+}
+
+// Reads a token's type and name, and gets ready for its value if it has one. Returns END if the file ends or is broken
+uint8_t BinaryDeserializer::readToken(char const** name) {
+	uint8_t token;
+	if (reachedEndToken || !readByte(&token)) {
+		reachedEndToken = true;
+		return END;
+	}
+
+	uint8_t type = token & kTokenTypeMask;
+	if (type == END || type == CLOSE) {
+		if (type == END) {
+			reachedEndToken = true;
+		}
+		return type;
+	}
+
+	*name = readName();
+
+	switch (type) {
+	case OPEN:
+		break;
+
+	case INT: {
+		uint32_t zigzagged;
+		if (!readVarint(&zigzagged)) {
+			goto corrupted;
+		}
+		intValue = unzigzag(zigzagged);
+		intCharPos = -1; // Not converted to chars yet
+		valueKind = ValueKind::INT;
+		break;
+	}
+
+	case STRING:
+		if (!readVarint(&chunkRemaining)) {
+			goto corrupted;
+		}
+		chunkIsText = true;
+		valueKind = ValueKind::STRING;
+		break;
+
+	case VALUE:
+		chunkRemaining = 0;
+		valueKind = ValueKind::CHUNKED;
+		break;
+
+	default:
+		goto corrupted;
+	}
+
+	if (!**name) {
+corrupted:
+		valueKind = ValueKind::NONE;
+		reachedEndToken = true;
+		return END;
+	}
+
+	tagDepthFile++;
+	return type;
+}
+
+char const* BinaryDeserializer::readNextTagOrAttributeName() {
+	if (valueKind != ValueKind::NONE) {
+		skipValue();
+	}
+
+	readDone();
+
+	char const* name;
+	switch (readToken(&name)) {
+	case END:
+		return "";
+
+	case CLOSE:
+		tagDepthFile--;
+		return "";
+
+	default:
+		tagDepthCaller++;
+		AudioEngine::logAction(name);
+		return name;
+	}
+}
+
+void BinaryDeserializer::exitTag(char const* exitTagName, bool closeObject) {
+	// back out the file depth to one less than the caller depth, as XMLDeserializer does
+	while (tagDepthFile >= tagDepthCaller) {
+		if (valueKind != ValueKind::NONE) {
+			skipValue();
+			continue;
+		}
+
+		char const* name;
+		uint8_t token = readToken(&name);
+		if (token == END) {
+			break;
+		}
+		if (token == CLOSE) {
+			tagDepthFile--;
+		}
+	}
+	tagDepthCaller = tagDepthFile;
+}
+
+// Moves on to the next chunk of a chunked value. Returns false, and finishes the value, if there are no more
+bool BinaryDeserializer::readValueChunkHeader() {
+	uint32_t header;
+	if (!readVarint(&header) || !header) {
+		finishValue();
+		return false;
+	}
+	chunkRemaining = header >> 1;
+	chunkIsText = header & 1;
+	return true;
+}
+
+void BinaryDeserializer::finishValue() {
+	valueKind = ValueKind::NONE;
+	lowNibbleChar = 0;
+	tagDepthFile--;
+}
+
+void BinaryDeserializer::skipValue() {
+	switch (valueKind) {
+	case ValueKind::STRING:
+		readBytes(NULL, chunkRemaining);
+		break;
+
+	case ValueKind::CHUNKED:
+		while (readBytes(NULL, chunkRemaining)) {
+			chunkRemaining = 0;
+			if (!readValueChunkHeader()) {
+				return; // That finished the value
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+	finishValue();
+}
+
+// Hands out the value the way it'd look in XML - ints as decimal, and byte chunks as two uppercase hex digits per byte.
+// Returns false, and finishes the value, when there are no more chars
+bool BinaryDeserializer::readValueChar(char* thisChar) {
+	if (lowNibbleChar) {
+		*thisChar = lowNibbleChar;
+		lowNibbleChar = 0;
+		return true;
+	}
+
+	switch (valueKind) {
+	case ValueKind::INT:
+		if (intCharPos < 0) {
+			intToString(intValue, intChars);
+			intCharPos = 0;
+		}
+		if (!intChars[intCharPos]) {
+			break;
+		}
+		*thisChar = intChars[intCharPos++];
+		return true;
+
+	case ValueKind::STRING:
+		if (!chunkRemaining || !readByte((uint8_t*)thisChar)) {
+			break;
+		}
+		chunkRemaining--;
+		return true;
+
+	case ValueKind::CHUNKED: {
+		while (!chunkRemaining) {
+			if (!readValueChunkHeader()) {
+				return false;
+			}
+		}
+		uint8_t byte;
+		if (!readByte(&byte)) {
+			break;
+		}
+		chunkRemaining--;
+		if (chunkIsText) {
+			*thisChar = byte;
+		}
+		else {
+			*thisChar = halfByteToHexChar(byte >> 4);
+			lowNibbleChar = halfByteToHexChar(byte & 15);
+		}
+		return true;
+	}
+
+	default:
+		return false;
+	}
+
+	finishValue();
+	return false;
+}
+
+bool BinaryDeserializer::prepareToReadTagOrAttributeValueOneCharAtATime() {
+	return valueKind != ValueKind::NONE;
+}
+
+char BinaryDeserializer::readNextCharOfTagOrAttributeValue() {
+	char thisChar;
+	if (!readValueChar(&thisChar)) {
+		return 0;
+	}
+	return thisChar;
+}
+
+// Returns NULL when the value ends before numChars have been read. numChars must be < kFilenameBufferSize
+char const* BinaryDeserializer::readNextCharsOfTagOrAttributeValue(int32_t numChars) {
+	int32_t charPos = 0;
+
+	while (charPos < numChars) {
+		// Fast path for the note and automation data this format is mostly made of - whole bytes straight from the
+		// cluster buffer to hex
+		if (valueKind == ValueKind::CHUNKED && !chunkIsText && !lowNibbleChar) {
+			uint32_t numBytes = std::min<uint32_t>({chunkRemaining, (uint32_t)(numChars - charPos) >> 1,
+			                                        bytesRemainingInBuffer()});
+			for (uint32_t i = 0; i < numBytes; i++) {
+				uint8_t byte = fileClusterBuffer[fileReadBufferCurrentPos++];
+				stringBuffer[charPos++] = halfByteToHexChar(byte >> 4);
+				stringBuffer[charPos++] = halfByteToHexChar(byte & 15);
+			}
+			chunkRemaining -= numBytes;
+			if (numBytes) {
+				continue;
+			}
+		}
+
+		if (!readValueChar(&stringBuffer[charPos])) {
+			return NULL;
+		}
+		charPos++;
+	}
+
+	readDone();
+	return stringBuffer;
+}
+
+// Only a hint for allocating, so just says what's left in the current chunk
+int32_t BinaryDeserializer::getNumCharsRemainingInValueBeforeEndOfCluster() {
+	switch (valueKind) {
+	case ValueKind::INT:
+		return 11;
+
+	case ValueKind::STRING:
+		return chunkRemaining;
+
+	case ValueKind::CHUNKED:
+		if (!chunkRemaining && !readValueChunkHeader()) {
+			return 0;
+		}
+		return chunkIsText ? chunkRemaining : chunkRemaining * 2;
+
+	default:
+		return 0;
+	}
+}
+
+char const* BinaryDeserializer::readTagOrAttributeValue() {
+	if (valueKind == ValueKind::NONE) {
+		return "";
+	}
+
+	int32_t charPos = 0;
+	while (charPos < kFilenameBufferSize - 1 && readValueChar(&stringBuffer[charPos])) {
+		charPos++;
+	}
+	stringBuffer[charPos] = 0;
+
+	if (valueKind != ValueKind::NONE) {
+		skipValue();
+	}
+	return stringBuffer;
+}
+
+int32_t BinaryDeserializer::readTagOrAttributeValueInt() {
+	if (valueKind == ValueKind::INT) {
+		finishValue();
+		return intValue;
+	}
+	return stringToInt(readTagOrAttributeValue());
+}
+
+int32_t BinaryDeserializer::readTagOrAttributeValueHex(int32_t errorValue) {
+	char const* string = readTagOrAttributeValue();
+	if (string[0] != '0' || string[1] != 'x') {
+		return errorValue;
+	}
+	return hexToInt(&string[2]);
+}
+
+extern bool getNibble(char ch, int* nibble);
+
+int BinaryDeserializer::readTagOrAttributeValueHexBytes(uint8_t* bytes, int32_t maxLen) {
+	int32_t read = 0;
+
+	// Bytes chunks can be copied straight out. Stops at the first text, like XMLDeserializer stops at a non hex digit
+	if (valueKind == ValueKind::CHUNKED) {
+		while (read < maxLen && (chunkRemaining || readValueChunkHeader()) && !chunkIsText) {
+			uint32_t numBytes = std::min<uint32_t>(chunkRemaining, maxLen - read);
+			if (!readBytes((char*)&bytes[read], numBytes)) {
+				return 0;
+			}
+			chunkRemaining -= numBytes;
+			read += numBytes;
+		}
+	}
+	else {
+		while (read < maxLen) {
+			char highChar, lowChar;
+			int highNibble, lowNibble;
+			if (!readValueChar(&highChar) || !getNibble(highChar, &highNibble) || !readValueChar(&lowChar)
+			    || !getNibble(lowChar, &lowNibble)) {
+				break;
+			}
+			bytes[read++] = (highNibble << 4) + lowNibble;
+		}
+	}
+
+	if (valueKind != ValueKind::NONE) {
+		skipValue();
+	}
+	return read;
+}
+
+// Returns memory error
+Error BinaryDeserializer::readTagOrAttributeValueString(String* string) {
+	string->clear();
+
+	int32_t stringPos = 0;
+	while (valueKind != ValueKind::NONE) {
+		int32_t charPos = 0;
+		while (charPos < kFilenameBufferSize && readValueChar(&stringBuffer[charPos])) {
+			charPos++;
+		}
+		if (charPos) {
+			Error error = string->concatenateAtPos(stringBuffer, stringPos, charPos);
+			if (error != Error::NONE) {
+				return error;
+			}
+			stringPos += charPos;
+		}
+	}
+	return Error::NONE;
+}
+
+Error BinaryDeserializer::openBinaryFile(FilePointer* filePointer, char const* firstTagName, char const* altTagName,
+                                         bool ignoreIncorrectFirmware) {
+
+	AudioEngine::logAction("openBinaryFile");
+
+	reset();
+
+	char magic[kMagicLength];
+	if (!readBytes(magic, kMagicLength)) {
+		closeWriter();
+		return readFailure();
+	}
+	if (memcmp(magic, kMagic, kMagicLength - 1)) {
+		closeWriter();
+		return Error::FILE_CORRUPTED;
+	}
+	if ((uint8_t)magic[kMagicLength - 1] > kVersion) {
+		closeWriter();
+		return Error::FILE_UNSUPPORTED;
+	}
+
+	char const* tagName;
+
+	while (*(tagName = readNextTagOrAttributeName())) {
+
+		if (!strcmp(tagName, firstTagName) || !strcmp(tagName, altTagName)) {
+			return Error::NONE;
+		}
+
+		Error result = tryReadingFirmwareTagFromFile(tagName, ignoreIncorrectFirmware);
+		if (result != Error::NONE && result != Error::RESULT_TAG_UNUSED) {
+			return result;
+		}
+		exitTag(tagName);
+	}
+
+	closeWriter();
+	return readFailure();
+}
+
+// For when the file ran out early - which is the card's fault if it stopped reading, and the file's otherwise
+Error BinaryDeserializer::readFailure() {
+	return (readResult != FR_OK) ? fresultToDelugeErrorCode(readResult) : Error::FILE_CORRUPTED;
+}
+
+Error BinaryDeserializer::tryReadingFirmwareTagFromFile(char const* tagName, bool ignoreIncorrectFirmware) {
+
+	if (!strcmp(tagName, "firmwareVersion")) {
+		char const* firmware_version_string = readTagOrAttributeValue();
+		song_firmware_version = FirmwareVersion::parse(firmware_version_string);
+	}
+
+	// If this tag doesn't exist, it's from old firmware so is ok
+	else if (!strcmp(tagName, "earliestCompatibleFirmware")) {
+		char const* firmware_version_string = readTagOrAttributeValue();
+		auto earliestFirmware = FirmwareVersion::parse(firmware_version_string);
+		if (earliestFirmware > FirmwareVersion::current() && !ignoreIncorrectFirmware) {
+			closeWriter();
+			return Error::FILE_FIRMWARE_VERSION_TOO_NEW;
+		}
+	}
+
+	else {
+		return Error::RESULT_TAG_UNUSED;
+	}
+
+	return Error::NONE;
+}
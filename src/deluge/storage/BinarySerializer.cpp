@@ -0,0 +1,261 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "definitions_cxx.hpp"
+#include "storage/binary_format.h"
+#include "storage/storage_manager.h"
+#include "util/d_string.h"
+#include <string.h>
+
+/*******************************************************************************
+
+    BinarySerializer
+
+********************************************************************************/
+
+using namespace BinaryFormat;
+
+BinarySerializer::BinarySerializer() {
+	reset();
+}
+
+void BinarySerializer::reset() {
+	resetWriter();
+
+	valueState = ValueState::NONE;
+	pendingNibble = 0;
+	chunkLength = 0;
+
+	numNames = 0;
+	namePoolUsed = 0;
+	memset(nameSlots, 0, sizeof(nameSlots));
+}
+
+void BinarySerializer::writeVarint(uint32_t value) {
+	while (value >= 0x80) {
+		writeByte((int8_t)(value | 0x80));
+		value >>= 7;
+	}
+	writeByte((int8_t)value);
+}
+
+void BinarySerializer::writeName(char const* name) {
+	int32_t length = strlen(name);
+
+	uint32_t hash = 2166136261u;
+	for (int32_t i = 0; i < length; i++) {
+		hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+	}
+
+	int32_t slot = hash & (kNumNameSlots - 1);
+	while (nameSlots[slot]) {
+		int32_t index = nameSlots[slot] - 1;
+		if (!strcmp(&namePool[nameOffsets[index]], name)) {
+			writeVarint(index + 1);
+			return;
+		}
+		slot = (slot + 1) & (kNumNameSlots - 1);
+	}
+
+	writeVarint(0);
+	writeVarint(length);
+	writeBlock((uint8_t*)name, length);
+
+	if (shouldRememberName(numNames, namePoolUsed, length)) {
+		memcpy(&namePool[namePoolUsed], name, length + 1);
+		nameOffsets[numNames] = namePoolUsed;
+		namePoolUsed += length + 1;
+		numNames++;
+		nameSlots[slot] = numNames;
+	}
+}
+
+void BinarySerializer::writeToken(uint8_t token, char const* name) {
+	finishPendingValue();
+	writeByte((int8_t)token);
+	if (name) {
+		writeName(name);
+	}
+}
+
+void BinarySerializer::writeString(char const* string) {
+	int32_t length = strlen(string);
+	writeVarint(length);
+	writeBlock((uint8_t*)string, length);
+}
+
+void BinarySerializer::writeAttribute(char const* name, int32_t number, bool onNewLine) {
+	writeToken(INT, name);
+	writeVarint(zigzag(number));
+}
+
+void BinarySerializer::writeAttribute(char const* name, char const* value, bool onNewLine) {
+	writeToken(STRING, name);
+	writeString(value);
+}
+
+// numChars may be up to 8
+void BinarySerializer::writeAttributeHex(char const* name, int32_t number, int32_t numChars, bool onNewLine) {
+	char buffer[11];
+	buffer[0] = '0';
+	buffer[1] = 'x';
+	intToHex(number, &buffer[2], numChars);
+
+	beginValue(name);
+	for (char const* thisChar = buffer; *thisChar; thisChar++) {
+		appendValueChar(*thisChar);
+	}
+	endValue();
+}
+
+void BinarySerializer::writeAttributeHexBytes(char const* name, uint8_t* data, int32_t numBytes, bool onNewLine) {
+	beginValue(name);
+	for (int32_t i = 0; i < numBytes; i++) {
+		appendValueByte(data[i], false);
+	}
+	endValue();
+}
+
+// The caller then writes the value itself, in quotes, through write()
+void BinarySerializer::writeTagNameAndSeperator(char const* tag) {
+	beginValue(tag);
+	valueState = ValueState::AWAITING_QUOTE;
+}
+
+void BinarySerializer::writeTag(char const* tag, int32_t number, bool box) {
+	writeToken(INT | kElementFlag, tag);
+	writeVarint(zigzag(number));
+}
+
+void BinarySerializer::writeTag(char const* tag, char const* contents, bool box, bool quote) {
+	writeToken(STRING | kElementFlag, tag);
+	writeString(contents);
+}
+
+void BinarySerializer::writeOpeningTag(char const* tag, bool startNewLineAfter, bool box) {
+	writeToken(OPEN, tag);
+}
+
+void BinarySerializer::writeOpeningTagBeginning(char const* tag, bool box, bool newLineBefore) {
+	writeToken(OPEN, tag);
+}
+
+void BinarySerializer::closeTag(bool box) {
+	writeToken(CLOSE, nullptr);
+}
+
+void BinarySerializer::writeClosingTag(char const* tag, bool shouldPrintIndents, bool box) {
+	writeToken(CLOSE, nullptr);
+}
+
+void BinarySerializer::writeArrayStart(char const* tag, bool startNewLineAfter, bool box) {
+	writeToken(OPEN, tag);
+}
+
+void BinarySerializer::writeArrayEnding(char const* tag, bool shouldPrintIndents, bool box) {
+	writeToken(CLOSE, nullptr);
+}
+
+void BinarySerializer::write(char const* output) {
+	for (; *output; output++) {
+		char thisChar = *output;
+		switch (valueState) {
+		case ValueState::NONE:
+			break;
+
+		case ValueState::AWAITING_QUOTE:
+			if (thisChar == '"') {
+				valueState = ValueState::IN_VALUE;
+			}
+			break;
+
+		case ValueState::IN_VALUE:
+			if (thisChar == '"') {
+				endValue();
+			}
+			else {
+				appendValueChar(thisChar);
+			}
+			break;
+		}
+	}
+}
+
+void BinarySerializer::beginValue(char const* name) {
+	writeToken(VALUE, name);
+	valueState = ValueState::IN_VALUE;
+}
+
+// Pairs of uppercase hex digits go in as the byte they spell, everything else as text
+void BinarySerializer::appendValueChar(char thisChar) {
+	bool isHexDigit = (thisChar >= '0' && thisChar <= '9') || (thisChar >= 'A' && thisChar <= 'F');
+	if (isHexDigit) {
+		if (pendingNibble) {
+			appendValueByte((hexCharToHalfByte(pendingNibble) << 4) | hexCharToHalfByte(thisChar), false);
+			pendingNibble = 0;
+		}
+		else {
+			pendingNibble = thisChar;
+		}
+	}
+	else {
+		if (pendingNibble) {
+			appendValueByte(pendingNibble, true);
+			pendingNibble = 0;
+		}
+		appendValueByte(thisChar, true);
+	}
+}
+
+void BinarySerializer::appendValueByte(uint8_t byte, bool isText) {
+	if (chunkLength && (chunkIsText != isText || chunkLength == kValueChunkSize)) {
+		flushValueChunk();
+	}
+	chunkIsText = isText;
+	chunk[chunkLength++] = byte;
+}
+
+void BinarySerializer::flushValueChunk() {
+	if (!chunkLength) {
+		return;
+	}
+	writeVarint((chunkLength << 1) | chunkIsText);
+	writeBlock(chunk, chunkLength);
+	chunkLength = 0;
+}
+
+void BinarySerializer::endValue() {
+	if (pendingNibble) {
+		appendValueByte(pendingNibble, true);
+		pendingNibble = 0;
+	}
+	flushValueChunk();
+	writeVarint(0);
+	valueState = ValueState::NONE;
+}
+
+// In case a caller started a value and never closed its quote - better a truncated value than a corrupt file
+void BinarySerializer::finishPendingValue() {
+	if (valueState != ValueState::NONE) {
+		endValue();
+	}
+}
+
+Error BinarySerializer::closeFileAfterWriting(char const* path, char const* beginningString, char const* endString) {
+	writeToken(END, nullptr);
+	return closeAfterWriting(path, kMagic, nullptr);
+}
@@ -16,6 +16,15 @@
  */
 
 #include "definitions_cxx.hpp"
+#include "storage/storage_manager.h"
+#include "util/firmware_version.h"
+#include "util/functions.h"
+#include "version.h"
+#include <string.h>
+
+#if IN_UNIT_TESTS
+#include "storage_mocks.h"
+#else
 #include "drivers/pic/pic.h"
 #include "fatfs/fatfs.hpp"
 #include "gui/ui/sound_editor.h"
@@ -35,18 +44,14 @@
 #include "processing/sound/sound_drum.h"
 #include "processing/sound/sound_instrument.h"
 #include "storage/audio/audio_file_manager.h"
-#include "storage/storage_manager.h"
-#include "util/firmware_version.h"
-#include "util/functions.h"
 #include "util/try.h"
-#include "version.h"
-#include <string.h>
 
 extern "C" {
 #include "RZA1/oled/oled_low_level.h"
 #include "fatfs/diskio.h"
 #include "fatfs/ff.h"
 }
+#endif
 
 /*******************************************************************************
 
@@ -67,11 +72,17 @@ XMLDeserializer::XMLDeserializer() {
 	reset();
 }
 
+XMLDeserializer::XMLDeserializer(uint8_t* inbuf, size_t buflen) : FileDeserializer(inbuf, buflen) {
+	reset();
+}
+
 void XMLDeserializer::reset() {
 	resetReader();
-	// Prep to read first Cluster shortly
-	fileReadBufferCurrentPos = Cluster::size;
-	currentReadBufferEndPos = Cluster::size;
+	if (!memoryBased) {
+		// Prep to read first Cluster shortly
+		fileReadBufferCurrentPos = Cluster::size;
+		currentReadBufferEndPos = Cluster::size;
+	}
 
 	song_firmware_version = FirmwareVersion{FirmwareVersion::Type::OFFICIAL, {}};
 
@@ -28,10 +28,12 @@
 #include "model/sample/sample.h"
 #include "model/sample/sample_cache.h"
 #include "model/sample/sample_reader.h"
+#include "model/sample/sample_summary.h"
 #include "model/song/song.h"
 #include "playback/playback_handler.h"
 #include "processing/engines/audio_engine.h"
 #include "storage/audio/audio_file.h"
+#include "storage/audio/sample_analysis_cache.h"
 #include "storage/cluster/cluster.h"
 #include "storage/storage_manager.h"
 #include "storage/wave_table/wave_table.h"
@@ -997,8 +999,8 @@ getOutEarly:
 
 		if (prevCluster && prevCluster->loaded) {
 
-			// We first copy our first 7 bytes from here to the end of the prev Cluster...
-			memcpy(&prevCluster->data[Cluster::size], cluster.data, 7);
+			// We first copy our first bytes from here to the end of the prev Cluster, filling its guard bytes...
+			memcpy(&prevCluster->data[Cluster::size], cluster.data, Cluster::guardSize);
 
 			// If 24-bit wrong-endian data...
 			if (sample->rawDataFormat == RawDataFormat::ENDIANNESS_WRONG_24) {
@@ -1055,6 +1057,7 @@ getOutEarly:
 			}
 
 			cluster.extraBytesAtStartConverted = true;
+			prevCluster->guardBytesFilled = true;
 		}
 	}
 
@@ -1077,8 +1080,8 @@ getOutEarly:
 					// If we had't previously converted the first couple of bytes of the next Cluster...
 					if (!nextCluster->extraBytesAtStartConverted) {
 
-						// We first copy the next Cluster first 7 bytes to the end of this Cluster
-						memcpy(&cluster.data[Cluster::size], nextCluster->data, 7);
+						// We first copy the next Cluster's first bytes to the end of this Cluster
+						memcpy(&cluster.data[Cluster::size], nextCluster->data, Cluster::guardSize);
 					}
 
 					// Or, if we *had* previously converted the first bytes of the next Cluster...
@@ -1107,13 +1110,13 @@ getOutEarly:
 
 					// Or, if we *had* previously converted the first bytes of the next Cluster...
 					else {
-						goto copy7ToMe;
+						goto copyGuardToMe;
 					}
 				}
 
 				// Or if no words missed conversion
 				else {
-					goto copy7ToMe;
+					goto copyGuardToMe;
 				}
 			}
 
@@ -1128,8 +1131,8 @@ getOutEarly:
 					// If we had't previously converted the first couple of bytes of the next Cluster, do so now...
 					if (!nextCluster->extraBytesAtStartConverted) {
 
-						// We first copy the next Cluster first 7 bytes to the end of this Cluster
-						memcpy(&cluster.data[Cluster::size], nextCluster->data, 7);
+						// We first copy the next Cluster's first bytes to the end of this Cluster
+						memcpy(&cluster.data[Cluster::size], nextCluster->data, Cluster::guardSize);
 
 						// There'll be one word in there which hasn't yet been converted from float. Do it now
 						thisNumber = sample->convertToNative(thisNumber);
@@ -1152,26 +1155,29 @@ getOutEarly:
 
 						// And now just copy the converted-from-float first bytes from the next Cluster to the end
 						// of this one
-						goto copy7ToMe;
+						goto copyGuardToMe;
 					}
 				}
 				else {
-					goto copy7ToMe;
+					goto copyGuardToMe;
 				}
 			}
 
 			else {
-copy7ToMe:
-				// We copy the next Cluster's first 7 bytes to the end of this Cluster
-				memcpy(&cluster.data[Cluster::size], nextCluster->data, 7);
+copyGuardToMe:
+				// We copy the next Cluster's first bytes to the guard bytes at the end of this Cluster
+				memcpy(&cluster.data[Cluster::size], nextCluster->data, Cluster::guardSize);
 			}
 
 			cluster.extraBytesAtEndConverted = true;
+			cluster.guardBytesFilled = true;
 		}
 	}
 
 	cluster.loaded = true;
 
+	sample->summariseCluster(clusterIndex, cluster);
+
 	clusterBeingLoaded = nullptr;
 	removeReasonFromCluster(cluster, "E034");
 
@@ -1199,6 +1205,8 @@ void AudioFileManager::slowRoutine() {
 		}
 	}
 
+	saveAnyUnsavedAnalysis();
+
 	// NOTE: (Kate) There was dead code here referencing things that no longer
 	// exist (NUM_LOADED_SAMPLE_CHUNK_ALLOCATION_QUEUES, availableClusterQueues)
 	// It has been removed.
@@ -1207,6 +1215,41 @@ void AudioFileManager::slowRoutine() {
 	// for a copy if ever needed
 }
 
+// Writes at most one sidecar per call, and none while anything else might want the card more urgently. A whole summary
+// can be hundreds of kB, so that includes playback, where it'd hold up streaming the clusters being played
+void AudioFileManager::saveAnyUnsavedAnalysis() {
+	if (!analysisMayBeUnsaved || cardEjected || currentlyAccessingCard || thingTypeBeingLoaded != ThingType::NONE
+	    || AudioEngine::firstRecorder != nullptr || playbackHandler.isEitherClockActive()) {
+		return;
+	}
+
+	analysisMayBeUnsaved = false;
+	bool savedOne = false;
+	for (Sample* sample : sampleFiles | std::views::values) {
+		if (!sample->analysisUnsaved && !sample->summaryUnsaved) {
+			continue;
+		}
+
+		// A summary that's still filling in isn't worth saving yet
+		bool summaryComplete = sample->summaryUnsaved && sample->summary != nullptr && sample->summary->isComplete();
+		if (!sample->analysisUnsaved && !summaryComplete) {
+			analysisMayBeUnsaved = true;
+			continue;
+		}
+
+		if (savedOne) {
+			analysisMayBeUnsaved = true;
+			return;
+		}
+		SampleAnalysisCache::save(*sample, summaryComplete);
+		sample->analysisUnsaved = false;
+		if (summaryComplete) {
+			sample->summaryUnsaved = false;
+		}
+		savedOne = true;
+	}
+}
+
 #define REPORT_AWAY_TIME 0
 
 #if REPORT_AWAY_TIME
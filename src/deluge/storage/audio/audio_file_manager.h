@@ -20,6 +20,7 @@
 #include "definitions_cxx.hpp"
 #include "storage/cluster/cluster.h"
 #include "storage/cluster/cluster_priority_queue.h"
+#include "util/containers.h"
 #include <array>
 #include <cstdint>
 #include <expected>
@@ -136,6 +137,9 @@ public:
 	ThingType thingTypeBeingLoaded = ThingType::NONE;
 	DIR alternateLoadDir;
 
+	// Set when any Sample might have analysis its sidecar doesn't have yet - see Sample::analysisChanged()
+	bool analysisMayBeUnsaved = false;
+
 	std::array<int32_t, kNumAudioRecordingFolders> highestUsedAudioRecordingNumber;
 	std::bitset<kNumAudioRecordingFolders> highestUsedAudioRecordingNumberNeedsReChecking;
 	void firstCardRead();
@@ -148,6 +152,7 @@ private:
 	uint32_t clusterSizeAtBoot{0};
 
 	void cardReinserted();
+	void saveAnyUnsavedAnalysis();
 	int32_t readBytes(char* buffer, int32_t num, int32_t* byteIndexWithinCluster, Cluster** currentCluster,
 	                  uint32_t* currentClusterIndex, uint32_t fileSize, Sample* sample);
 	int32_t loadAiff(Sample* newSample, uint32_t fileSize, Cluster** currentCluster, uint32_t* currentClusterIndex);
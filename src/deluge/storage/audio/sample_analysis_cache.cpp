@@ -0,0 +1,261 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "storage/audio/sample_analysis_cache.h"
+#include "model/sample/sample.h"
+#include "model/sample/sample_summary.h"
+#include "util/functions.h"
+#include <algorithm>
+#include <cstdio>
+
+extern "C" {
+#include "fatfs/ff.h"
+}
+
+#define SETTINGS_FOLDER "SETTINGS"
+#define ANALYSIS_FOLDER SETTINGS_FOLDER "/ANALYSIS"
+
+namespace SampleAnalysisCache {
+namespace {
+
+constexpr uint32_t kMagic = 0x4E415344; // "DSAN"
+constexpr uint16_t kVersion = 1;
+
+// Every Sample load looks in the folder, so it's kept to this many files. The card has no clock to give file dates, so
+// a random one gets removed to make room - anything still in use just gets analysed and written again
+constexpr int32_t kMaxFiles = 256;
+
+// Written just as it is in memory - the file's only ever read back by the same firmware, and the version takes care of
+// any change to this
+struct Header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t headerSize;
+
+	// Enough to be fairly sure it's still the same audio
+	uint32_t fileSize;
+	uint32_t firstSector;
+	uint32_t audioDataStartPosBytes;
+	uint32_t lengthInSamples;
+	uint32_t sampleRate;
+	uint8_t numChannels;
+	uint8_t byteDepth;
+	uint8_t rawDataFormat;
+
+	uint8_t pitchDoPrimeTest;
+	float pitchMinFreqHz;
+	float pitchMaxFreqHz;
+	float pitchMIDINote; // MIDI_NOTE_UNSET if none
+	int32_t beginningOffsetForPitchDetection; // 0 if not found
+
+	int32_t minValueFound;
+	int32_t maxValueFound;
+
+	uint32_t summaryNumFrames; // If not 0, all the summary's bins follow the header
+};
+
+void getFilePath(Sample& sample, char* path, size_t size) {
+	snprintf(path, size, ANALYSIS_FOLDER "/%08lX%08lX.DAT", (unsigned long)sample.clusters.getElement(0)->sdAddress,
+	         (unsigned long)sample.fileSizeOnCard);
+}
+
+void setIdentity(Header& header, Sample& sample) {
+	header.magic = kMagic;
+	header.version = kVersion;
+	header.headerSize = sizeof(Header);
+	header.fileSize = sample.fileSizeOnCard;
+	header.firstSector = sample.clusters.getElement(0)->sdAddress;
+	header.audioDataStartPosBytes = sample.audioDataStartPosBytes;
+	header.lengthInSamples = sample.lengthInSamples;
+	header.sampleRate = sample.sampleRate;
+	header.numChannels = sample.numChannels;
+	header.byteDepth = sample.byteDepth;
+	header.rawDataFormat = static_cast<uint8_t>(sample.rawDataFormat);
+}
+
+bool isForSample(Header const& header, Sample& sample) {
+	Header expected{};
+	setIdentity(expected, sample);
+	return header.magic == expected.magic && header.version == expected.version
+	       && header.headerSize == expected.headerSize && header.fileSize == expected.fileSize
+	       && header.firstSector == expected.firstSector
+	       && header.audioDataStartPosBytes == expected.audioDataStartPosBytes
+	       && header.lengthInSamples == expected.lengthInSamples && header.sampleRate == expected.sampleRate
+	       && header.numChannels == expected.numChannels && header.byteDepth == expected.byteDepth
+	       && header.rawDataFormat == expected.rawDataFormat;
+}
+
+void makeRoomForNewFile(char const* path) {
+	FILINFO fileInfo;
+	if (f_stat(path, &fileInfo) == FR_OK) {
+		return; // Replacing one that's already there
+	}
+
+	DIR dir;
+	if (f_opendir(&dir, ANALYSIS_FOLDER) != FR_OK) {
+		return;
+	}
+	int32_t numFiles = 0;
+	while (f_readdir(&dir, &fileInfo) == FR_OK && fileInfo.fname[0] != 0) {
+		numFiles++;
+	}
+	if (numFiles < kMaxFiles) {
+		f_closedir(&dir);
+		return;
+	}
+
+	int32_t toDelete = static_cast<uint32_t>(getNoise()) % numFiles;
+	f_readdir(&dir, nullptr); // Rewind
+	for (int32_t i = 0; f_readdir(&dir, &fileInfo) == FR_OK && fileInfo.fname[0] != 0; i++) {
+		if (i == toDelete) {
+			break;
+		}
+	}
+	f_closedir(&dir);
+
+	if (fileInfo.fname[0] != 0 && !(fileInfo.fattrib & AM_DIR)) {
+		char victimPath[sizeof(ANALYSIS_FOLDER) + sizeof(fileInfo.fname) + 1];
+		snprintf(victimPath, sizeof(victimPath), ANALYSIS_FOLDER "/%s", fileInfo.fname);
+		f_unlink(victimPath);
+	}
+}
+
+} // namespace
+
+void load(Sample& sample) {
+	if (sample.fileSizeOnCard == 0 || sample.clusters.getNumElements() == 0) {
+		return;
+	}
+
+	char path[48];
+	getFilePath(sample, path, sizeof(path));
+
+	FIL file;
+	if (f_open(&file, path, FA_READ) != FR_OK) {
+		return;
+	}
+	Header header;
+	UINT bytesRead;
+	FRESULT result = f_read(&file, &header, sizeof(header), &bytesRead);
+	f_close(&file);
+
+	if (result != FR_OK || bytesRead != sizeof(header) || !isForSample(header, sample)) {
+		return;
+	}
+
+	if (header.pitchMIDINote != MIDI_NOTE_UNSET) {
+		sample.detectedPitch = {header.pitchMinFreqHz, header.pitchMaxFreqHz, header.pitchDoPrimeTest != 0,
+		                        header.pitchMIDINote};
+	}
+	if (header.beginningOffsetForPitchDetection != 0) {
+		sample.beginningOffsetForPitchDetection = header.beginningOffsetForPitchDetection;
+		sample.beginningOffsetForPitchDetectionFound = true;
+	}
+	sample.minValueFound = std::min(sample.minValueFound, header.minValueFound);
+	sample.maxValueFound = std::max(sample.maxValueFound, header.maxValueFound);
+	sample.summaryNumFramesOnCard = header.summaryNumFrames;
+}
+
+bool loadSummary(Sample& sample) {
+	uint32_t numFrames = sample.summaryNumFramesOnCard;
+	SampleSummary* summary = SampleSummary::create(&sample, numFrames);
+	if (summary == nullptr) {
+		return false;
+	}
+
+	char path[48];
+	getFilePath(sample, path, sizeof(path));
+
+	size_t size = SampleSummary::getAllBinsSize(numFrames);
+	UINT bytesRead = 0;
+	FIL file;
+	FRESULT result = f_open(&file, path, FA_READ);
+	if (result == FR_OK) {
+		result = f_lseek(&file, sizeof(Header));
+		if (result == FR_OK) {
+			result = f_read(&file, summary->getAllBins(), size, &bytesRead);
+		}
+		f_close(&file);
+	}
+
+	// Don't keep trying if it's not there any more
+	if (result != FR_OK || bytesRead != size || summary->getNumFrames() != numFrames) {
+		summary->destroy();
+		sample.summaryNumFramesOnCard = 0;
+		return false;
+	}
+
+	sample.summary = summary;
+	for (int32_t c = 0; c < sample.clusters.getNumElements(); c++) {
+		sample.clusters.getElement(c)->summarised = true;
+	}
+	return true;
+}
+
+bool save(Sample& sample, bool includeSummary) {
+	if (sample.fileSizeOnCard == 0 || sample.clusters.getNumElements() == 0) {
+		return false;
+	}
+	includeSummary = includeSummary && sample.summary != nullptr;
+
+	Header header{};
+	setIdentity(header, sample);
+	header.pitchDoPrimeTest = sample.detectedPitch.doPrimeTest;
+	header.pitchMinFreqHz = sample.detectedPitch.minFreqHz;
+	header.pitchMaxFreqHz = sample.detectedPitch.maxFreqHz;
+	header.pitchMIDINote = sample.detectedPitch.midiNote;
+	header.beginningOffsetForPitchDetection =
+	    sample.beginningOffsetForPitchDetectionFound ? sample.beginningOffsetForPitchDetection : 0;
+	header.minValueFound = sample.minValueFound;
+	header.maxValueFound = sample.maxValueFound;
+	header.summaryNumFrames = includeSummary ? sample.summary->getNumFrames() : sample.summaryNumFramesOnCard;
+
+	char path[48];
+	getFilePath(sample, path, sizeof(path));
+
+	makeRoomForNewFile(path);
+
+	// Without a complete summary to write, just rewrite the header and leave any summary already there
+	BYTE mode = FA_WRITE | (includeSummary ? FA_CREATE_ALWAYS : FA_OPEN_ALWAYS);
+	FIL file;
+	FRESULT result = f_open(&file, path, mode);
+	if (result == FR_NO_PATH) {
+		f_mkdir(SETTINGS_FOLDER); // May give error, but no real consequence from that.
+		f_mkdir(ANALYSIS_FOLDER);
+		result = f_open(&file, path, mode);
+	}
+	if (result != FR_OK) {
+		return false;
+	}
+
+	UINT bytesWritten;
+	result = f_write(&file, &header, sizeof(header), &bytesWritten);
+	bool success = (result == FR_OK && bytesWritten == sizeof(header));
+	if (success && includeSummary) {
+		size_t size = SampleSummary::getAllBinsSize(header.summaryNumFrames);
+		result = f_write(&file, sample.summary->getAllBins(), size, &bytesWritten);
+		success = (result == FR_OK && bytesWritten == size);
+	}
+	success = (f_close(&file) == FR_OK) && success;
+
+	if (success && includeSummary) {
+		sample.summaryNumFramesOnCard = header.summaryNumFrames;
+	}
+	return success;
+}
+
+} // namespace SampleAnalysisCache
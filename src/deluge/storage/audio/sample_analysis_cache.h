@@ -0,0 +1,37 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class Sample;
+
+/// Things worked out about a Sample's audio - its detected pitch, the range of values found in it and its
+/// SampleSummary - kept in a small file on the card for each sample, so loading it again doesn't mean working them out
+/// again. The file is found by the sample file's size and the address of its first cluster, so it goes stale by itself
+/// if the sample's replaced or moved.
+namespace SampleAnalysisCache {
+
+/// Call once the Sample has been loaded. Only reads the summary's length - that gets loaded when it's needed
+void load(Sample& sample);
+/// Returns false if it couldn't be loaded, in which case the summary will have to be made again
+bool loadSummary(Sample& sample);
+/// Not to be called from the audio or card routines
+bool save(Sample& sample, bool includeSummary);
+
+} // namespace SampleAnalysisCache
@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Layout of the binary song / preset files written by BinarySerializer. It's the same tree of tags and attributes as
+// the XML files - the model code writes and reads both through the same Serializer / Deserializer calls - just
+// tokenised so nothing has to be scanned for or hex-decoded a char at a time.
+//
+// File:   kMagic, kVersion, tokens..., END
+// Tokens: one type byte, then a name (for all but CLOSE and END), then the payload. Lengths and ints are LEB128
+//         varints, ints zigzagged first.
+// Names:  a varint reference. 0 means the name follows inline (length, chars) and is then remembered under the next
+//         index, if it fits in the table. n means the name remembered under index n - 1.
+// VALUE:  a value written in pieces through Serializer::write(), like note and automation data. A run of chunks, each
+//         a varint of (length << 1) | isText and then the chunk. Chunks that aren't text hold the bytes behind runs of
+//         uppercase hex digit pairs, so hex data takes half the space and needs no decoding. A 0 ends the value.
+namespace BinaryFormat {
+
+constexpr char kMagic[] = "DLGB\x01"; // Includes kVersion, so it can be passed to closeAfterWriting()
+constexpr int32_t kMagicLength = 5;
+constexpr uint8_t kVersion = 1;
+
+enum Token : uint8_t {
+	END = 0,
+	OPEN = 1,   // Tag with children. Attributes are just the first of its children
+	CLOSE = 2,
+	INT = 3,    // Zigzag varint
+	STRING = 4, // Varint length, then chars
+	VALUE = 5,  // Chunks, see above
+};
+
+// Set on INT and STRING when they were written with writeTag(), i.e. as <name>value</name> in XML rather than as an
+// attribute. Readers treat the two the same, as they do in XML
+constexpr uint8_t kElementFlag = 0x80;
+constexpr uint8_t kTokenTypeMask = 0x7F;
+
+constexpr int32_t kMaxNames = 512;
+constexpr int32_t kMaxNameLength = 63;
+constexpr int32_t kNamePoolSize = 8192;
+
+constexpr uint32_t zigzag(int32_t value) {
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+constexpr int32_t unzigzag(uint32_t value) {
+	return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Both sides have to make the same call on whether a name gets remembered, or their indexes would drift apart
+constexpr bool shouldRememberName(int32_t numNames, int32_t poolUsed, int32_t length) {
+	return numNames < kMaxNames && length <= kMaxNameLength && poolUsed + length + 1 <= kNamePoolSize;
+}
+
+} // namespace BinaryFormat
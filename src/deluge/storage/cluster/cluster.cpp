@@ -29,17 +29,22 @@
 // The universal size of all clusters
 size_t Cluster::size = 32768;
 size_t Cluster::size_magnitude = 15;
+size_t Cluster::guardSize = 1024;
 
 void Cluster::setSize(size_t size) {
 	Cluster::size = size;
 
 	// Find the highest bit set
 	Cluster::size_magnitude = 32 - __builtin_clz(size) - 1;
+
+	// Enough for a whole render window of 24-bit stereo with 32k clusters, while costing only ~3% of each allocation
+	Cluster::guardSize = size >> 5;
 }
 
 Cluster* Cluster::create(Cluster::Type type, bool shouldAddReasons, void* dontStealFromThing) {
 	audioFileManager.setCardRead(); // even if it hasn't been we're now commited to the cluster size
-	void* memory = GeneralMemoryAllocator::get().allocStealable(sizeof(Cluster) + Cluster::size, dontStealFromThing);
+	void* memory = GeneralMemoryAllocator::get().allocStealable(sizeof(Cluster) + Cluster::size + Cluster::guardSize,
+	                                                              dontStealFromThing);
 	if (memory == nullptr) {
 		return nullptr;
 	}
@@ -177,8 +182,15 @@ StealableQueue Cluster::getAppropriateQueue() {
 
 	// Or, if it has a Sample...
 	else if (sample) {
-		q = sample->numReasonsToBeLoaded ? StealableQueue::CURRENT_SONG_SAMPLE_DATA
-		                                 : StealableQueue::NO_SONG_SAMPLE_DATA;
+		if (sample->numReasonsToBeLoaded > sample->numReasonsForNextSong) {
+			q = StealableQueue::CURRENT_SONG_SAMPLE_DATA;
+		}
+		else if (sample->numReasonsToBeLoaded) {
+			q = StealableQueue::NEXT_SONG_SAMPLE_DATA;
+		}
+		else {
+			q = StealableQueue::NO_SONG_SAMPLE_DATA;
+		}
 
 		if (sample->rawDataFormat != RawDataFormat::NATIVE) {
 			q = static_cast<StealableQueue>(util::to_underlying(q) + 1); // next queue
@@ -21,6 +21,7 @@
 #include "definitions_cxx.hpp"
 #include "memory/general_memory_allocator.h"
 #include "memory/stealable.h"
+#include "storage/cluster/cluster_priority_queue.h"
 #include <array>
 #include <cstdint>
 
@@ -30,7 +31,7 @@ class SampleCache;
 
 /// Header data for a cluster. The actual cluster data is expected to be in the same allocation, after this class
 /// member. To correctly allocate an instance of this class, you must also allocate Cluster::size bytes with enough
-/// padding to safely absorb an offset of at least CACHE_LINE_SIZE.
+/// padding to safely absorb an offset of at least CACHE_LINE_SIZE, plus Cluster::guardSize bytes after that.
 class Cluster final : public Stealable {
 public:
 	constexpr static size_t kSizeFAT16Max = 32768;
@@ -50,6 +51,9 @@ public:
 
 	static size_t size;
 	static size_t size_magnitude;
+	/// Bytes after the end of the data which hold a copy of the start of the next Cluster, so a reader can run a whole
+	/// render window on past the end of this one
+	static size_t guardSize;
 	static void setSize(size_t size);
 
 	/// Warning! do not call this constructor directly! It must be called via placement `new`
@@ -69,6 +73,8 @@ public:
 
 	bool extraBytesAtStartConverted = false;
 	bool extraBytesAtEndConverted = false;
+	// Whether the guard bytes after the end of the data have been copied from the next Cluster
+	bool guardBytesFilled = false;
 
 	Sample* sample = nullptr;
 	SampleCache* sampleCache = nullptr;
@@ -76,6 +82,9 @@ public:
 	char firstThreeBytesPreDataConversion[3];
 	bool loaded = false;
 
+	// Where this sits in AudioFileManager::loadingQueue, if it's waiting to be loaded
+	ClusterPriorityQueue::Link loadingQueueLink;
+
 	// MUST BE THE LAST TWO MEMBERS
 	char dummy[CACHE_LINE_SIZE];
 	char data[CACHE_LINE_SIZE];
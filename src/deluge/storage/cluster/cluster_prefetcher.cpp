@@ -0,0 +1,267 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "storage/cluster/cluster_prefetcher.h"
+#include "model/clip/clip_instance.h"
+#include "model/clip/instrument_clip.h"
+#include "model/note/note.h"
+#include "model/note/note_row.h"
+#include "model/sample/sample.h"
+#include "model/sample/sample_holder.h"
+#include "model/song/song.h"
+#include "playback/mode/arrangement.h"
+#include "playback/playback_handler.h"
+#include "processing/engines/audio_engine.h"
+#include "processing/sound/sound_drum.h"
+#include "processing/sound/sound_instrument.h"
+#include "storage/audio/audio_file_manager.h"
+#include "storage/cluster/cluster.h"
+#include "storage/multi_range/multi_range.h"
+#include <algorithm>
+
+ClusterPrefetcher clusterPrefetcher{};
+
+namespace {
+
+// Same band as a low-priority Voice, so anything a medium or high priority Voice is waiting on gets loaded first, and
+// nearer notes go first within it. Always comes before the start-marker Clusters, which are enqueued at the lowest
+// priority.
+constexpr uint32_t kPrefetchPriorityBase = 3u << 30;
+
+[[nodiscard]] bool isDueBefore(uint32_t time, uint32_t otherTime) {
+	return static_cast<int32_t>(time - otherTime) < 0;
+}
+
+} // namespace
+
+void ClusterPrefetcher::routine() {
+	uint32_t now = AudioEngine::audioSampleTimer;
+	for (Prefetch& prefetch : prefetches_) {
+		if (prefetch.sample != nullptr && !isDueBefore(now, prefetch.dueTime + kHoldSamples)) {
+			release(prefetch);
+		}
+	}
+
+	if (!playbackHandler.isEitherClockActive() || currentSong == nullptr) {
+		return;
+	}
+
+	uint32_t samplesPerTick = playbackHandler.getTimePerInternalTick();
+	if (samplesPerTick == 0) {
+		return;
+	}
+	int32_t numTicks = kLookaheadSamples / samplesPerTick;
+	if (numTicks == 0) {
+		return;
+	}
+
+	for (Output* output = currentSong->firstOutput; output != nullptr; output = output->next) {
+		Clip* clip = output->getActiveClip();
+		if (clip != nullptr && clip->type == ClipType::INSTRUMENT && currentSong->isClipActive(clip)) {
+			scanClip(static_cast<InstrumentClip*>(clip), false, 0, numTicks, samplesPerTick);
+		}
+	}
+
+	// In the arranger, also look at the ClipInstances which are about to start
+	if (currentPlaybackMode == &arrangement) {
+		int32_t pos = arrangement.lastProcessedPos;
+		for (Output* output = currentSong->firstOutput; output != nullptr; output = output->next) {
+			for (int32_t i = output->clipInstances.search(pos + 1, GREATER_OR_EQUAL);
+			     i < output->clipInstances.getNumElements(); i++) {
+				ClipInstance* clipInstance = output->clipInstances.getElement(i);
+				int32_t ticksAway = clipInstance->pos - pos;
+				if (ticksAway >= numTicks) {
+					break;
+				}
+				Clip* clip = clipInstance->clip;
+				if (clip != nullptr && clip->type == ClipType::INSTRUMENT) {
+					scanClip(static_cast<InstrumentClip*>(clip), true, ticksAway,
+					         std::min(numTicks - ticksAway, clipInstance->length), samplesPerTick);
+				}
+			}
+		}
+	}
+}
+
+// Goes through the notes of each NoteRow from its current play pos (or from the start, for a Clip which hasn't
+// started yet) for numTicks. Reversed and ping-pong playback aren't predicted.
+void ClusterPrefetcher::scanClip(InstrumentClip* clip, bool fromStart, int32_t ticksAway, int32_t numTicks,
+                                 uint32_t samplesPerTick) {
+	OutputType outputType = clip->output->type;
+	if (outputType != OutputType::SYNTH && outputType != OutputType::KIT) {
+		return;
+	}
+
+	uint32_t now = AudioEngine::audioSampleTimer;
+
+	for (int32_t r = 0; r < clip->noteRows.getNumElements(); r++) {
+		NoteRow* noteRow = clip->noteRows.getElement(r);
+		if (noteRow->muted || noteRow->hasNoNotes()) {
+			continue;
+		}
+
+		Sound* sound;
+		int32_t noteCode;
+		if (outputType == OutputType::KIT) {
+			if (noteRow->drum == nullptr || noteRow->drum->type != DrumType::SOUND) {
+				continue;
+			}
+			sound = static_cast<SoundDrum*>(noteRow->drum);
+			noteCode = kNoteForDrum;
+		}
+		else {
+			sound = static_cast<SoundInstrument*>(clip->output);
+			noteCode = noteRow->getNoteCode();
+		}
+
+		bool independent = noteRow->hasIndependentPlayPos();
+		bool reversed = independent && noteRow->sequenceDirectionMode != SequenceDirection::OBEY_PARENT
+		                    ? noteRow->currentlyPlayingReversedIfIndependent
+		                    : clip->currentlyPlayingReversed;
+		if (reversed || clip->sequenceDirectionMode == SequenceDirection::PINGPONG) {
+			continue;
+		}
+
+		int32_t loopLength = noteRow->loopLengthIfIndependent ? noteRow->loopLengthIfIndependent : clip->loopLength;
+		int32_t pos = 0;
+		if (!fromStart) {
+			pos = independent ? noteRow->lastProcessedPosIfIndependent : clip->lastProcessedPos;
+			pos++; // The note at the current pos has already been actioned
+		}
+		int32_t ticksLeft = std::min(numTicks, loopLength);
+
+		// Walk forward, wrapping around the loop end if the window goes past it
+		int32_t i = noteRow->notes.search(pos, GREATER_OR_EQUAL);
+		int32_t ticksBeforeThisLap = ticksAway - pos;
+		while (ticksLeft > 0) {
+			if (i >= noteRow->notes.getNumElements()) {
+				ticksLeft -= loopLength - pos;
+				ticksBeforeThisLap += loopLength;
+				pos = 0;
+				i = 0;
+				continue;
+			}
+			Note* note = noteRow->notes.getElement(i);
+			if (note->pos >= loopLength) {
+				i = noteRow->notes.getNumElements();
+				continue;
+			}
+			if (note->pos - pos >= ticksLeft) {
+				break;
+			}
+			uint32_t dueTime = now + (ticksBeforeThisLap + note->pos) * samplesPerTick;
+			prefetchForSound(*sound, noteCode, dueTime);
+			i++;
+		}
+	}
+}
+
+void ClusterPrefetcher::prefetchForSound(Sound& sound, int32_t noteCode, uint32_t dueTime) {
+	for (int32_t s = 0; s < kNumSources; s++) {
+		Source& source = sound.sources[s];
+		if (source.oscType != OscType::SAMPLE || source.ranges.getNumElements() == 0) {
+			continue;
+		}
+		MultiRange* range = source.ranges.getElement(source.getRangeIndex(noteCode));
+		auto* holder = static_cast<SampleHolder*>(range->getAudioFileHolder());
+		if (holder->audioFile != nullptr) {
+			prefetch(*holder, source.sampleControls.isCurrentlyReversed(), dueTime);
+		}
+	}
+}
+
+void ClusterPrefetcher::prefetch(SampleHolder& holder, bool reversed, uint32_t dueTime) {
+	auto* sample = static_cast<Sample*>(holder.audioFile);
+	if (sample->unloadable) {
+		return;
+	}
+
+	int32_t playDirection = reversed ? -1 : 1;
+	int32_t firstClusterIndex = (holder.getStartPlaybackAtByte(reversed) >> Cluster::size_magnitude)
+	                            + playDirection * kNumClustersLoadedAhead;
+
+	Prefetch* slot = nullptr;
+	Prefetch* latestDue = nullptr;
+	for (Prefetch& prefetch : prefetches_) {
+		if (prefetch.sample == nullptr) {
+			if (slot == nullptr) {
+				slot = &prefetch;
+			}
+			continue;
+		}
+
+		// Already got these - just make sure they're held for long enough
+		if (prefetch.sample == sample && prefetch.firstClusterIndex == firstClusterIndex
+		    && prefetch.playDirection == playDirection) {
+			if (isDueBefore(prefetch.dueTime, dueTime)) {
+				prefetch.dueTime = dueTime;
+			}
+			return;
+		}
+
+		if (latestDue == nullptr || isDueBefore(latestDue->dueTime, prefetch.dueTime)) {
+			latestDue = &prefetch;
+		}
+	}
+
+	// If full, a note that's due sooner takes over from the one that's due last
+	if (slot == nullptr) {
+		if (latestDue == nullptr || !isDueBefore(dueTime, latestDue->dueTime)) {
+			return;
+		}
+		release(*latestDue);
+		slot = latestDue;
+	}
+
+	uint32_t samplesAway = std::max<int32_t>(0, static_cast<int32_t>(dueTime - AudioEngine::audioSampleTimer));
+	uint32_t priorityRating = kPrefetchPriorityBase + std::min<uint32_t>(samplesAway, ~kPrefetchPriorityBase - 1);
+
+	sample->addReason();
+	slot->sample = sample;
+	slot->firstClusterIndex = firstClusterIndex;
+	slot->playDirection = playDirection;
+	slot->dueTime = dueTime;
+
+	int32_t clusterIndex = firstClusterIndex;
+	for (Cluster*& cluster : slot->clusters) {
+		if (clusterIndex < sample->getFirstClusterIndexWithAudioData()
+		    || clusterIndex >= sample->getFirstClusterIndexWithNoAudioData()) {
+			break;
+		}
+		cluster = sample->clusters.getElement(clusterIndex)->getCluster(sample, clusterIndex, CLUSTER_ENQUEUE,
+		                                                                priorityRating);
+		clusterIndex += playDirection;
+	}
+}
+
+void ClusterPrefetcher::release(Prefetch& prefetch) {
+	for (Cluster* cluster : prefetch.clusters) {
+		if (cluster != nullptr) {
+			audioFileManager.removeReasonFromCluster(*cluster, "E454");
+		}
+	}
+	prefetch.sample->removeReason("E455");
+	prefetch = Prefetch{};
+}
+
+void ClusterPrefetcher::releaseAll() {
+	for (Prefetch& prefetch : prefetches_) {
+		if (prefetch.sample != nullptr) {
+			release(prefetch);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "definitions_cxx.hpp"
+#include <array>
+#include <cstdint>
+
+class Cluster;
+class InstrumentClip;
+class Sample;
+class SampleHolder;
+class Sound;
+
+/// Cluster loading is otherwise reactive: a SampleHolder keeps the Clusters at its start marker loaded, and a Voice
+/// only enqueues the ones after that as it reaches them. On big kits streamed from a slow card, that can leave a Voice
+/// waiting on a Cluster that isn't loaded yet.
+///
+/// This looks a short way ahead of the playhead, at the notes of every playing InstrumentClip (and the ClipInstances
+/// about to start, in the arranger), and enqueues the Clusters those notes will read after their start Clusters. Each
+/// one is held until a while after its note was due, by which time the Voice has claimed what it needs.
+class ClusterPrefetcher {
+public:
+	/// How many Clusters to fetch for each note, beyond the kNumClustersLoadedAhead the SampleHolder already keeps
+	static constexpr int32_t kNumClustersPerNote = 4;
+	static constexpr int32_t kMaxNumPrefetches = 24;
+	/// How far ahead of the playhead to look
+	static constexpr uint32_t kLookaheadSamples = kSampleRate / 2;
+	/// How long to keep hold of the Clusters after their note was due
+	static constexpr uint32_t kHoldSamples = kSampleRate;
+
+	/// Call regularly. Lets go of anything past its time, then rescans if playback is running
+	void routine();
+	void releaseAll();
+
+private:
+	struct Prefetch {
+		Sample* sample = nullptr;
+		int32_t firstClusterIndex = 0;
+		int32_t playDirection = 1;
+		uint32_t dueTime = 0;
+		std::array<Cluster*, kNumClustersPerNote> clusters{};
+	};
+
+	void scanClip(InstrumentClip* clip, bool fromStart, int32_t ticksAway, int32_t numTicks, uint32_t samplesPerTick);
+	void prefetchForSound(Sound& sound, int32_t noteCode, uint32_t dueTime);
+	void prefetch(SampleHolder& holder, bool reversed, uint32_t dueTime);
+	void release(Prefetch& prefetch);
+
+	std::array<Prefetch, kMaxNumPrefetches> prefetches_{};
+};
+
+extern ClusterPrefetcher clusterPrefetcher;
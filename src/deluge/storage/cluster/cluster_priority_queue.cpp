@@ -17,26 +17,103 @@
 
 #include "storage/cluster/cluster_priority_queue.h"
 #include "definitions.h"
-#include "definitions_cxx.hpp"
-#include "util/exceptions.h"
-#include <cstdlib>
+#include "storage/cluster/cluster.h"
+#include <bit>
+#include <limits>
 
-class Cluster;
-
-// Returns error
 Error ClusterPriorityQueue::push(Cluster& cluster, uint32_t priority) {
-	if (auto search = queued_clusters_.find(&cluster); search != queued_clusters_.end()) {
-		priority_map_.erase({search->second, &cluster});
+	Link& link = cluster.loadingQueueLink;
+	if (link.queued) {
+		unlink(cluster);
 	}
 
-	try {
-		priority_map_.insert({priority, &cluster});
-		queued_clusters_[&cluster] = priority;
-	} catch (deluge::exception e) {
-		if (e == deluge::exception::BAD_ALLOC) {
-			return Error::INSUFFICIENT_RAM;
-		}
-		FREEZE_WITH_ERROR("EXPQ");
+	int32_t b = getBand(priority);
+	Band& band = bands_[b];
+
+	// Walk back from the tail to find where it goes. Equal ratings stay first-come, first-served
+	Cluster* prev = band.tail;
+	while (prev != nullptr && prev->loadingQueueLink.priority > priority) {
+		prev = prev->loadingQueueLink.prev;
+	}
+
+	link.priority = priority;
+	link.queued = true;
+	link.prev = prev;
+	if (prev != nullptr) {
+		link.next = prev->loadingQueueLink.next;
+		prev->loadingQueueLink.next = &cluster;
+	}
+	else {
+		link.next = band.head;
+		band.head = &cluster;
+	}
+
+	if (link.next != nullptr) {
+		link.next->loadingQueueLink.prev = &cluster;
+	}
+	else {
+		band.tail = &cluster;
 	}
+
+	occupiedBands_[b >> 5] |= (1u << (b & 31));
+	numQueued_++;
 	return Error::NONE;
 }
+
+Cluster& ClusterPriorityQueue::front() const {
+	return *bands_[getFirstOccupiedBand()].head;
+}
+
+void ClusterPriorityQueue::pop() {
+	unlink(front());
+}
+
+size_t ClusterPriorityQueue::erase(Cluster& cluster) {
+	if (!cluster.loadingQueueLink.queued) {
+		return 0;
+	}
+	unlink(cluster);
+	return 1;
+}
+
+bool ClusterPriorityQueue::hasAnyLowestPriority() const {
+	Cluster* last = bands_[kNumBands - 1].tail;
+	return last != nullptr && last->loadingQueueLink.priority == std::numeric_limits<uint32_t>::max();
+}
+
+int32_t ClusterPriorityQueue::getFirstOccupiedBand() const {
+	for (size_t w = 0; w < occupiedBands_.size(); w++) {
+		if (occupiedBands_[w] != 0) {
+			return (w << 5) + std::countr_zero(occupiedBands_[w]);
+		}
+	}
+	FREEZE_WITH_ERROR("EPQE"); // front() of an empty queue
+	return 0;
+}
+
+void ClusterPriorityQueue::unlink(Cluster& cluster) {
+	Link& link = cluster.loadingQueueLink;
+	int32_t b = getBand(link.priority);
+	Band& band = bands_[b];
+
+	if (link.prev != nullptr) {
+		link.prev->loadingQueueLink.next = link.next;
+	}
+	else {
+		band.head = link.next;
+	}
+
+	if (link.next != nullptr) {
+		link.next->loadingQueueLink.prev = link.prev;
+	}
+	else {
+		band.tail = link.prev;
+	}
+
+	if (band.head == nullptr) {
+		occupiedBands_[b >> 5] &= ~(1u << (b & 31));
+	}
+
+	link = Link{};
+	numQueued_--;
+}
@@ -17,44 +17,61 @@
 
 #pragma once
 
-#include "util/containers.h"
+#include "definitions_cxx.hpp"
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <limits>
 
 class Cluster;
 
+/// Clusters waiting to be loaded from the card, lowest priority rating first. This is pushed to from the audio routine,
+/// so it never allocates: each Cluster carries its own Link, and Clusters are sorted into bands by the top bits of
+/// their priority rating. A bitmap of occupied bands makes finding the front a couple of bit-scans. Within a band,
+/// Clusters are kept in full priority order, and ratings in one band are close, so the sorted insert is short.
 class ClusterPriorityQueue {
 	using Priority = uint32_t;
 
 public:
+	/// Lives inside each Cluster, so queueing one needs no memory of its own
+	struct Link {
+		Cluster* next = nullptr;
+		Cluster* prev = nullptr;
+		Priority priority = 0;
+		bool queued = false;
+	};
+
+	/// The top 8 bits of a Voice's priority rating are its manual priority, voice count and envelope state
+	static constexpr int32_t kNumBandBits = 8;
+	static constexpr int32_t kNumBands = 1 << kNumBandBits;
+
 	ClusterPriorityQueue() = default;
+	ClusterPriorityQueue(const ClusterPriorityQueue&) = delete;
+	ClusterPriorityQueue& operator=(const ClusterPriorityQueue&) = delete;
 
+	/// If the Cluster is already queued, it's moved to its new priority
 	Error push(Cluster& cluster, uint32_t priorityRating);
-	constexpr Cluster& front() const { return *priority_map_.begin()->second; }
-
-	constexpr void pop() {
-		auto it = priority_map_.begin();
-		priority_map_.erase(it);
-		queued_clusters_.erase(it->second);
-	}
-
-	constexpr bool empty() const { return queued_clusters_.empty() || priority_map_.empty(); }
-	constexpr size_t erase(Cluster& cluster) {
-		if (auto search = queued_clusters_.find(&cluster); search != queued_clusters_.end()) {
-			priority_map_.erase({search->second, &cluster});
-			queued_clusters_.erase(&cluster);
-			return 1;
-		}
-		return 0;
-	}
+	[[nodiscard]] Cluster& front() const;
+	void pop();
+
+	[[nodiscard]] constexpr bool empty() const { return numQueued_ == 0; }
+	[[nodiscard]] constexpr size_t size() const { return numQueued_; }
+	size_t erase(Cluster& cluster);
 
 	/* This is currently a consequence of how priorities are calculated (using full 32bits) next-gen getPriorityRating
 	 * should return an int32_t */
-	constexpr bool hasAnyLowestPriority() const {
-		return !priority_map_.empty() && priority_map_.rbegin()->first == std::numeric_limits<uint32_t>::max();
-	}
+	[[nodiscard]] bool hasAnyLowestPriority() const;
 
 private:
-	deluge::fast_set<std::pair<Priority, Cluster*>> priority_map_;
-	deluge::fast_unordered_map<Cluster*, Priority> queued_clusters_;
+	struct Band {
+		Cluster* head = nullptr;
+		Cluster* tail = nullptr;
+	};
+
+	static constexpr int32_t getBand(Priority priority) { return static_cast<int32_t>(priority >> (32 - kNumBandBits)); }
+	[[nodiscard]] int32_t getFirstOccupiedBand() const;
+	void unlink(Cluster& cluster);
+
+	std::array<Band, kNumBands> bands_{};
+	std::array<uint32_t, kNumBands / 32> occupiedBands_{};
+	size_t numQueued_ = 0;
 };
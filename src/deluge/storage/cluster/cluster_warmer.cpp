@@ -0,0 +1,145 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "storage/cluster/cluster_warmer.h"
+#include "model/clip/audio_clip.h"
+#include "model/clip/instrument_clip.h"
+#include "model/note/note_row.h"
+#include "model/sample/sample.h"
+#include "model/sample/sample_holder.h"
+#include "model/song/clip_iterators.h"
+#include "model/song/song.h"
+#include "processing/sound/sound_drum.h"
+#include "processing/sound/sound_instrument.h"
+#include "storage/audio/audio_file_manager.h"
+#include "storage/cluster/cluster.h"
+#include "storage/multi_range/multi_range.h"
+
+ClusterWarmer clusterWarmer{};
+
+void ClusterWarmer::warm(Song& song) {
+	for (Output* output = song.firstOutput; output != nullptr; output = output->next) {
+		Clip* clip = output->getActiveClip();
+		if (clip == nullptr || !song.isClipActive(clip)) {
+			continue;
+		}
+
+		if (output->type == OutputType::SYNTH) {
+			warmSound(*static_cast<SoundInstrument*>(output));
+		}
+		else if (output->type == OutputType::KIT) {
+			auto* instrumentClip = static_cast<InstrumentClip*>(clip);
+			for (int32_t r = 0; r < instrumentClip->noteRows.getNumElements(); r++) {
+				NoteRow* noteRow = instrumentClip->noteRows.getElement(r);
+				if (!noteRow->muted && !noteRow->hasNoNotes() && noteRow->drum != nullptr
+				    && noteRow->drum->type == DrumType::SOUND) {
+					warmSound(*static_cast<SoundDrum*>(noteRow->drum));
+				}
+			}
+		}
+	}
+
+	for (AudioClip* clip : AudioClips::everywhere(&song)) {
+		if (clip->isActiveOnOutput() && song.isClipActive(clip)) {
+			warmHolder(clip->sampleHolder, clip->sampleControls.isCurrentlyReversed());
+		}
+	}
+}
+
+void ClusterWarmer::warmSound(Sound& sound) {
+	for (int32_t s = 0; s < kNumSources; s++) {
+		Source& source = sound.sources[s];
+		if (source.oscType != OscType::SAMPLE) {
+			continue;
+		}
+		for (int32_t e = 0; e < source.ranges.getNumElements(); e++) {
+			auto* holder = static_cast<SampleHolder*>(source.ranges.getElement(e)->getAudioFileHolder());
+			warmHolder(*holder, source.sampleControls.isCurrentlyReversed());
+		}
+	}
+}
+
+void ClusterWarmer::warmHolder(SampleHolder& holder, bool reversed) {
+	if (numSamples_ == kMaxNumSamples || holder.filePath.isEmpty()) {
+		return;
+	}
+
+	auto maybeSample = audioFileManager.getAudioFileFromFilename(holder.filePath, true, nullptr, AudioFileType::SAMPLE);
+	if (!maybeSample.has_value() || maybeSample.value() == nullptr) {
+		return;
+	}
+	auto* sample = static_cast<Sample*>(maybeSample.value());
+	if (sample->unloadable) {
+		return;
+	}
+
+	// Several holders often share a Sample, e.g. a kit with one file sliced into drums. Only the first one is warmed
+	for (int32_t i = 0; i < numSamples_; i++) {
+		if (warms_[i].sample == sample) {
+			return;
+		}
+	}
+
+	Warm& warm = warms_[numSamples_++];
+	sample->addReason();
+	sample->numReasonsForNextSong++;
+	warm.sample = sample;
+
+	int32_t playDirection = reversed ? -1 : 1;
+	int32_t clusterIndex = holder.getStartPlaybackAtByte(*sample, reversed) >> Cluster::size_magnitude;
+	for (Cluster*& cluster : warm.clusters) {
+		if (clusterIndex < sample->getFirstClusterIndexWithAudioData()
+		    || clusterIndex >= sample->getFirstClusterIndexWithNoAudioData()) {
+			break;
+		}
+		// At the lowest priority, same as the start Clusters claimed by a SampleHolder
+		cluster = sample->clusters.getElement(clusterIndex)->getCluster(sample, clusterIndex, CLUSTER_ENQUEUE);
+		clusterIndex += playDirection;
+	}
+}
+
+void ClusterWarmer::routine() {
+	for (int32_t i = 0; i < numSamples_; i++) {
+		for (Cluster*& cluster : warms_[i].clusters) {
+			if (cluster != nullptr && cluster->loaded) {
+				audioFileManager.removeReasonFromCluster(*cluster, "E456");
+				cluster = nullptr;
+			}
+		}
+	}
+}
+
+// Any Cluster not loaded yet just gets taken out of the loading queue
+void ClusterWarmer::releaseClusters(Warm& warm) {
+	for (Cluster*& cluster : warm.clusters) {
+		if (cluster != nullptr) {
+			audioFileManager.removeReasonFromCluster(*cluster, "E457");
+			cluster = nullptr;
+		}
+	}
+}
+
+void ClusterWarmer::releaseAll() {
+	for (int32_t i = 0; i < numSamples_; i++) {
+		Warm& warm = warms_[i];
+		releaseClusters(warm);
+		warm.sample->numReasonsForNextSong--;
+		warm.sample->removeReason("E458");
+		warm = Warm{};
+	}
+	numSamples_ = 0;
+}
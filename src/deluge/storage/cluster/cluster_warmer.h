@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "definitions_cxx.hpp"
+#include <array>
+#include <cstdint>
+
+class Cluster;
+class Sample;
+class SampleHolder;
+class Song;
+class Sound;
+
+/// Gets the Clusters at the start markers of a Song which isn't playing yet loaded, so that when it's swapped in, its
+/// SampleHolders find them already in RAM rather than all of them going to the card at once on the downbeat.
+///
+/// Unlike a SampleHolder, this only holds on to each Cluster until it's loaded. After that, the Sample it belongs to
+/// keeps a reason to be loaded, counted in its numReasonsForNextSong, which files the Cluster in the NEXT_SONG queues.
+/// Those come after the NO_SONG ones, but before anything the current Song is using, so the current Song never loses
+/// out to this.
+class ClusterWarmer {
+public:
+	static constexpr int32_t kMaxNumSamples = 64;
+
+	/// Looks at the Clips which will be playing when the Song is swapped in, as Song::loadCrucialSamplesOnly() would,
+	/// reading the headers of any Samples that aren't in RAM yet, and enqueues their start Clusters
+	void warm(Song& song);
+	/// Call regularly. Lets go of each Cluster as soon as it's loaded
+	void routine();
+	/// Once the Song's own SampleHolders have claimed their Samples, or the Song's been discarded
+	void releaseAll();
+	[[nodiscard]] bool isWarming() const { return numSamples_ != 0; }
+
+private:
+	struct Warm {
+		Sample* sample = nullptr;
+		std::array<Cluster*, kNumClustersLoadedAhead> clusters{};
+	};
+
+	void warmSound(Sound& sound);
+	void warmHolder(SampleHolder& holder, bool reversed);
+	void releaseClusters(Warm& warm);
+
+	std::array<Warm, kMaxNumSamples> warms_{};
+	int32_t numSamples_ = 0;
+};
+
+extern ClusterWarmer clusterWarmer;
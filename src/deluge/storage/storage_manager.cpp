@@ -64,16 +64,21 @@ PLACE_SDRAM_BSS XMLSerializer smSerializer;
 PLACE_SDRAM_BSS XMLDeserializer smDeserializer;
 PLACE_SDRAM_BSS JsonSerializer smJsonSerializer;
 PLACE_SDRAM_BSS JsonDeserializer smJsonDeserializer;
+PLACE_SDRAM_BSS BinarySerializer smBinarySerializer;
+PLACE_SDRAM_BSS BinaryDeserializer smBinaryDeserializer;
 FileDeserializer* activeDeserializer = &smDeserializer;
 
 const bool writeJsonFlag = false;
 
+// Whichever of smSerializer and smBinarySerializer last had a file created for it
+Serializer* activeSerializer = &smSerializer;
+
 Serializer& GetSerializer() {
 	if (writeJsonFlag) {
 		return smJsonSerializer;
 	}
 	else {
-		return smSerializer;
+		return *activeSerializer;
 	}
 }
 
@@ -186,6 +191,7 @@ Error StorageManager::createXMLFile(char const* filePath, XMLSerializer& writer,
 	}
 	writer.writeFIL = created.value().inner();
 	writer.reset();
+	activeSerializer = &writer;
 	if (!writeJsonFlag) {
 		writer.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
 	}
@@ -208,6 +214,24 @@ Error StorageManager::createJsonFile(char const* filePath, JsonSerializer& write
 	return Error::NONE;
 }
 
+Error StorageManager::createBinaryFile(char const* filePath, BinarySerializer& writer, bool mayOverwrite,
+                                       bool displayErrors) {
+	auto created = createFile(filePath, mayOverwrite);
+	writer.reset();
+	if (!created) {
+		if (displayErrors) {
+			display->removeWorkingAnimation();
+			display->displayError(created.error());
+		}
+		return created.error();
+	}
+	writer.writeFIL = created.value().inner();
+	writer.reset();
+	activeSerializer = &writer;
+	writer.writeChars(BinaryFormat::kMagic);
+	return Error::NONE;
+}
+
 bool StorageManager::fileExists(char const* pathName) {
 	Error error = initSD();
 	if (error != Error::NONE) {
@@ -704,10 +728,30 @@ Error StorageManager::openJsonFile(FilePointer* filePointer, JsonDeserializer& r
 	return Error::FILE_CORRUPTED;
 }
 
+Error StorageManager::openBinaryFile(FilePointer* filePointer, BinaryDeserializer& reader, char const* firstTagName,
+                                     char const* altTagName, bool ignoreIncorrectFirmware) {
+
+	AudioEngine::logAction("openBinaryFile");
+	reader.reset();
+	// Prep to read first Cluster shortly
+	openFilePointer(filePointer, reader);
+	Error err = reader.openBinaryFile(filePointer, firstTagName, altTagName, ignoreIncorrectFirmware);
+	activeDeserializer = &reader;
+	if (err == Error::NONE)
+		return Error::NONE;
+	reader.closeWriter();
+
+	return err;
+}
+
 Error StorageManager::openDelugeFile(FileItem* currentFileItem, char const* firstTagName, char const* altTagName,
                                      bool ignoreIncorrectFirmware) {
 	Error error;
-	if (currentFileItem->filename.contains(".Json")) {
+	if (currentFileItem->filename.contains(".DLB")) {
+		error = StorageManager::openBinaryFile(&currentFileItem->filePointer, smBinaryDeserializer, firstTagName,
+		                                       altTagName, ignoreIncorrectFirmware);
+	}
+	else if (currentFileItem->filename.contains(".Json")) {
 		error = StorageManager::openJsonFile(&currentFileItem->filePointer, smJsonDeserializer, firstTagName,
 		                                     altTagName, ignoreIncorrectFirmware);
 	}
@@ -781,6 +825,7 @@ void FileReader::resetReader() {
 	}
 	readCount = 0;
 	reachedBufferEnd = false;
+	readResult = FR_OK;
 }
 
 // Returns whether successful loading took place
@@ -817,8 +862,8 @@ bool FileReader::readFileCluster() {
 		return true;
 	}
 
-	FRESULT result = f_read(&readFIL, (UINT*)fileClusterBuffer, Cluster::size, &currentReadBufferEndPos);
-	if (result) {
+	readResult = f_read(&readFIL, (UINT*)fileClusterBuffer, Cluster::size, &currentReadBufferEndPos);
+	if (readResult) {
 		return false;
 	}
 
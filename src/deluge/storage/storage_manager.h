@@ -21,6 +21,7 @@
 #include "extern.h"
 #include "fatfs/fatfs.hpp"
 #include "model/sync.h"
+#include "storage/binary_format.h"
 #include "util/firmware_version.h"
 
 #include <cstdint>
@@ -78,6 +79,7 @@ protected:
 	bool memoryBased = false;
 	int32_t readCount; // Used for multitask interleaving.
 	bool reachedBufferEnd;
+	FRESULT readResult = FR_OK; // From the last cluster read, so running out of file can be told from the card failing
 	void resetReader();
 };
 
@@ -212,6 +214,7 @@ public:
 class XMLDeserializer : public FileDeserializer {
 public:
 	XMLDeserializer();
+	XMLDeserializer(uint8_t* inbuf, size_t buflen);
 	~XMLDeserializer() override = default;
 
 	bool prepareToReadTagOrAttributeValueOneCharAtATime() override;
@@ -349,10 +352,133 @@ private:
 	Error readStringUntilChar(String* string, char endChar);
 };
 
+class BinarySerializer : public Serializer, public FileWriter {
+public:
+	BinarySerializer();
+	~BinarySerializer() override = default;
+
+	void writeAttribute(char const* name, int32_t number, bool onNewLine = true) override;
+	void writeAttribute(char const* name, char const* value, bool onNewLine = true) override;
+	void writeAttributeHex(char const* name, int32_t number, int32_t numChars, bool onNewLine = true) override;
+	void writeAttributeHexBytes(char const* name, uint8_t* data, int32_t numBytes, bool onNewLine = true) override;
+	void writeTagNameAndSeperator(char const* tag) override;
+	void writeTag(char const* tag, int32_t number, bool box = false) override;
+	void writeTag(char const* tag, char const* contents, bool box = false, bool quote = true) override;
+	void writeOpeningTag(char const* tag, bool startNewLineAfter = true, bool box = false) override;
+	void writeOpeningTagBeginning(char const* tag, bool box = false, bool newLineBefore = true) override;
+	void writeOpeningTagEnd(bool startNewLineAfter = true) override {}
+	void closeTag(bool box = false) override;
+	void writeClosingTag(char const* tag, bool shouldPrintIndents = true, bool box = false) override;
+	void writeArrayStart(char const* tag, bool shouldPrintIndents = true, bool box = false) override;
+	void writeArrayEnding(char const* tag, bool shouldPrintIndents = true, bool box = false) override;
+	void printIndents() override {}
+	void insertCommaIfNeeded() override {}
+	// Only does anything inside a value begun with writeTagNameAndSeperator() - everything else is XML formatting
+	void write(char const* output) override;
+	// The beginning and end strings are XML ones, so the binary file's own header and footer get checked instead
+	Error closeFileAfterWriting(char const* path = nullptr, char const* beginningString = nullptr,
+	                            char const* endString = nullptr) override;
+	void reset() override;
+
+private:
+	static constexpr int32_t kNumNameSlots = 1024; // Power of two, and well over BinaryFormat::kMaxNames
+	static constexpr int32_t kValueChunkSize = 256;
+
+	enum class ValueState : uint8_t { NONE, AWAITING_QUOTE, IN_VALUE };
+
+	void writeVarint(uint32_t value);
+	void writeToken(uint8_t token, char const* name);
+	void writeName(char const* name);
+	void writeString(char const* string);
+
+	void beginValue(char const* name);
+	void appendValueChar(char thisChar);
+	void appendValueByte(uint8_t byte, bool isText);
+	void flushValueChunk();
+	void endValue();
+	void finishPendingValue();
+
+	ValueState valueState;
+	char pendingNibble; // A hex digit still waiting for its pair, or 0
+	bool chunkIsText;
+	int32_t chunkLength;
+	uint8_t chunk[kValueChunkSize];
+
+	int32_t numNames;
+	int32_t namePoolUsed;
+	uint16_t nameOffsets[BinaryFormat::kMaxNames];
+	uint16_t nameSlots[kNumNameSlots]; // Name index + 1, or 0 if empty
+	char namePool[BinaryFormat::kNamePoolSize];
+};
+
+class BinaryDeserializer : public FileDeserializer {
+public:
+	BinaryDeserializer();
+	BinaryDeserializer(uint8_t* inbuf, size_t buflen);
+	~BinaryDeserializer() override = default;
+
+	bool prepareToReadTagOrAttributeValueOneCharAtATime() override;
+	char const* readNextTagOrAttributeName() override;
+	char readNextCharOfTagOrAttributeValue() override;
+	int32_t getNumCharsRemainingInValueBeforeEndOfCluster() override;
+
+	int32_t readTagOrAttributeValueInt() override;
+	int32_t readTagOrAttributeValueHex(int32_t errorValue) override;
+	int readTagOrAttributeValueHexBytes(uint8_t* bytes, int32_t maxLen) override;
+
+	char const* readNextCharsOfTagOrAttributeValue(int32_t numChars) override;
+	Error readTagOrAttributeValueString(String* string) override;
+	char const* readTagOrAttributeValue() override;
+	bool match(char const ch) override { return true; }
+
+	void exitTag(char const* exitTagName = NULL, bool closeObject = false) override;
+	Error openBinaryFile(FilePointer* filePointer, char const* firstTagName, char const* altTagName = "",
+	                     bool ignoreIncorrectFirmware = false);
+	void reset() override;
+
+	Error tryReadingFirmwareTagFromFile(char const* tagName, bool ignoreIncorrectFirmware) override;
+
+private:
+	enum class ValueKind : uint8_t { NONE, INT, STRING, CHUNKED };
+
+	bool readByte(uint8_t* byte);
+	bool readBytes(char* dest, uint32_t numBytes); // dest may be NULL to skip
+	bool readVarint(uint32_t* value);
+	char const* readName();
+	uint8_t readToken(char const** name);
+	bool readValueChunkHeader();
+
+	bool readValueChar(char* thisChar);
+	void skipValue();
+	void finishValue();
+	Error readFailure();
+
+	ValueKind valueKind;
+	bool reachedEndToken;
+	int32_t intValue;
+	uint32_t chunkRemaining;
+	bool chunkIsText;
+	char lowNibbleChar; // Second hex digit of a byte that's been half handed out, or 0
+	char intChars[12];
+	int32_t intCharPos;
+
+	int32_t tagDepthCaller; // As in XMLDeserializer
+	int32_t tagDepthFile;
+
+	char stringBuffer[kFilenameBufferSize];
+
+	int32_t numNames;
+	int32_t namePoolUsed;
+	uint16_t nameOffsets[BinaryFormat::kMaxNames];
+	char namePool[BinaryFormat::kNamePoolSize];
+};
+
 extern XMLSerializer smSerializer;
 extern XMLDeserializer smDeserializer;
 extern JsonSerializer smJsonSerializer;
 extern JsonDeserializer smJsonDeserializer;
+extern BinarySerializer smBinarySerializer;
+extern BinaryDeserializer smBinaryDeserializer;
 extern Serializer& GetSerializer();
 extern FileDeserializer* activeDeserializer;
 
@@ -366,6 +492,10 @@ Error openXMLFile(FilePointer* filePointer, XMLDeserializer& reader, char const*
                   char const* altTagName = "", bool ignoreIncorrectFirmware = false);
 Error openJsonFile(FilePointer* filePointer, JsonDeserializer& reader, char const* firstTagName,
                    char const* altTagName = "", bool ignoreIncorrectFirmware = false);
+Error createBinaryFile(char const* pathName, BinarySerializer& writer, bool mayOverwrite = false,
+                       bool displayErrors = true);
+Error openBinaryFile(FilePointer* filePointer, BinaryDeserializer& reader, char const* firstTagName,
+                     char const* altTagName = "", bool ignoreIncorrectFirmware = false);
 Error openDelugeFile(FileItem* currentFileItem, char const* firstTagName, char const* altTagName = "",
                      bool ignoreIncorrectFirmware = false);
 Error initSD();
@@ -204,6 +204,7 @@ void readInputsForHardwareTest(bool testButtonStates[9][16]) {
 	}
 
 	midiEngine.checkIncomingSerialMidi();
+	midiEngine.dispatchQueuedMidiMessages();
 	midiEngine.flushMIDI();
 
 	encoders::readEncoders();
@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace deluge {
+
+namespace tag_table_detail {
+// Not constexpr, so calling one of these while making a table at compile time is a compile error
+inline void noSeedFound() {}
+inline void duplicateName() {}
+inline void unknownName() {}
+} // namespace tag_table_detail
+
+/// Finds which of a fixed set of tag names a string is, with one hash and one string compare - rather than a strcmp()
+/// for each name in turn. The table gets worked out at compile time: there are at least 8 slots per name, and the hash
+/// is seeded differently until no two names share a slot. Make one with makeTagTable(), then switch on what find()
+/// gives, with table["someName"] as each case label - which is checked at compile time too.
+template <size_t N>
+class TagTable {
+	static_assert(N > 0 && N < 255, "slots only hold 8 bits");
+
+public:
+	constexpr static int32_t kNotFound = -1;
+	constexpr static size_t kNumSlots = std::bit_ceil(N * 8);
+	constexpr static uint32_t kMaxSeed = 10000;
+
+	consteval explicit TagTable(std::array<std::string_view, N> const& newNames) : names(newNames) {
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = 0; j < i; j++) {
+				if (names[i] == names[j]) {
+					tag_table_detail::duplicateName();
+				}
+			}
+		}
+
+		for (seed = 0; seed < kMaxSeed; seed++) {
+			if (trySeed()) {
+				return;
+			}
+		}
+		tag_table_detail::noSeedFound();
+	}
+
+	/// Returns the name's index in the array the table was made from, or kNotFound
+	[[nodiscard]] constexpr int32_t find(char const* name) const {
+		uint32_t h = getStartingHash(seed);
+		size_t length = 0;
+		for (; name[length] != 0; length++) {
+			h = hashChar(h, name[length]);
+		}
+		return checkSlot(h, std::string_view(name, length));
+	}
+
+	[[nodiscard]] constexpr int32_t find(std::string_view name) const {
+		uint32_t h = getStartingHash(seed);
+		for (char c : name) {
+			h = hashChar(h, c);
+		}
+		return checkSlot(h, name);
+	}
+
+	/// The index of a name which must be in the table - for a case label, or comparing find()'s result against
+	consteval int32_t operator[](std::string_view name) const {
+		int32_t index = find(name);
+		if (index == kNotFound) {
+			tag_table_detail::unknownName();
+		}
+		return index;
+	}
+
+	[[nodiscard]] constexpr std::string_view getName(int32_t index) const { return names[index]; }
+
+private:
+	constexpr static uint32_t getStartingHash(uint32_t seed) { return 2166136261u ^ (seed * 0x9E3779B9u); }
+	// FNV-1a
+	constexpr static uint32_t hashChar(uint32_t h, char c) { return (h ^ static_cast<uint8_t>(c)) * 16777619u; }
+	// FNV's low bits aren't well mixed on their own, and those are the ones that pick the slot
+	constexpr static size_t getSlot(uint32_t h) {
+		h ^= h >> 15;
+		h *= 0x2C1B3C6Du;
+		h ^= h >> 12;
+		return h & (kNumSlots - 1);
+	}
+
+	constexpr int32_t checkSlot(uint32_t h, std::string_view name) const {
+		uint8_t slot = slots[getSlot(h)];
+		if (slot == 0 || names[slot - 1] != name) {
+			return kNotFound;
+		}
+		return slot - 1;
+	}
+
+	consteval bool trySeed() {
+		slots.fill(0);
+		for (size_t i = 0; i < N; i++) {
+			uint32_t h = getStartingHash(seed);
+			for (char c : names[i]) {
+				h = hashChar(h, c);
+			}
+			uint8_t& slot = slots[getSlot(h)];
+			if (slot != 0) {
+				return false;
+			}
+			slot = i + 1;
+		}
+		return true;
+	}
+
+	std::array<std::string_view, N> names;
+	std::array<uint8_t, kNumSlots> slots{}; // Index of the name in each slot, plus one. 0 means empty
+	uint32_t seed = 0;
+};
+
+template <size_t N>
+consteval TagTable<N> makeTagTable(std::string_view const (&names)[N]) {
+	return TagTable<N>(std::to_array(names));
+}
+
+} // namespace deluge
@@ -34,6 +34,7 @@ bool memIsNumericChars(char const* mem, int32_t size);
 bool stringIsNumericChars(char const* str);
 
 char halfByteToHexChar(uint8_t thisHalfByte);
+char hexCharToHalfByte(unsigned char hexChar);
 void intToHex(uint32_t number, char* output, int32_t numChars = 8);
 uint32_t hexToInt(char const* string);
 uint32_t hexToIntFixedLength(char const* __restrict__ hexChars, int32_t length);
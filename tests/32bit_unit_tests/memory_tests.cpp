@@ -2,12 +2,15 @@
 #include "CppUTestExt/MockSupport.h"
 #include "definitions_cxx.hpp"
 #include "memory/memory_region.h"
+#include "memory/slab_allocator.h"
 #include "model/sample/sample.h"
 #include "storage/cluster/cluster.h"
 #include "storage/wave_table/wave_table.h"
 #include "util/functions.h"
+#include <chrono>
 #include <iostream>
 #include <stdlib.h>
+#include <vector>
 #define NUM_TEST_ALLOCATIONS 1024
 #define MEM_SIZE 10000000
 
@@ -154,6 +157,91 @@ TEST(MemoryAllocation, uniformAllocation) {
 	mock().checkExpectations();
 };
 
+TEST(MemoryAllocation, stealTelemetry) {
+	uint32_t size = 1 << 20;
+	mock().disable();
+	for (int i = 0; i < NUM_TEST_ALLOCATIONS; i += 1) {
+		void* testalloc = memreg.alloc(size, true, NULL);
+		StealableTest* stealable = new (testalloc) StealableTest();
+		memreg.cache_manager().QueueForReclamation(StealableQueue{0}, stealable);
+	}
+	mock().enable();
+
+	const CacheManagerStats& cacheStats = memreg.cache_manager().getStats();
+	CHECK(nSteals > 0);
+	CHECK_EQUAL(nSteals, cacheStats.steals[0]);
+	CHECK_EQUAL(0, cacheStats.steals[1]);
+	CHECK(cacheStats.bytesStolen[0] >= nSteals * size);
+	CHECK(cacheStats.bytesReclaimed >= nSteals * size);
+	CHECK_EQUAL(0, cacheStats.numFailedReclaims);
+
+	const MemoryRegionStats& stats = memreg.getStats();
+	CHECK(stats.numSearches >= NUM_TEST_ALLOCATIONS);
+	CHECK(stats.getAverageSearchLength() >= 1);
+	CHECK_EQUAL(0, stats.numFailedAllocations);
+	uint32_t numInHistogram = 0;
+	for (uint32_t count : stats.freeSpaceHistogram) {
+		numInHistogram += count;
+	}
+	CHECK_EQUAL(stats.numFreeSpaces, numInHistogram);
+	CHECK(stats.largestFreeRun <= stats.totalFree);
+
+	// Nothing to steal from outside the stealable queues, so this has to fail and be counted
+	CHECK(memreg.alloc(0x04000000, false, NULL) == NULL);
+	CHECK_EQUAL(1, memreg.getStats().numFailedAllocations);
+	CHECK_EQUAL(1, cacheStats.numFailedReclaims);
+};
+
+TEST(MemoryAllocation, longestRunIndex) {
+	// Alternate stealables with allocations, so that no stealable has any neighbouring memory to add to its run
+	uint32_t size = 1 << 16;
+	std::vector<StealableTest*> stealables;
+	std::vector<void*> allocations;
+	while (void* testalloc = memreg.alloc(size, true, NULL)) {
+		stealables.push_back(new (testalloc) StealableTest());
+		void* allocation = memreg.alloc(size, false, NULL);
+		if (!allocation) {
+			break;
+		}
+		allocations.push_back(allocation);
+	}
+	// Fill whatever is left over, after the last pair
+	for (uint32_t fillSize : {4096, 256, 1}) {
+		while (memreg.alloc(fillSize, false, NULL)) {}
+	}
+	CHECK(allocations.size() > 4);
+
+	uint32_t stealableSize = getAllocatedSize(stealables[0]);
+	for (StealableTest* stealable : stealables) {
+		memreg.cache_manager().QueueForReclamation(StealableQueue{0}, stealable);
+	}
+	CHECK_EQUAL(stealableSize, memreg.cache_manager().longest_runs(0));
+	CHECK_EQUAL(0, memreg.cache_manager().longest_runs(1));
+
+	// No run is long enough, so the queue shouldn't even be looked through
+	mock().expectNoCall("steal");
+	CHECK(memreg.alloc(2 * size, false, NULL) == NULL);
+	CHECK_EQUAL(0, memreg.getStats().numNeighbourGrabs);
+	mock().checkExpectations();
+
+	// Freeing memory between two stealables joins them into a run that can take it
+	memreg.dealloc(allocations[2]);
+	CHECK_EQUAL(3 * stealableSize + 16, memreg.cache_manager().longest_runs(0));
+	mock().expectOneCall("steal");
+	CHECK(memreg.alloc(2 * size, false, NULL) != NULL);
+	mock().checkExpectations();
+	CHECK_EQUAL(1, nSteals);
+};
+
+TEST(MemoryAllocation, freeSpaceSizeClasses) {
+	CHECK_EQUAL(0, MemoryRegion::getFreeSpaceSizeClass(63));
+	CHECK_EQUAL(1, MemoryRegion::getFreeSpaceSizeClass(64));
+	CHECK_EQUAL(1, MemoryRegion::getFreeSpaceSizeClass(255));
+	CHECK_EQUAL(2, MemoryRegion::getFreeSpaceSizeClass(256));
+	CHECK_EQUAL(kNumFreeSpaceSizeClasses - 1, MemoryRegion::getFreeSpaceSizeClass(1 << 18));
+	CHECK_EQUAL(kNumFreeSpaceSizeClasses - 1, MemoryRegion::getFreeSpaceSizeClass(1 << 29));
+};
+
 TEST(MemoryAllocation, allocationStructure) {
 	// this is technically random
 	int expectedAllocations = 1000;
@@ -337,4 +425,165 @@ TEST(MemoryAllocation, stealableAllocations) {
 	CHECK(efficiency > 0.994);
 	mock().checkExpectations();
 };
+
+TEST_GROUP(SlabAllocation) {
+	SlabAllocator slabs;
+	uint32_t arena_size = 1 << 16;
+	void* arena = malloc(arena_size);
+	void setup() {
+		memset(arena, 0, arena_size);
+		slabs.setup((uint32_t)arena, (uint32_t)arena + arena_size);
+	}
+	void teardown() { free(arena); }
+};
+
+TEST(SlabAllocation, sizeClasses) {
+	CHECK_EQUAL(0, SlabAllocator::getSizeClass(1));
+	CHECK_EQUAL(0, SlabAllocator::getSizeClass(16));
+	CHECK_EQUAL(1, SlabAllocator::getSizeClass(17));
+	CHECK_EQUAL(3, SlabAllocator::getSizeClass(128));
+	CHECK_EQUAL(-1, SlabAllocator::getSizeClass(129));
+	CHECK(slabs.alloc(129) == nullptr);
+};
+
+TEST(SlabAllocation, slotsAreAlignedAndDontOverlap) {
+	void* testAllocations[NUM_TEST_ALLOCATIONS];
+	uint32_t testSizes[NUM_TEST_ALLOCATIONS];
+	for (int i = 0; i < NUM_TEST_ALLOCATIONS; i++) {
+		uint32_t size = (rand() % SlabAllocator::kMaxSlotSize) + 1;
+		testAllocations[i] = slabs.alloc(size);
+		if (!testAllocations[i]) {
+			testSizes[i] = 0;
+			continue;
+		}
+		testSizes[i] = slabs.getAllocatedSize(testAllocations[i]);
+		CHECK(slabs.owns(testAllocations[i]));
+		CHECK(testSizes[i] >= size);
+		CHECK_EQUAL(0, (uint32_t)testAllocations[i] % testSizes[i]);
+		testWritingMemory(testAllocations[i], testSizes[i]);
+	}
+	for (int i = 0; i < NUM_TEST_ALLOCATIONS; i++) {
+		if (testAllocations[i]) {
+			CHECK(testReadingMemory(testAllocations[i], testSizes[i]));
+		}
+	}
+};
+
+TEST(SlabAllocation, emptyPagesGoBackToArena) {
+	uint32_t numPages = slabs.getNumFreePages();
+	CHECK(numPages > 0);
+
+	std::vector<void*> testAllocations;
+	while (void* testalloc = slabs.alloc(64)) {
+		testAllocations.push_back(testalloc);
+	}
+	CHECK_EQUAL(0, slabs.getNumFreePages());
+	CHECK_EQUAL(numPages * (SlabAllocator::kPageSize / 64), testAllocations.size());
+	CHECK_EQUAL(1, slabs.getStats(2).numFailedAllocations);
+	DOUBLES_EQUAL(1.0, slabs.getOccupancy(2), 0.0001);
+
+	// Once freed, the pages can be used by another class
+	for (void* testalloc : testAllocations) {
+		slabs.dealloc(testalloc);
+	}
+	CHECK_EQUAL(numPages, slabs.getNumFreePages());
+	CHECK_EQUAL(0, slabs.getStats(2).numSlotsUsed);
+	CHECK_EQUAL(testAllocations.size(), slabs.getStats(2).maxSlotsUsed);
+	CHECK(slabs.alloc(128) != nullptr);
+};
+
+// Benchmark - the same churn of small allocations, through the slabs and through a MemoryRegion of the same size
+TEST(SlabAllocation, throughputAgainstRegion) {
+	constexpr int kNumLive = 256;
+	constexpr int kNumOperations = 200000;
+	MemoryRegion memreg;
+	uint32_t empty_spaze_size = sizeof(EmptySpaceRecord) * 256;
+	void* emptySpacesMemory = malloc(empty_spaze_size);
+	void* raw_mem = malloc(arena_size);
+	memset(emptySpacesMemory, 0, empty_spaze_size);
+	memreg.setup(emptySpacesMemory, empty_spaze_size, (uint32_t)raw_mem, (uint32_t)raw_mem + arena_size, nullptr);
+
+	auto churn = [&](auto doAlloc, auto doDealloc) {
+		srand(1);
+		void* live[kNumLive] = {nullptr};
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < kNumOperations; i++) {
+			int j = rand() % kNumLive;
+			if (live[j]) {
+				doDealloc(live[j]);
+				live[j] = nullptr;
+			}
+			else {
+				live[j] = doAlloc((rand() % SlabAllocator::kMaxSlotSize) + 1);
+			}
+		}
+		auto time = std::chrono::steady_clock::now() - start;
+		for (void* address : live) {
+			if (address) {
+				doDealloc(address);
+			}
+		}
+		return std::chrono::duration<double, std::nano>(time).count() / kNumOperations;
+	};
+
+	double slabTime =
+	    churn([&](uint32_t size) { return slabs.alloc(size); }, [&](void* address) { slabs.dealloc(address); });
+	double regionTime = churn([&](uint32_t size) { return memreg.alloc(size, false, NULL); },
+	                          [&](void* address) { memreg.dealloc(address); });
+
+	std::cout << "Small allocation ns per op, slabs: " << slabTime << " region: " << regionTime << std::endl;
+	CHECK(slabTime < regionTime);
+	free(emptySpacesMemory);
+	free(raw_mem);
+};
+
+// Benchmark - fill the same amount of memory with a random mix of small sizes, freeing some as we go, and see how much
+// gets in before the first failure
+TEST(SlabAllocation, fragmentationAgainstRegion) {
+	MemoryRegion memreg;
+	uint32_t empty_spaze_size = sizeof(EmptySpaceRecord) * 1024;
+	void* emptySpacesMemory = malloc(empty_spaze_size);
+	void* raw_mem = malloc(arena_size);
+	memset(emptySpacesMemory, 0, empty_spaze_size);
+	memreg.setup(emptySpacesMemory, empty_spaze_size, (uint32_t)raw_mem, (uint32_t)raw_mem + arena_size, nullptr);
+
+	auto fill = [&](auto doAlloc, auto doDealloc) {
+		srand(1);
+		std::vector<std::pair<void*, uint32_t>> live;
+		uint32_t liveBytes = 0;
+		while (true) {
+			// Free one in four as we go, so the free space gets broken up
+			if (!live.empty() && rand() % 4 == 0) {
+				int j = rand() % live.size();
+				doDealloc(live[j].first);
+				liveBytes -= live[j].second;
+				live[j] = live.back();
+				live.pop_back();
+			}
+			uint32_t size = (rand() % SlabAllocator::kMaxSlotSize) + 1;
+			void* address = doAlloc(size);
+			if (!address) {
+				break;
+			}
+			live.push_back({address, size});
+			liveBytes += size;
+		}
+		for (auto& [address, size] : live) {
+			doDealloc(address);
+		}
+		return float(liveBytes) / float(arena_size);
+	};
+
+	float slabEfficiency =
+	    fill([&](uint32_t size) { return slabs.alloc(size); }, [&](void* address) { slabs.dealloc(address); });
+	float regionEfficiency = fill([&](uint32_t size) { return memreg.alloc(size, false, NULL); },
+	                              [&](void* address) { memreg.dealloc(address); });
+
+	std::cout << "Small allocation efficiency at first failure, slabs: " << slabEfficiency
+	          << " region: " << regionEfficiency << std::endl;
+	// Size classes round up, so up to half of each slot can be slack, but the slabs must still hold a fair share
+	CHECK(slabEfficiency > 0.5);
+	free(emptySpacesMemory);
+	free(raw_mem);
+};
 } // namespace
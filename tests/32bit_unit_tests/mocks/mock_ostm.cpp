@@ -0,0 +1,10 @@
+#include <chrono>
+extern "C" {
+#include "RZA1/ostm/ostm.h"
+}
+
+// Free running like the real OSTM, at its 33.33MHz
+uint32_t getTimerValue(int timerNo) {
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count() / 30);
+}
@@ -0,0 +1,272 @@
+#include "CppUTest/TestHarness.h"
+#include "model/clip/clip_event_schedule.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kNoEvent = 2147483647;
+constexpr int64_t kSlope = 1000; // How far the automated param moves per tick
+
+enum class EventType { NOTE, AUTOMATION_NODE, ROW_NOTE };
+
+struct Event {
+	int64_t tick;
+	int32_t clip;
+	EventType type;
+	int64_t value; // The param's value for AUTOMATION_NODE, the row for ROW_NOTE
+
+	bool operator==(Event const& other) const = default;
+};
+
+// Stands in for an InstrumentClip, with what Session::doTickForward() cares about: notes, automation nodes that a
+// param interpolates between, and NoteRows with a length of their own. Like the real thing, positions are moved along
+// for every Clip on every tick by incrementPos() - as Session::considerLaunchEvent() does - and events only happen in
+// processCurrentPos(), which is told how many ticks to catch the param up on
+struct SimulatedClip {
+	struct Row {
+		int32_t length;
+		std::vector<int32_t> notes;
+		int32_t pos = 0;
+	};
+
+	int32_t loopLength;
+	std::vector<int32_t> notes;
+	std::vector<int32_t> nodes;
+	std::vector<Row> rows;
+
+	int32_t pos = 0;
+	int64_t paramValue = 0;
+	int32_t timesProcessed = 0;
+	ClipEventSchedule eventSchedule;
+
+	void incrementPos(int32_t numTicks) {
+		pos += numTicks;
+		for (Row& row : rows) {
+			row.pos += numTicks;
+		}
+	}
+
+	// Returns the ticks til this Clip's next event
+	int32_t processCurrentPos(int64_t now, int32_t ticksSinceLast, int32_t clipIndex, std::vector<Event>& events) {
+		eventSchedule.processed(now);
+		timesProcessed++;
+
+		if (pos >= loopLength) {
+			pos -= loopLength;
+		}
+		paramValue += kSlope * ticksSinceLast;
+
+		int32_t ticksTilNextEvent = loopLength - pos;
+		auto lookAt = [&](std::vector<int32_t> const& positions, int32_t here, EventType type, int64_t value) {
+			for (int32_t position : positions) {
+				if (position == here) {
+					events.push_back({now, clipIndex, type, value});
+				}
+				else if (position > here) {
+					ticksTilNextEvent = std::min(ticksTilNextEvent, position - here);
+				}
+			}
+		};
+		lookAt(notes, pos, EventType::NOTE, 0);
+		lookAt(nodes, pos, EventType::AUTOMATION_NODE, paramValue);
+
+		for (int32_t r = 0; r < rows.size(); r++) {
+			Row& row = rows[r];
+			if (row.pos >= row.length) {
+				row.pos -= row.length;
+			}
+			ticksTilNextEvent = std::min(ticksTilNextEvent, row.length - row.pos);
+			lookAt(row.notes, row.pos, EventType::ROW_NOTE, r);
+		}
+		return ticksTilNextEvent;
+	}
+};
+
+// A note put into a Clip while it's playing, which calls expectEvent() on it
+struct Edit {
+	int64_t atTick;
+	int32_t clip;
+	int32_t notePos;
+};
+
+// Plays the song the way PlaybackHandler and Session do, jumping from one swung tick that has an event to the next.
+// Returns how many times a Clip got processed
+int64_t play(std::vector<SimulatedClip>& clips, bool skipIdleClips, int64_t numTicks, std::vector<Event>& events,
+             std::vector<Edit> edits = {}) {
+	int64_t now = 0;
+	int32_t posIncrement = 0;
+	int64_t numProcessed = 0;
+
+	while (now < numTicks) {
+		for (SimulatedClip& clip : clips) {
+			clip.incrementPos(posIncrement);
+		}
+
+		int32_t swungTicksTilNextEvent = kNoEvent;
+		for (int32_t c = 0; c < clips.size(); c++) {
+			SimulatedClip& clip = clips[c];
+			int32_t ticksSinceLast = posIncrement;
+
+			// As in Session::doTickForward()
+			if (skipIdleClips && clip.eventSchedule.isWorkedOut()) {
+				int64_t ticksTilDue = clip.eventSchedule.ticksTilDue(now);
+				if (ticksTilDue > 0) {
+					swungTicksTilNextEvent = std::min<int64_t>(ticksTilDue, swungTicksTilNextEvent);
+					continue;
+				}
+				ticksSinceLast = clip.eventSchedule.ticksSinceProcessed(now);
+			}
+
+			clip.eventSchedule.beginWorkingOut(now);
+			int32_t clipTicksTilNextEvent = clip.processCurrentPos(now, ticksSinceLast, c, events);
+			clip.eventSchedule.workedOut(now, clipTicksTilNextEvent);
+			swungTicksTilNextEvent = std::min(swungTicksTilNextEvent, clipTicksTilNextEvent);
+			numProcessed++;
+		}
+
+		// An edit between events brings the next one forward to just after it, as PlaybackHandler::expectEvent() does
+		for (Edit const& edit : edits) {
+			if (edit.atTick >= now && edit.atTick < now + swungTicksTilNextEvent) {
+				clips[edit.clip].notes.push_back(edit.notePos);
+				clips[edit.clip].eventSchedule.invalidate();
+				swungTicksTilNextEvent = edit.atTick + 1 - now;
+			}
+		}
+
+		posIncrement = swungTicksTilNextEvent;
+		now += posIncrement;
+	}
+	return numProcessed;
+}
+
+// A 4 bar Clip with a beat's worth of notes in every bar, keeping things busy every 24 ticks
+SimulatedClip busyClip() {
+	SimulatedClip clip{.loopLength = 384};
+	for (int32_t pos = 0; pos < clip.loopLength; pos += 24) {
+		clip.notes.push_back(pos);
+	}
+	return clip;
+}
+
+// A 4 bar Clip with hardly anything in it: a note, an automation node the param interpolates to and then back round
+// the loop point from, and a NoteRow 5 steps long, which doesn't line up with the Clip's loop
+SimulatedClip sparseClip() {
+	return SimulatedClip{
+	    .loopLength = 384, .notes = {96}, .nodes = {300}, .rows = {{.length = 120, .notes = {100}}}};
+}
+
+// Random Clips of 1 to 8 bars, most of them with only a few events
+std::vector<SimulatedClip> randomSong(int32_t numClips) {
+	std::vector<SimulatedClip> clips;
+	uint32_t random = 1234;
+	auto nextRandom = [&](uint32_t range) {
+		random = 69069 * random + 1234567;
+		return (int32_t)((random >> 8) % range);
+	};
+
+	for (int32_t c = 0; c < numClips; c++) {
+		SimulatedClip clip{.loopLength = 96 * (1 + nextRandom(8))};
+		int32_t numEvents = (c % 10 == 0) ? 32 : 1 + nextRandom(3);
+		for (int32_t e = 0; e < numEvents; e++) {
+			clip.notes.push_back(nextRandom(clip.loopLength / 6) * 6);
+		}
+		clip.nodes.push_back(nextRandom(clip.loopLength));
+		if (nextRandom(2)) {
+			int32_t rowLength = 24 * (3 + nextRandom(14));
+			clip.rows.push_back({.length = rowLength, .notes = {nextRandom(rowLength)}});
+		}
+		clips.push_back(clip);
+	}
+	return clips;
+}
+
+} // namespace
+
+TEST_GROUP(ClipEventScheduleTest){};
+
+TEST(ClipEventScheduleTest, sparseClipsStillFireOnTimeAcrossTheirLoopPoint) {
+	std::vector<SimulatedClip> clips = {busyClip(), sparseClip()};
+	std::vector<Event> events;
+	constexpr int64_t kNumTicks = 384 * 5;
+	play(clips, true, kNumTicks, events);
+
+	int32_t numNotes = 0;
+	int32_t numNodes = 0;
+	int32_t numRowNotes = 0;
+	for (Event const& event : events) {
+		if (event.clip != 1) {
+			continue;
+		}
+		switch (event.type) {
+		case EventType::NOTE:
+			CHECK_EQUAL(96, event.tick % 384);
+			numNotes++;
+			break;
+		case EventType::AUTOMATION_NODE:
+			// The param has been caught up on every tick it was skipped for, including back round the loop point
+			CHECK_EQUAL(300, event.tick % 384);
+			CHECK_EQUAL(kSlope * event.tick, event.value);
+			numNodes++;
+			break;
+		case EventType::ROW_NOTE:
+			CHECK_EQUAL(100, event.tick % 120);
+			numRowNotes++;
+			break;
+		}
+	}
+	CHECK_EQUAL(5, numNotes);
+	CHECK_EQUAL(5, numNodes);
+	CHECK_EQUAL(16, numRowNotes); // 100, 220, ... 1900
+
+	// Processed only for its own events, its loop points and its NoteRow's, at most - rather than every 24 ticks with
+	// the busy Clip too
+	CHECK(clips[1].timesProcessed <= 1 + numNotes + numNodes + numRowNotes + 5 + 16);
+	CHECK(clips[1].timesProcessed < clips[0].timesProcessed);
+}
+
+TEST(ClipEventScheduleTest, anEditBringsASkippedClipBackInTime) {
+	std::vector<SimulatedClip> clips = {busyClip(), sparseClip()};
+	std::vector<Event> events;
+	// Partway between the sparse Clip's events, put a note in it 30 ticks on
+	play(clips, true, 384 * 2, events, {{.atTick = 130, .clip = 1, .notePos = 160}});
+
+	CHECK(std::find(events.begin(), events.end(), Event{160, 1, EventType::NOTE, 0}) != events.end());
+	CHECK(std::find(events.begin(), events.end(), Event{384 + 160, 1, EventType::NOTE, 0}) != events.end());
+}
+
+TEST(ClipEventScheduleTest, cutShortProcessingMeansProcessingEveryTick) {
+	ClipEventSchedule schedule;
+	schedule.beginWorkingOut(10);
+	schedule.processed(10);
+	schedule.workedOut(10, kNoEvent);
+	CHECK_FALSE(schedule.isWorkedOut());
+}
+
+TEST(ClipEventScheduleTest, oneHundredClipsMatchProcessingEveryClip) {
+	constexpr int32_t kNumClips = 100;
+	constexpr int64_t kNumTicks = 96 * 4 * 64;
+
+	std::vector<SimulatedClip> everyClipSong = randomSong(kNumClips);
+	std::vector<Event> everyClipEvents;
+	auto start = std::chrono::steady_clock::now();
+	int64_t everyClipProcessed = play(everyClipSong, false, kNumTicks, everyClipEvents);
+	double everyClipTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<SimulatedClip> skippingSong = randomSong(kNumClips);
+	std::vector<Event> skippingEvents;
+	start = std::chrono::steady_clock::now();
+	int64_t skippingProcessed = play(skippingSong, true, kNumTicks, skippingEvents);
+	double skippingTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << kNumClips << " clips over " << kNumTicks << " ticks, processing every clip: " << everyClipProcessed
+	          << " in " << everyClipTime << "s, skipping idle clips: " << skippingProcessed << " in " << skippingTime
+	          << "s" << std::endl;
+
+	// Only what happened is checked - how long either took depends too much on what else the machine's doing
+	CHECK_EQUAL(everyClipEvents.size(), skippingEvents.size());
+	CHECK(everyClipEvents == skippingEvents);
+	CHECK(skippingProcessed * 4 < everyClipProcessed);
+}
@@ -0,0 +1,190 @@
+#include "CppUTest/TestHarness.h"
+#include "dsp/convolution/impulse_response_processor.h"
+#include "dsp/convolution/partitioned_convolver.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kLatency = PartitionedConvolver::kBlockSize;
+
+struct Random {
+	uint32_t state;
+	q31_t next() {
+		state = 69069 * state + 1234567;
+		return (q31_t)state;
+	}
+};
+
+// Noise at about the level audio reaches the effects at
+std::vector<q31_t> makeInput(int32_t length, uint32_t seed) {
+	Random random{seed};
+	std::vector<q31_t> input(length);
+	for (q31_t& sample : input) {
+		sample = random.next() >> 4;
+	}
+	return input;
+}
+
+// Decaying noise, like a room
+std::vector<q31_t> makeIR(int32_t length, uint32_t seed) {
+	Random random{seed};
+	std::vector<q31_t> ir(length);
+	for (int32_t i = 0; i < length; i++) {
+		ir[i] = (int64_t)(random.next() >> 3) * (length - i) / length;
+	}
+	return ir;
+}
+
+/// Every tap at every sample - the reference, and what ImpulseResponseProcessor does
+std::vector<q31_t> convolveDirectly(std::vector<q31_t> const& input, std::vector<q31_t> const& ir) {
+	std::vector<q31_t> output(input.size());
+	for (size_t n = 0; n < input.size(); n++) {
+		int64_t sum = 0;
+		for (size_t k = 0; k < ir.size() && k <= n; k++) {
+			sum += (int64_t)input[n - k] * ir[k];
+		}
+		output[n] = (sum + (1 << 30)) >> 31;
+	}
+	return output;
+}
+
+struct Convolver {
+	Convolver(std::vector<std::vector<q31_t>> const& irs)
+	    : memory(PartitionedConvolver::getMemorySize(irs[0].size(), irs.size()) / sizeof(int64_t) + 1),
+	      convolver(memory.data(), irs[0].size(), irs.size()) {
+		for (size_t c = 0; c < irs.size(); c++) {
+			for (int32_t p = 0; p < PartitionedConvolver::getNumPartitions(irs[c].size()); p++) {
+				int32_t start = p * PartitionedConvolver::kBlockSize;
+				convolver.setPartition(c, p, &irs[c][start], irs[c].size() - start);
+			}
+		}
+	}
+
+	// In uneven lengths, so blocks come in at different points in them
+	std::vector<StereoSample> process(std::vector<q31_t> const& l, std::vector<q31_t> const& r) {
+		std::vector<StereoSample> buffer(l.size());
+		for (size_t i = 0; i < l.size(); i++) {
+			buffer[i] = {l[i], r[i]};
+		}
+		size_t done = 0;
+		for (int32_t length = 1; done < buffer.size(); length = length * 7 % 173) {
+			size_t numFrames = std::min<size_t>(length, buffer.size() - done);
+			convolver.process(std::span(buffer).subspan(done, numFrames), 0, ONE_Q31);
+			done += numFrames;
+		}
+		return buffer;
+	}
+
+	std::vector<int64_t> memory;
+	PartitionedConvolver convolver;
+};
+
+// The FFTs round at every stage, so this is a long way under the level of the output but not exact
+void checkClose(std::vector<q31_t> const& expected, std::vector<StereoSample> const& output, bool right) {
+	for (size_t n = 0; n + kLatency < output.size(); n++) {
+		q31_t actual = right ? output[n + kLatency].r : output[n + kLatency].l;
+		CHECK(std::abs(actual - expected[n]) < 1024);
+	}
+	for (int32_t n = 0; n < kLatency; n++) {
+		CHECK_EQUAL(0, right ? output[n].r : output[n].l);
+	}
+}
+
+} // namespace
+
+TEST_GROUP(ConvolutionTest){};
+
+TEST(ConvolutionTest, monoIRMatchesDirectForm) {
+	std::vector<q31_t> ir = makeIR(1000, 1);
+	std::vector<q31_t> l = makeInput(4000, 2);
+	std::vector<q31_t> r = makeInput(4000, 3);
+	Convolver convolver({ir});
+	std::vector<StereoSample> output = convolver.process(l, r);
+	checkClose(convolveDirectly(l, ir), output, false);
+	checkClose(convolveDirectly(r, ir), output, true);
+}
+
+TEST(ConvolutionTest, stereoIRMatchesDirectForm) {
+	std::vector<q31_t> irL = makeIR(300, 4);
+	std::vector<q31_t> irR = makeIR(300, 5);
+	std::vector<q31_t> l = makeInput(2000, 6);
+	std::vector<q31_t> r = makeInput(2000, 7);
+	Convolver convolver({irL, irR});
+	std::vector<StereoSample> output = convolver.process(l, r);
+	checkClose(convolveDirectly(l, irL), output, false);
+	checkClose(convolveDirectly(r, irR), output, true);
+}
+
+TEST(ConvolutionTest, matchesImpulseResponseProcessor) {
+	// Its taps are scaled so 2^32 is unity, where ours have 2^31
+	std::vector<q31_t> ir;
+	for (int32_t tap : ImpulseResponseProcessor::ir) {
+		ir.push_back(tap >> 1);
+	}
+	std::vector<q31_t> input = makeInput(1000, 8);
+	Convolver convolver({ir});
+	std::vector<StereoSample> output = convolver.process(input, input);
+
+	ImpulseResponseProcessor direct;
+	for (size_t n = 0; n + kLatency < input.size(); n++) {
+		StereoSample expected;
+		direct.process({input[n], input[n]}, expected);
+		CHECK(std::abs(output[n + kLatency].l - expected.l) < 1024);
+	}
+}
+
+TEST(ConvolutionTest, gainAndDryMix) {
+	std::vector<q31_t> ir(PartitionedConvolver::kBlockSize * 2);
+	ir[0] = ONE_Q31 >> 2;
+	std::vector<q31_t> input = makeInput(1000, 9);
+	Convolver convolver({ir});
+	convolver.convolver.setGain(2);
+
+	std::vector<StereoSample> buffer(input.size());
+	for (size_t i = 0; i < input.size(); i++) {
+		buffer[i] = StereoSample::fromMono(input[i]);
+	}
+	convolver.convolver.process(buffer, ONE_Q31 >> 1, ONE_Q31);
+	// Half of the dry signal and half of it through the IR
+	for (size_t n = 0; n + kLatency < input.size(); n++) {
+		CHECK(std::abs(buffer[n + kLatency].l - input[n]) < 1024);
+	}
+
+	convolver.convolver.reset();
+	convolver.convolver.process(buffer, 0, ONE_Q31);
+	for (StereoSample const& sample : std::span(buffer).first(kLatency)) {
+		CHECK_EQUAL(0, sample.l);
+	}
+}
+
+// Benchmark - the direct form's time goes up with the IR length, the partitioned one's mostly stays with its FFTs
+TEST(ConvolutionTest, speedAgainstDirectForm) {
+	constexpr int32_t kNumFrames = 44100;
+	std::vector<q31_t> input = makeInput(kNumFrames, 10);
+
+	for (int32_t irLength : {32, 256, 1024, 4096, PartitionedConvolver::kMaxIRLength}) {
+		std::vector<q31_t> ir = makeIR(irLength, 11);
+
+		// Both channels, to compare with the partitioned one doing both
+		auto start = std::chrono::steady_clock::now();
+		std::vector<q31_t> direct = convolveDirectly(input, ir);
+		std::vector<q31_t> directR = convolveDirectly(input, ir);
+		double directTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		Convolver convolver({ir});
+		start = std::chrono::steady_clock::now();
+		std::vector<StereoSample> output = convolver.process(input, input);
+		double partitionedTime =
+		    std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << "Convolution ns per frame, " << irLength << " taps, direct: " << directTime / kNumFrames
+		          << " partitioned: " << partitionedTime / kNumFrames << std::endl;
+		// Only the output is checked - the timings are for reading, as they depend on the machine
+		CHECK(std::abs(output[kNumFrames / 2 + kLatency].l - direct[kNumFrames / 2]) < 1024);
+		CHECK(std::abs(output[kNumFrames / 2 + kLatency].r - directR[kNumFrames / 2]) < 1024);
+	}
+}
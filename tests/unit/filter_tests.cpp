@@ -0,0 +1,141 @@
+#include "CppUTest/TestHarness.h"
+#include "dsp/filter/hpladder.h"
+#include "dsp/filter/lpladder.h"
+#include "dsp/filter/stereo_q31.h"
+#include "dsp/filter/svf.h"
+#include "util/waves.h"
+
+#include <array>
+
+using namespace deluge::dsp::filter;
+
+namespace {
+
+constexpr int32_t kWindowFrames = 128;
+constexpr int32_t kNumWindows = 16;
+using StereoBuffer = std::array<q31_t, kWindowFrames * 2>;
+
+// Something with a bit of everything in it, at about the level voices reach the filters at, different in each channel
+void fillInput(StereoBuffer& buffer, int32_t window) {
+	uint32_t random = 12345 + window;
+	for (int32_t i = 0; i < kWindowFrames; i++) {
+		random = 69069 * random + 1234567;
+		q31_t saw = ((window * kWindowFrames + i) * 50000000) >> 4;
+		buffer[i * 2] = saw + ((int32_t)random >> 6);
+		buffer[i * 2 + 1] = ((int32_t)random >> 5) - (saw >> 1);
+	}
+}
+
+/// Runs two copies of a filter over the same input, one with the two lane stereo path and one a channel at a time,
+/// sweeping the cutoff and resonance between windows so the coefficient ramps are exercised, and checks every sample
+/// comes out the same
+template <typename F>
+void checkLanesMatchScalar(FilterMode mode, q31_t morph) {
+	F lanes{};
+	F scalar{};
+	StereoBuffer lanesBuffer;
+	StereoBuffer scalarBuffer;
+
+	for (int32_t window = 0; window < kNumWindows; window++) {
+		q31_t frequency = 20000000 + window * 4000000;
+		q31_t resonance = (window * 536870911LL) / kNumWindows;
+		lanes.configure(frequency, resonance, mode, morph, ONE_Q31 >> 2);
+		scalar.configure(frequency, resonance, mode, morph, ONE_Q31 >> 2);
+
+		fillInput(lanesBuffer, window);
+		fillInput(scalarBuffer, window);
+
+		// The ladders take noise per sample, so both need to see the same sequence of it
+		jcong = 13287131 + window;
+		lanes.doFilterStereo(lanesBuffer.data(), lanesBuffer.data() + lanesBuffer.size());
+		jcong = 13287131 + window;
+		scalar.doFilterStereoScalar(scalarBuffer.data(), scalarBuffer.data() + scalarBuffer.size());
+
+		for (size_t i = 0; i < lanesBuffer.size(); i++) {
+			CHECK_EQUAL(scalarBuffer[i], lanesBuffer[i]);
+		}
+	}
+}
+
+} // namespace
+
+TEST_GROUP(StereoQ31Test){};
+
+TEST(StereoQ31Test, matchesScalarOnEachLane) {
+	uint32_t random = 98765;
+	auto next = [&]() {
+		random = 69069 * random + 1234567;
+		return (q31_t)random;
+	};
+	for (int32_t i = 0; i < 1000; i++) {
+		q31_t a[2] = {next(), next()};
+		q31_t b[2] = {next(), next()};
+		q31_t sum[2] = {next(), next()};
+		StereoQ31 va = StereoQ31::load(a);
+		StereoQ31 vb = StereoQ31::load(b);
+		StereoQ31 vsum = StereoQ31::load(sum);
+
+		StereoQ31 rounded = multiply_32x32_rshift32_rounded(va, vb);
+		StereoQ31 truncated = multiply_32x32_rshift32(va, vb);
+		StereoQ31 accumulated = multiply_accumulate_32x32_rshift32_rounded(vsum, va, vb);
+		StereoQ31 shared = multiply_32x32_rshift32_rounded(va, b[0]);
+		StereoQ31 shifted = (va >> 7) + (vb << 2);
+		q31_t out[2];
+		for (int32_t lane = 0; lane < 2; lane++) {
+			rounded.store(out);
+			CHECK_EQUAL(multiply_32x32_rshift32_rounded(a[lane], b[lane]), out[lane]);
+			truncated.store(out);
+			CHECK_EQUAL(multiply_32x32_rshift32(a[lane], b[lane]), out[lane]);
+			accumulated.store(out);
+			CHECK_EQUAL(multiply_accumulate_32x32_rshift32_rounded(sum[lane], a[lane], b[lane]), out[lane]);
+			shared.store(out);
+			CHECK_EQUAL(multiply_32x32_rshift32_rounded(a[lane], b[0]), out[lane]);
+			shifted.store(out);
+			CHECK_EQUAL((a[lane] >> 7) + (b[lane] << 2), out[lane]);
+		}
+	}
+}
+
+TEST_GROUP(FilterTest){};
+
+TEST(FilterTest, rampReachesTargetInEvenSteps) {
+	RampedCoefficient coefficient;
+	coefficient.startRamp(1000, 0);
+	CHECK_EQUAL(1000, coefficient.get());
+
+	q31_t target = 1000 + kWindowFrames * 100000;
+	coefficient.startRamp(target, ONE_Q31 / kWindowFrames);
+	q31_t last = coefficient.get();
+	for (int32_t i = 0; i < kWindowFrames; i++) {
+		coefficient.step();
+		int32_t stepSize = coefficient.get() - last;
+		CHECK(stepSize > 99000 && stepSize <= 100000);
+		last = coefficient.get();
+	}
+	CHECK(target - coefficient.get() < kWindowFrames * 1000);
+	coefficient.finishRamp(target);
+	CHECK_EQUAL(target, coefficient.get());
+}
+
+TEST(FilterTest, firstWindowAfterResetJumps) {
+	SVFilter filter{};
+	CHECK_EQUAL(0, filter.startRampWindow(kWindowFrames));
+	CHECK_EQUAL(ONE_Q31 / kWindowFrames, filter.startRampWindow(kWindowFrames));
+	filter.reset();
+	CHECK_EQUAL(0, filter.startRampWindow(kWindowFrames));
+}
+
+TEST(FilterTest, svfLanesMatchScalar) {
+	checkLanesMatchScalar<SVFilter>(FilterMode::SVF_NOTCH, ONE_Q31 >> 3);
+	checkLanesMatchScalar<SVFilter>(FilterMode::SVF_BAND, ONE_Q31 >> 3);
+}
+
+TEST(FilterTest, lpLadderLanesMatchScalar) {
+	checkLanesMatchScalar<LpLadderFilter>(FilterMode::TRANSISTOR_12DB, 0);
+	checkLanesMatchScalar<LpLadderFilter>(FilterMode::TRANSISTOR_24DB, ONE_Q31 >> 4);
+	checkLanesMatchScalar<LpLadderFilter>(FilterMode::TRANSISTOR_24DB_DRIVE, 0);
+}
+
+TEST(FilterTest, hpLadderLanesMatchScalar) {
+	checkLanesMatchScalar<HpLadderFilter>(FilterMode::HPLADDER, ONE_Q31 >> 4);
+}
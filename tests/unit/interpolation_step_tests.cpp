@@ -0,0 +1,47 @@
+#include "CppUTest/TestHarness.h"
+#include "modulation/automation/interpolation_step.h"
+
+namespace {
+
+// With this inverse, a half tick's increment is the same as a sample's, in 1/65536ths
+constexpr uint32_t kUnitInverse = 1 << 16;
+constexpr int32_t kWindow = 128;
+
+int64_t runWindows(int32_t valueIncrementPerHalfTick, int32_t numWindows) {
+	int64_t total = 0;
+	for (int32_t i = 0; i < numWindows; i++) {
+		total += getInterpolationIncrement(valueIncrementPerHalfTick, kUnitInverse, kWindow);
+	}
+	return total;
+}
+
+} // namespace
+
+TEST_GROUP(InterpolationStepTest){};
+
+TEST(InterpolationStepTest, wholeUnitsPerWindowComeOutExactly) {
+	CHECK_EQUAL(6 * kWindow, getInterpolationIncrement(65536, kUnitInverse, kWindow));
+	CHECK_EQUAL(-6 * kWindow, getInterpolationIncrement(-65536, kUnitInverse, kWindow));
+}
+
+TEST(InterpolationStepTest, roundsToNearest) {
+	// 6 * 128 * 100 / 65536 of a unit per window - about 1.17
+	CHECK_EQUAL(1, getInterpolationIncrement(100, kUnitInverse, kWindow));
+	// 6 * 128 * 150 / 65536 - about 1.76
+	CHECK_EQUAL(2, getInterpolationIncrement(150, kUnitInverse, kWindow));
+	// And under half a unit doesn't move at all
+	CHECK_EQUAL(0, getInterpolationIncrement(10, kUnitInverse, kWindow));
+}
+
+TEST(InterpolationStepTest, fallingRampsMatchRisingOnes) {
+	// 128 comes to exactly 1.5 a window, which is where rounding halves the same way both ways matters
+	for (int32_t valueIncrementPerHalfTick : {1, 10, 85, 86, 128, 1000, 12345}) {
+		CHECK_EQUAL(-runWindows(valueIncrementPerHalfTick, 777), runWindows(-valueIncrementPerHalfTick, 777));
+	}
+	CHECK_EQUAL(-2, getInterpolationIncrement(-128, kUnitInverse, kWindow));
+}
+
+TEST(InterpolationStepTest, followsTheTempo) {
+	// Twice the inverse - half the time per tick - is twice the distance over the same samples
+	CHECK_EQUAL(2 * 6 * kWindow, getInterpolationIncrement(65536, 2 * kUnitInverse, kWindow));
+}
@@ -0,0 +1,134 @@
+#include "CppUTest/TestHarness.h"
+#include "modulation/midi/learned_cc_index.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+// The index never looks at what these point to, so anything unique will do
+std::array<char, 64> things;
+Output* output(int32_t i) {
+	return reinterpret_cast<Output*>(&things[i]);
+}
+ModControllableAudio* modControllable(int32_t i) {
+	return reinterpret_cast<ModControllableAudio*>(&things[i]);
+}
+
+LearnedCCIndex testIndex{};
+
+} // namespace
+
+TEST_GROUP(LearnedCCIndexTest){};
+
+TEST(LearnedCCIndexTest, findsTargetsInTheOrderAdded) {
+	LearnedCCIndex::invalidate();
+	CHECK(testIndex.needsRebuilding(nullptr));
+	testIndex.startBuilding(nullptr);
+	testIndex.add(15, 127, {output(0), modControllable(1), nullptr});
+	testIndex.add(0, 74, {output(2), modControllable(3), nullptr});
+	testIndex.add(3, 1, {output(4), modControllable(5), nullptr});
+	testIndex.add(0, 74, {output(6), modControllable(7), nullptr});
+	testIndex.add(0, 0, {output(8), modControllable(9), nullptr});
+	testIndex.add(0, 74, {output(10), modControllable(11), nullptr});
+	testIndex.finishBuilding();
+	CHECK(!testIndex.needsRebuilding(nullptr));
+	CHECK(!testIndex.hasOverflowed());
+
+	auto targets = testIndex.getTargets(0, 74);
+	CHECK_EQUAL(3, targets.size());
+	CHECK(targets[0].output == output(2));
+	CHECK(targets[1].output == output(6));
+	CHECK(targets[2].output == output(10));
+	CHECK(targets[2].modControllable == modControllable(11));
+
+	CHECK_EQUAL(1, testIndex.getTargets(0, 0).size());
+	CHECK(testIndex.getTargets(3, 1)[0].output == output(4));
+	CHECK(testIndex.getTargets(15, 127)[0].output == output(0));
+	CHECK_EQUAL(0, testIndex.getTargets(1, 74).size());
+	CHECK_EQUAL(0, testIndex.getTargets(0, 75).size());
+
+	LearnedCCIndex::invalidate();
+	CHECK(testIndex.needsRebuilding(nullptr));
+}
+
+TEST(LearnedCCIndexTest, overflowsRatherThanDroppingTargets) {
+	testIndex.startBuilding(nullptr);
+	for (int32_t i = 0; i < LearnedCCIndex::kMaxTargets; i++) {
+		testIndex.add(i & 15, i >> 4, {output(i & 63), nullptr, nullptr});
+	}
+	testIndex.finishBuilding();
+	CHECK(!testIndex.hasOverflowed());
+	CHECK_EQUAL(1, testIndex.getTargets(5, 20).size());
+	CHECK(testIndex.getTargets(5, 20)[0].output == output((20 * 16 + 5) & 63));
+
+	testIndex.startBuilding(nullptr);
+	for (int32_t i = 0; i <= LearnedCCIndex::kMaxTargets; i++) {
+		testIndex.add(0, 1, {output(0), nullptr, nullptr});
+	}
+	testIndex.finishBuilding();
+	CHECK(testIndex.hasOverflowed());
+}
+
+// Benchmark - messages per second finding who a CC was learned to, by checking every knob of every track as
+// PlaybackHandler::midiCCReceived() used to, against looking it up in the index
+TEST(LearnedCCIndexTest, messagesPerSecond) {
+	constexpr int32_t kNumTracks = 30;
+	constexpr int32_t kKnobsPerTrack = 16;
+	constexpr int32_t kNumMessages = 1000000;
+
+	struct Knob {
+		uint8_t channel;
+		uint8_t ccNumber;
+	};
+	std::vector<std::vector<Knob>> tracks(kNumTracks);
+	testIndex.startBuilding(nullptr);
+	for (int32_t track = 0; track < kNumTracks; track++) {
+		for (int32_t k = 0; k < kKnobsPerTrack; k++) {
+			Knob knob{(uint8_t)(track & 15), (uint8_t)((k * 7 + track) & 127)};
+			tracks[track].push_back(knob);
+			testIndex.add(knob.channel, knob.ccNumber, {output(track), modControllable(track), nullptr});
+		}
+	}
+	testIndex.finishBuilding();
+
+	// A controller surface sweeping its knobs on a few channels
+	std::vector<Knob> messages(kNumMessages);
+	uint32_t random = 4321;
+	for (Knob& message : messages) {
+		random = 69069 * random + 1234567;
+		message = {(uint8_t)((random >> 8) & 3), (uint8_t)((random >> 16) & 127)};
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	uintptr_t scannedHits = 0;
+	for (Knob const& message : messages) {
+		for (int32_t track = 0; track < kNumTracks; track++) {
+			for (Knob const& knob : tracks[track]) {
+				if (knob.channel == message.channel && knob.ccNumber == message.ccNumber) {
+					scannedHits += track + 1;
+					break;
+				}
+			}
+		}
+	}
+	double scanTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	uintptr_t indexedHits = 0;
+	for (Knob const& message : messages) {
+		for (LearnedCCIndex::Target const& target : testIndex.getTargets(message.channel, message.ccNumber)) {
+			indexedHits += reinterpret_cast<char*>(target.output) - things.data() + 1;
+		}
+	}
+	double indexTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Learned CC messages per second, " << kNumTracks << " tracks of " << kKnobsPerTrack
+	          << " knobs, scanning: " << kNumMessages / scanTime << " indexed: " << kNumMessages / indexTime
+	          << std::endl;
+	// Only the hits are checked - how long either took depends too much on what else the machine's doing
+	CHECK_EQUAL(scannedHits, indexedHits);
+}
@@ -0,0 +1,149 @@
+#include "CppUTest/TestHarness.h"
+#include "io/midi/midi_input_queue.h"
+
+#include <vector>
+
+namespace {
+
+using Message = MIDIInputQueue::Message;
+
+// Never looked at, only compared
+std::array<char, 2> cables;
+MIDICable* cable(int32_t i) {
+	return reinterpret_cast<MIDICable*>(&cables[i]);
+}
+
+Message cc(uint8_t channel, uint8_t ccNumber, uint8_t value, int32_t cableIndex = 0) {
+	return {cable(cableIndex), 0x0B, channel, ccNumber, value};
+}
+Message pitchBend(uint8_t channel, uint8_t lsb, uint8_t msb) {
+	return {cable(0), 0x0E, channel, lsb, msb};
+}
+Message noteOn(uint8_t channel, uint8_t note) {
+	return {cable(0), 0x09, channel, note, 100};
+}
+
+std::vector<Message> dispatchAll(MIDIInputQueue& queue) {
+	std::vector<Message> dispatched;
+	queue.dispatch([&](Message const& message) { dispatched.push_back(message); });
+	return dispatched;
+}
+
+void checkMessage(Message const& expected, Message const& actual) {
+	CHECK(expected.cable == actual.cable);
+	CHECK_EQUAL(expected.statusType, actual.statusType);
+	CHECK_EQUAL(expected.channel, actual.channel);
+	CHECK_EQUAL(expected.data1, actual.data1);
+	CHECK_EQUAL(expected.data2, actual.data2);
+}
+
+} // namespace
+
+TEST_GROUP(MIDIInputQueueTest){};
+
+TEST(MIDIInputQueueTest, latestValueWinsPerDestination) {
+	MIDIInputQueue queue;
+	queue.push(cc(0, 74, 1));
+	queue.push(pitchBend(1, 0, 64));
+	queue.push(cc(0, 74, 2));
+	queue.push(cc(0, 71, 3));
+	queue.push(cc(0, 74, 4, 1));
+	queue.push(pitchBend(1, 5, 70));
+	queue.push(cc(0, 74, 5));
+	CHECK(!queue.hasOrderSensitiveMessages());
+
+	std::vector<Message> dispatched = dispatchAll(queue);
+	CHECK_EQUAL(4, dispatched.size());
+	checkMessage(cc(0, 74, 5), dispatched[0]);
+	checkMessage(pitchBend(1, 5, 70), dispatched[1]);
+	checkMessage(cc(0, 71, 3), dispatched[2]);
+	checkMessage(cc(0, 74, 4, 1), dispatched[3]);
+	CHECK_EQUAL(4, queue.getStats().queued);
+	CHECK_EQUAL(3, queue.getStats().coalesced);
+	CHECK_EQUAL(1, queue.getStats().batches);
+	CHECK(queue.isEmpty());
+}
+
+TEST(MIDIInputQueueTest, neverCoalescesAcrossNotes) {
+	MIDIInputQueue queue;
+	queue.push(pitchBend(2, 0, 10));
+	queue.push(noteOn(2, 60));
+	queue.push(pitchBend(2, 0, 20));
+	queue.push(pitchBend(2, 0, 30));
+	queue.push(noteOn(2, 60));
+	queue.push(noteOn(2, 60));
+	CHECK(queue.hasOrderSensitiveMessages());
+
+	std::vector<Message> dispatched = dispatchAll(queue);
+	CHECK_EQUAL(5, dispatched.size());
+	checkMessage(pitchBend(2, 0, 10), dispatched[0]);
+	checkMessage(noteOn(2, 60), dispatched[1]);
+	checkMessage(pitchBend(2, 0, 30), dispatched[2]);
+	checkMessage(noteOn(2, 60), dispatched[3]);
+	checkMessage(noteOn(2, 60), dispatched[4]);
+	CHECK(!queue.hasOrderSensitiveMessages());
+}
+
+TEST(MIDIInputQueueTest, leavesRPNsAndChannelModeAlone) {
+	CHECK(!MIDIInputQueue::isCoalescable(cc(0, 101, 0)));
+	CHECK(!MIDIInputQueue::isCoalescable(cc(0, 6, 0)));
+	CHECK(!MIDIInputQueue::isCoalescable(cc(0, 123, 0)));
+	CHECK(!MIDIInputQueue::isCoalescable({cable(0), 0x0C, 0, 1, 0}));
+	CHECK(MIDIInputQueue::isCoalescable(cc(0, 1, 0)));
+	CHECK(MIDIInputQueue::isCoalescable({cable(0), 0x0D, 0, 1, 0}));
+
+	MIDIInputQueue queue;
+	queue.push(cc(0, 6, 1));
+	queue.push(cc(0, 6, 2));
+	CHECK_EQUAL(2, dispatchAll(queue).size());
+}
+
+TEST(MIDIInputQueueTest, refusesWhenFullUnlessItCoalesces) {
+	MIDIInputQueue queue;
+	for (int32_t i = 0; i < MIDIInputQueue::kCapacity; i++) {
+		CHECK(queue.push(noteOn(0, i)));
+	}
+	CHECK(!queue.push(noteOn(0, 0)));
+
+	queue = {};
+	for (int32_t i = 0; i < MIDIInputQueue::kCapacity; i++) {
+		CHECK(queue.push(cc(i & 15, i >> 4, 1)));
+	}
+	CHECK(queue.push(cc(3, 1, 127)));
+	CHECK(!queue.push(cc(3, 119, 1)));
+	CHECK(!queue.push(cc(3, 1, 0)));
+	CHECK_EQUAL(127, dispatchAll(queue)[1 * 16 + 3].data2);
+}
+
+TEST(MIDIInputQueueTest, keepsCCsSwitchingBetweenZeroAndNot) {
+	MIDIInputQueue queue;
+	queue.push(cc(0, 64, 127));
+	queue.push(cc(0, 64, 0));
+	queue.push(cc(0, 64, 0));
+	queue.push(cc(0, 64, 100));
+	queue.push(cc(0, 64, 90));
+	queue.push(pitchBend(0, 0, 0));
+	queue.push(pitchBend(0, 0, 64));
+
+	std::vector<Message> dispatched = dispatchAll(queue);
+	CHECK_EQUAL(4, dispatched.size());
+	checkMessage(cc(0, 64, 127), dispatched[0]);
+	checkMessage(cc(0, 64, 0), dispatched[1]);
+	checkMessage(cc(0, 64, 90), dispatched[2]);
+	checkMessage(pitchBend(0, 0, 64), dispatched[3]);
+}
+
+TEST(MIDIInputQueueTest, keepsEverythingItsToldNotToCoalesce) {
+	MIDIInputQueue queue;
+	queue.push(cc(0, 74, 1), false);
+	queue.push(cc(0, 74, 2), false);
+	CHECK(queue.hasOrderSensitiveMessages());
+	queue.push(cc(0, 74, 3));
+	queue.push(cc(0, 74, 4));
+
+	std::vector<Message> dispatched = dispatchAll(queue);
+	CHECK_EQUAL(3, dispatched.size());
+	checkMessage(cc(0, 74, 1), dispatched[0]);
+	checkMessage(cc(0, 74, 2), dispatched[1]);
+	checkMessage(cc(0, 74, 4), dispatched[2]);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+class Cluster {
+public:
+	static size_t size;
+	static size_t size_magnitude;
+
+	char* data;
+};
@@ -0,0 +1,40 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// What NE10's FFT setup needs from the rest of the firmware
+
+#include "NE10.h"
+#include <cstdlib>
+
+extern "C" {
+
+void* delugeAlloc(unsigned int requiredSize, bool mayUseOnChipRam) {
+	return malloc(requiredSize);
+}
+
+void delugeDealloc(void* address) {
+	free(address);
+}
+
+void routineWithClusterLoading() {
+}
+
+// Only referred to by the float FFT setup, which nothing tested uses
+ne10_fft_cfg_float32_t ne10_fft_alloc_c2c_float32_c(ne10_int32_t nfft) {
+	return nullptr;
+}
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright © 2026 Synthstrom Audible Limited
+ *
+ * This file is part of The Synthstrom Audible Deluge Firmware.
+ *
+ * The Synthstrom Audible Deluge Firmware is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// The pieces of util/functions.cpp and the audio engine the filters need, as functions.cpp pulls in too much
+
+#include "dsp/filter/filter.h"
+#include "util/lookuptables/lookuptables.h"
+
+namespace deluge::dsp::filter {
+q31_t blendBuffer[SSI_TX_BUFFER_NUM_SAMPLES * 2] = {0};
+}
+
+namespace AudioEngine {
+int32_t cpuDireness = 0;
+}
+
+int32_t quickLog(uint32_t input) {
+
+	uint32_t magnitude = getMagnitudeOld(input);
+	uint32_t inputLSBs = increaseMagnitude(input, 26 - magnitude);
+
+	return (magnitude << 25) + (inputLSBs & ~((uint32_t)1 << 26));
+}
+
+int32_t instantTan(int32_t input) {
+	int32_t whichValue = input >> 25;                   // 25
+	int32_t howMuchFurther = (input << 6) & 2147483647; // 6
+	int32_t value1 = tanTable[whichValue];
+	int32_t value2 = tanTable[whichValue + 1];
+	return (multiply_32x32_rshift32(value2, howMuchFurther)
+	        + multiply_32x32_rshift32(value1, 2147483647 - howMuchFurther))
+	       << 1;
+}
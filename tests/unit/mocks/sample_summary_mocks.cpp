@@ -0,0 +1,19 @@
+// The bits of the linked list and Cluster which SampleSummary needs, without the rest of the firmware
+
+#include "sample_summary_mocks.h"
+#include "util/container/list/bidirectional_linked_list.h"
+
+size_t Cluster::size = 32768;
+size_t Cluster::size_magnitude = 15;
+
+BidirectionalLinkedListNode::BidirectionalLinkedListNode() {
+	list = nullptr;
+}
+
+BidirectionalLinkedListNode::~BidirectionalLinkedListNode() {
+	remove();
+}
+
+void BidirectionalLinkedListNode::remove() {
+	list = nullptr;
+}
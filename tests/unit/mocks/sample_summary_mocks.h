@@ -0,0 +1,53 @@
+#pragma once
+
+#include "cluster_mocks.h"
+#include "memory/stealable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Just what SampleSummary needs from Sample, Cluster and the memory allocator
+
+extern "C" void delugeDealloc(void* address);
+
+class SampleCluster {
+public:
+	Cluster* cluster = nullptr;
+	bool summarised = false;
+};
+
+class SampleClusterArray {
+public:
+	SampleCluster* getElement(int32_t index) { return &elements[index]; }
+	int32_t getNumElements() { return elements.size(); }
+
+	std::vector<SampleCluster> elements;
+};
+
+class Sample {
+public:
+	void summaryStolen() {
+		for (SampleCluster& cluster : clusters.elements) {
+			cluster.summarised = false;
+		}
+	}
+
+	uint8_t byteDepth = 2;
+	uint8_t numChannels = 1;
+	uint32_t audioDataStartPosBytes = 0;
+	uint64_t lengthInSamples = 0;
+	int32_t numReasonsToBeLoaded = 0;
+	SampleClusterArray clusters;
+};
+
+class GeneralMemoryAllocator {
+public:
+	static GeneralMemoryAllocator& get() {
+		static GeneralMemoryAllocator allocator;
+		return allocator;
+	}
+	void* allocStealable(uint32_t requiredSize, void* thingNotToStealFrom = nullptr) { return malloc(requiredSize); }
+	void putStealableInAppropriateQueue(Stealable* stealable) {}
+};
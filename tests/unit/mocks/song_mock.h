@@ -20,6 +20,7 @@ public:
 		// TODO: extract getNoteLengthName() from Song, so we can test
 		// note length naming logic
 	}
+	int32_t convertSyncLevelFromInternalValueToFileValue(int32_t internalValue) { return internalValue; }
 	ClipArray sessionClips;
 	ClipArray arrangementOnlyClips;
 	int32_t insideWorldTickMagnitude = 1;
@@ -0,0 +1,191 @@
+// FileReader and FileWriter for in-memory files only, so the serializers can be tested without the card
+
+#include "storage_mocks.h"
+#include "storage/storage_manager.h"
+#include "util/d_string.h"
+#include "util/functions.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+FirmwareVersion song_firmware_version = FirmwareVersion::current();
+
+// Stand-ins for the string helpers in d_string.cpp and functions.cpp, which bring in the memory allocator
+
+char shortStringBuffer[kShortStringBufferSize];
+
+char halfByteToHexChar(uint8_t thisHalfByte) {
+	return thisHalfByte < 10 ? '0' + thisHalfByte : 'A' - 10 + thisHalfByte;
+}
+
+char hexCharToHalfByte(unsigned char hexChar) {
+	return hexChar >= 'A' ? hexChar - 'A' + 10 : hexChar - '0';
+}
+
+void intToHex(uint32_t number, char* output, int32_t numChars) {
+	output[numChars] = 0;
+	for (int32_t i = numChars - 1; i >= 0; i--) {
+		output[i] = halfByteToHexChar(number & 15);
+		number >>= 4;
+	}
+}
+
+uint32_t hexToInt(char const* string) {
+	uint32_t output = 0;
+	while (*string) {
+		output = (output << 4) | hexCharToHalfByte(*string++);
+	}
+	return output;
+}
+
+int32_t stringToInt(char const* string) {
+	return strtol(string, nullptr, 10);
+}
+
+Error fresultToDelugeErrorCode(FRESULT result) {
+	return (result == FR_OK) ? Error::NONE : Error::SD_CARD;
+}
+
+void String::clear(bool destructing) {
+}
+
+Error String::concatenateAtPos(char const* newChars, int32_t pos, int32_t newCharsLength) {
+	return Error::INSUFFICIENT_RAM;
+}
+
+extern "C" void freezeWithError(char const* errmsg) {
+	fprintf(stderr, "freezeWithError: %s\n", errmsg);
+	abort();
+}
+
+void AudioEngine::logAction(char const* string) {
+}
+
+void AudioEngine::logAction(int32_t number) {
+}
+
+FileReader::FileReader() {
+	fileClusterBuffer = (char*)malloc(Cluster::size);
+}
+
+FileReader::FileReader(char* memBuffer, uint32_t bufLen) {
+	fileClusterBuffer = memBuffer;
+	currentReadBufferEndPos = bufLen;
+	memoryBased = true;
+	callRoutines = false;
+	fileReadBufferCurrentPos = 0;
+}
+
+FileReader::~FileReader() {
+	if (!memoryBased) {
+		free(fileClusterBuffer);
+	}
+}
+
+void FileReader::resetReader() {
+	if (!memoryBased) {
+		fileReadBufferCurrentPos = Cluster::size;
+		currentReadBufferEndPos = Cluster::size;
+	}
+	else {
+		fileReadBufferCurrentPos = 0;
+	}
+	readCount = 0;
+	reachedBufferEnd = false;
+	readResult = FR_OK;
+}
+
+bool FileReader::readFileClusterIfNecessary() {
+	if (fileReadBufferCurrentPos >= currentReadBufferEndPos) {
+		reachedBufferEnd = true;
+	}
+	return !reachedBufferEnd;
+}
+
+bool FileReader::readFileCluster() {
+	return memoryBased;
+}
+
+bool FileReader::peekChar(char* thisChar) {
+	readFileClusterIfNecessary();
+	if (reachedBufferEnd) {
+		return false;
+	}
+	*thisChar = fileClusterBuffer[fileReadBufferCurrentPos];
+	return true;
+}
+
+bool FileReader::readChar(char* thisChar) {
+	if (!peekChar(thisChar)) {
+		return false;
+	}
+	fileReadBufferCurrentPos++;
+	return true;
+}
+
+void FileReader::readDone() {
+	readCount++;
+}
+
+FRESULT FileReader::closeWriter() {
+	return FR_OK;
+}
+
+FileWriter::FileWriter() {
+	bufferSize = 32768;
+	writeClusterBuffer = (char*)malloc(bufferSize);
+}
+
+FileWriter::FileWriter(bool inMem) : FileWriter() {
+	memoryBased = true;
+}
+
+FileWriter::~FileWriter() {
+	free(writeClusterBuffer);
+}
+
+int32_t FileWriter::bytesWritten() {
+	return fileTotalBytesWritten + fileWriteBufferCurrentPos;
+}
+
+void FileWriter::resetWriter() {
+	fileWriteBufferCurrentPos = 0;
+	fileTotalBytesWritten = 0;
+	fileAccessFailedDuringWrite = false;
+}
+
+FRESULT FileWriter::closeWriter() {
+	if (fileWriteBufferCurrentPos >= bufferSize) {
+		return FR_INT_ERR;
+	}
+	writeClusterBuffer[fileWriteBufferCurrentPos] = 0;
+	return FR_OK;
+}
+
+void FileWriter::writeBlock(uint8_t* block, uint32_t size) {
+	for (uint32_t ix = 0; ix < size; ++ix) {
+		writeByte(block[ix]);
+	}
+}
+
+void FileWriter::writeByte(int8_t b) {
+	if (fileWriteBufferCurrentPos == bufferSize) {
+		fileAccessFailedDuringWrite = true;
+		return;
+	}
+	writeClusterBuffer[fileWriteBufferCurrentPos++] = b;
+}
+
+void FileWriter::writeChars(char const* output) {
+	while (*output) {
+		writeByte(*output++);
+	}
+}
+
+Error FileWriter::writeBufferToFile() {
+	return Error::SD_CARD;
+}
+
+Error FileWriter::closeAfterWriting(char const* path, char const* beginningString, char const* endString) {
+	return fileAccessFailedDuringWrite ? Error::WRITE_FAIL : Error::NONE;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "cluster_mocks.h"
+#include "song_mock.h"
+
+#include <cstdint>
+
+// Just what the serializers need from the rest of the firmware. Files are only ever read and written in memory
+
+namespace AudioEngine {
+void logAction(char const* string);
+void logAction(int32_t number);
+} // namespace AudioEngine
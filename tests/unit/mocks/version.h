@@ -0,0 +1,6 @@
+// mock up the version.h that would be made by cmake in the main build
+
+#pragma once
+
+constexpr char const* kFirmwareVersionString = "TESTS";
+constexpr char const* kFirmwareVersionStringShort = "TESTS";
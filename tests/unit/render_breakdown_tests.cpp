@@ -0,0 +1,97 @@
+#include "CppUTest/TestHarness.h"
+#include "OSLikeStuff/timers_interrupts/clock_type.h"
+#include "mocks/timer_mocks.h"
+#include "processing/engines/render_breakdown.h"
+
+using namespace AudioEngine;
+
+namespace {
+
+// stand-ins for the real render stages, each costing a fixed amount of mock time per sample
+constexpr double kVoiceCostPerSample = 0.000001;
+constexpr double kReverbCostPerSample = 0.0000005;
+
+void renderVoices(int32_t numVoices, uint32_t numSamples) {
+	TIME_RENDER_STAGE(VOICES);
+	passMockTime(kVoiceCostPerSample * numVoices * numSamples);
+}
+
+void renderSound(int32_t numVoices, uint32_t numSamples) {
+	TIME_RENDER_STAGE(SOUND);
+	renderVoices(numVoices, numSamples);
+}
+
+void renderReverb(uint32_t numSamples) {
+	TIME_RENDER_STAGE(REVERB);
+	passMockTime(kReverbCostPerSample * numSamples);
+}
+
+/// Drives a fixed sequence of windows the way AudioEngine::renderAudio() does
+void renderWindows(int32_t numVoices, int32_t numWindows, uint32_t numSamples) {
+	for (int32_t w = 0; w < numWindows; w++) {
+		renderBreakdown.beginWindow(numSamples);
+		{
+			TIME_RENDER_STAGE(SONG);
+			renderSound(numVoices, numSamples);
+		}
+		renderReverb(numSamples);
+		renderBreakdown.endWindow();
+	}
+}
+
+TEST_GROUP(RenderBreakdown) {
+	void setup() override { renderBreakdown = RenderBreakdown(); }
+};
+
+TEST(RenderBreakdown, countsWindowsAndSamples) {
+	renderWindows(4, 10, 128);
+	CHECK_EQUAL(10, renderBreakdown.getNumWindows());
+	CHECK_EQUAL(1280, renderBreakdown.getNumSamples());
+}
+
+TEST(RenderBreakdown, stagesAreInclusive) {
+	renderWindows(4, 10, 128);
+	auto& song = renderBreakdown.getStats(RenderStage::SONG);
+	auto& sound = renderBreakdown.getStats(RenderStage::SOUND);
+	auto& voices = renderBreakdown.getStats(RenderStage::VOICES);
+	CHECK(song.total >= sound.total);
+	CHECK(sound.total >= voices.total);
+	CHECK(voices.total > 0);
+	CHECK_EQUAL(0, renderBreakdown.getStats(RenderStage::SONG_FX).total);
+}
+
+TEST(RenderBreakdown, perSampleCostMatchesStageCost) {
+	renderWindows(4, 10, 128);
+	// the timer mock advances slightly on every read, so allow a little slack
+	DOUBLES_EQUAL(kVoiceCostPerSample * 4 * DELUGE_CLOCKS_PERf, renderBreakdown.getTicksPerSample(RenderStage::VOICES),
+	              1.0);
+	DOUBLES_EQUAL(kReverbCostPerSample * DELUGE_CLOCKS_PERf, renderBreakdown.getTicksPerSample(RenderStage::REVERB),
+	              1.0);
+}
+
+/// A benchmark-style check - voice cost must scale with the number of voices, this is what catches a regression in
+/// the per-voice path
+TEST(RenderBreakdown, voiceCostScalesWithVoiceCount) {
+	renderWindows(8, 32, 64);
+	float eightVoices = renderBreakdown.getTicksPerSample(RenderStage::VOICES);
+	renderBreakdown.reset();
+	renderWindows(16, 32, 64);
+	float sixteenVoices = renderBreakdown.getTicksPerSample(RenderStage::VOICES);
+	DOUBLES_EQUAL(2.0, sixteenVoices / eightVoices, 0.01);
+}
+
+TEST(RenderBreakdown, maxTracksWorstWindow) {
+	renderWindows(1, 5, 32);
+	renderWindows(10, 1, 32);
+	renderWindows(1, 5, 32);
+	auto& voices = renderBreakdown.getStats(RenderStage::VOICES);
+	DOUBLES_EQUAL(kVoiceCostPerSample * 10 * 32 * DELUGE_CLOCKS_PERf, voices.max, 10);
+}
+
+TEST(RenderBreakdown, resetsAfterReportInterval) {
+	renderBreakdown.reportInterval = 4;
+	renderWindows(2, 6, 16);
+	CHECK_EQUAL(2, renderBreakdown.getNumWindows());
+}
+
+} // namespace
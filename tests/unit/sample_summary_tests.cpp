@@ -0,0 +1,159 @@
+#include "CppUTest/TestHarness.h"
+#include "model/sample/sample_summary.h"
+#include "sample_summary_mocks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// A mono 16-bit Sample whose audio starts after a 44 byte header, like a plain WAV
+class TestSample {
+public:
+	explicit TestSample(uint32_t numFrames) : audio(numFrames) {
+		sample.audioDataStartPosBytes = 44;
+		sample.lengthInSamples = numFrames;
+		uint32_t numBytes = sample.audioDataStartPosBytes + numFrames * sizeof(int16_t);
+		int32_t numClusters = ((numBytes - 1) >> Cluster::size_magnitude) + 1;
+		bytes.resize(numClusters << Cluster::size_magnitude);
+		clusters.resize(numClusters);
+		sample.clusters.elements.resize(numClusters);
+		for (int32_t c = 0; c < numClusters; c++) {
+			clusters[c].data = &bytes[c << Cluster::size_magnitude];
+			sample.clusters.elements[c].cluster = &clusters[c];
+		}
+	}
+
+	void setFrame(uint32_t frame, int16_t value) {
+		audio[frame] = value;
+		*(int16_t*)&bytes[sample.audioDataStartPosBytes + frame * sizeof(int16_t)] = value;
+	}
+
+	// What the summary's meant to give back, the slow way
+	void getExpectedPeaks(uint32_t startFrame, uint32_t endFrame, int32_t* min, int32_t* max) {
+		auto [lowest, highest] = std::minmax_element(&audio[startFrame], &audio[endFrame]);
+		*min = *lowest << 16;
+		*max = *highest << 16;
+	}
+
+	void summariseCluster(SampleSummary& summary, int32_t c) {
+		summary.addCluster(c, clusters[c]);
+		sample.clusters.elements[c].summarised = true;
+	}
+
+	void summariseAllClusters(SampleSummary& summary) {
+		for (int32_t c = 0; c < clusters.size(); c++) {
+			summariseCluster(summary, c);
+		}
+	}
+
+	Sample sample;
+	std::vector<int16_t> audio;
+	std::vector<char> bytes;
+	std::vector<Cluster> clusters;
+};
+
+TEST_GROUP(SampleSummaryTest){};
+
+TEST(SampleSummaryTest, peaksMatchTheAudio) {
+	TestSample test(200000);
+	srand(1);
+	for (uint32_t f = 0; f < test.audio.size(); f++) {
+		test.setFrame(f, (rand() % 20000) - 10000);
+	}
+	// A couple of outliers that only the right bins should see
+	test.setFrame(70000, 32000);
+	test.setFrame(150001, -32000);
+
+	SampleSummary* summary = SampleSummary::create(&test.sample, test.audio.size());
+	CHECK(summary != nullptr);
+	test.summariseAllClusters(*summary);
+	CHECK(summary->isComplete());
+
+	// Column ranges on bin boundaries for each level, and one that isn't on any
+	for (auto [start, end] : {std::pair{0u, 1024u}, {65536u, 81920u}, {0u, 196608u}, {69632u, 86016u}}) {
+		int32_t min, max, expectedMin, expectedMax;
+		CHECK(summary->getPeaks(start, end, &min, &max));
+		test.getExpectedPeaks(start, end, &expectedMin, &expectedMax);
+		CHECK_EQUAL(expectedMin, min);
+		CHECK_EQUAL(expectedMax, max);
+	}
+	summary->destroy();
+}
+
+TEST(SampleSummaryTest, rmsOfSquareWave) {
+	TestSample test(65536);
+	for (uint32_t f = 0; f < test.audio.size(); f++) {
+		test.setFrame(f, (f & 1) ? 8192 : -8192);
+	}
+	SampleSummary* summary = SampleSummary::create(&test.sample, test.audio.size());
+	test.summariseAllClusters(*summary);
+
+	int32_t min, max, rms;
+	CHECK(summary->getPeaks(0, 65536, &min, &max, &rms));
+	CHECK_EQUAL(-8192 << 16, min);
+	CHECK_EQUAL(8192 << 16, max);
+	CHECK_EQUAL(8192 << 16, rms);
+	summary->destroy();
+}
+
+TEST(SampleSummaryTest, rmsOfPartialLastBin) {
+	// The last 100 frames are in a bin of their own, at every level
+	TestSample test(65536 + 100);
+	for (uint32_t f = 0; f < test.audio.size(); f++) {
+		test.setFrame(f, (f & 1) ? 8192 : -8192);
+	}
+	SampleSummary* summary = SampleSummary::create(&test.sample, test.audio.size());
+	test.summariseAllClusters(*summary);
+
+	// The finest bins, then the next level up
+	for (uint32_t start : {65536u - 1024u, 0u}) {
+		int32_t min, max, rms;
+		CHECK(summary->getPeaks(start, test.audio.size(), &min, &max, &rms));
+		CHECK_EQUAL(8192 << 16, rms);
+	}
+	summary->destroy();
+}
+
+TEST(SampleSummaryTest, onlyTrustsSummarisedClusters) {
+	TestSample test(100000);
+	SampleSummary* summary = SampleSummary::create(&test.sample, test.audio.size());
+	test.summariseCluster(*summary, 0);
+
+	int32_t min, max;
+	// The first Cluster holds the first (32768 - 44) / 2 frames
+	CHECK(summary->getPeaks(0, 8192, &min, &max));
+	CHECK_FALSE(summary->getPeaks(16384, 24576, &min, &max));
+	CHECK_FALSE(summary->isComplete());
+	// Too few frames for even the finest bins to be worth it
+	CHECK_FALSE(summary->getPeaks(0, 512, &min, &max));
+	summary->destroy();
+}
+
+TEST(SampleSummaryTest, growingKeepsBins) {
+	TestSample test(150000);
+	for (uint32_t f = 0; f < test.audio.size(); f++) {
+		test.setFrame(f, f & 0x3FFF);
+	}
+	SampleSummary* small = SampleSummary::create(&test.sample, 60000);
+	CHECK_EQUAL(65536, small->getNumFrames());
+	test.summariseCluster(*small, 0);
+	test.summariseCluster(*small, 1);
+
+	SampleSummary* big = SampleSummary::create(&test.sample, small->getNumFrames() * 2);
+	big->copyFrom(*small);
+	small->destroy();
+	for (int32_t c = 2; c < test.clusters.size(); c++) {
+		test.summariseCluster(*big, c);
+	}
+
+	int32_t min, max, expectedMin, expectedMax;
+	CHECK(big->getPeaks(0, 131072, &min, &max));
+	test.getExpectedPeaks(0, 131072, &expectedMin, &expectedMax);
+	CHECK_EQUAL(expectedMin, min);
+	CHECK_EQUAL(expectedMax, max);
+	big->destroy();
+}
+
+} // namespace
@@ -4,7 +4,9 @@
 #include "OSLikeStuff/task_scheduler/task_scheduler_c_api.cpp"
 #include "cstdint"
 #include "mocks/timer_mocks.h"
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <stdlib.h>
 
 #ifdef _WIN32
@@ -256,4 +258,199 @@ TEST(Scheduler, yield_with_lock) {
 	taskManager.start(0.002);
 	mock().checkExpectations();
 };
+
+/// A stand-in for the main tasks registered in deluge.cpp, used to compare how each scheduling mode spreads latency
+struct SyntheticLoad {
+	TaskID audio{-1};
+	TaskID clusters{-1};
+	TaskID pendingUI{-1};
+	TaskID oled{-1};
+	TaskID uiRoutine{-1};
+	// how late each audio render started against its target call time
+	std::vector<double> audioLateness;
+	int32_t clusterCalls{0};
+
+	void add() {
+		audio = addRepeatingTask([]() { load.renderAudio(); }, 0, 0.00001, 16 / 44100., 24 / 44100., "audio routine",
+		                         RESOURCE_NONE);
+		// mostly nothing to load, every so often a cluster read
+		clusters = addRepeatingTask([]() { passMockTime((++load.clusterCalls % 8) ? 0.000005 : 0.0002); }, 4, 0.00001,
+		                            0.00001, 0.00002, "load clusters", RESOURCE_NONE);
+		setTaskDeadline(clusters, 0.002);
+		pendingUI = addRepeatingTask([]() { passMockTime(0.0015); }, 12, 0.01, 0.01, 0.03, "pending UI", RESOURCE_NONE);
+		oled = addRepeatingTask([]() { passMockTime(0.0008); }, 32, 0.01, 0.01, 0.02, "oled routine", RESOURCE_NONE);
+		uiRoutine = addRepeatingTask([]() { passMockTime(0.00005); }, 34, 0.0001, 0.0007, 0.01, "ui routine",
+		                             RESOURCE_NONE);
+	}
+
+	void renderAudio() {
+		Time ideal = taskManager.getTask(audio).idealCallTime;
+		if (ideal != Time(0)) {
+			Time now = taskManager.getSecondsFromStart();
+			audioLateness.push_back(double(now - ideal));
+		}
+		passMockTime(0.0001);
+	}
+
+	[[nodiscard]] int32_t totalMisses() const {
+		int32_t misses = 0;
+		for (TaskID id : {audio, clusters, pendingUI, oled, uiRoutine}) {
+			misses += taskManager.getTask(id).deadlineMisses;
+		}
+		return misses;
+	}
+
+	void print(const char* mode) {
+		std::sort(audioLateness.begin(), audioLateness.end());
+		auto percentile = [&](double p) { return 1000000 * audioLateness[(audioLateness.size() - 1) * p]; };
+		std::cout << mode << " audio lateness p50/p99/max: " << percentile(0.5) << "/" << percentile(0.99) << "/"
+		          << percentile(1.0) << " us" << std::endl;
+		for (TaskID id : {audio, clusters, pendingUI, oled, uiRoutine}) {
+			const Task& t = taskManager.getTask(id);
+			Time worst = t.worstLatency;
+			std::cout << "    " << t.name << ": called " << t.timesCalled << ", worst late " << 1000000 * double(worst)
+			          << " us, missed " << t.deadlineMisses << std::endl;
+		}
+	}
+
+	static SyntheticLoad load;
+};
+SyntheticLoad SyntheticLoad::load;
+
+TEST_GROUP(SchedulerDeadlines){
+
+    void setup(){taskManager = TaskManager();
+SyntheticLoad::load = SyntheticLoad();
+} // namespace
+}
+;
+
+/// Runs the synthetic load for a second under each mode. Earliest deadline first should miss fewer deadlines overall
+/// without letting the audio routine get any later
+TEST(SchedulerDeadlines, latencyDistribution) {
+	auto& load = SyntheticLoad::load;
+	load.add();
+	taskManager.start(1.0);
+	load.print("priority");
+	int32_t priorityAudioMisses = taskManager.getTask(load.audio).deadlineMisses;
+	int32_t priorityUIMisses = taskManager.getTask(load.uiRoutine).deadlineMisses;
+	int32_t priorityMisses = load.totalMisses();
+	uint32_t priorityAudioCalls = taskManager.getTask(load.audio).timesCalled;
+	uint32_t priorityUICalls = taskManager.getTask(load.uiRoutine).timesCalled;
+
+	taskManager = TaskManager();
+	load = SyntheticLoad();
+	setSchedulerDeadlineMode(true);
+	load.add();
+	taskManager.start(1.0);
+	load.print("deadline");
+
+	CHECK(taskManager.getTask(load.audio).deadlineMisses <= priorityAudioMisses);
+	CHECK(taskManager.getTask(load.uiRoutine).deadlineMisses < priorityUIMisses);
+	CHECK(load.totalMisses() < priorityMisses);
+
+	// Fewer misses mustn't come from just calling things more often - each task's next target call time is
+	// targetInterval - average run time after it starts, so that bounds how many calls a second it can get
+	for (TaskID id : {load.audio, load.pendingUI, load.oled, load.uiRoutine}) {
+		const Task& t = taskManager.getTask(id);
+		CHECK(t.timesCalled <= 1.0 / double(Time(t.schedule.targetInterval) - t.durationStats.average) + 1);
+	}
+	CHECK(taskManager.getTask(load.audio).timesCalled >= priorityAudioCalls);
+	CHECK(taskManager.getTask(load.uiRoutine).timesCalled >= priorityUICalls);
+}
+
+int uiCalls = 0;
+int audioCallsBetweenRedraws = 0;
+/// A UI redraw that's due, and an audio render that isn't yet but whose deadline falls before the redraw would finish.
+/// Once the redraw's duration is known it has to wait until it's missed its own deadline, and in the meantime audio
+/// keeps running on time
+TEST(SchedulerDeadlines, audioWinsCollision) {
+	uiCalls = 0;
+	audioCallsBetweenRedraws = 0;
+	setSchedulerDeadlineMode(true);
+	TaskID audio = addRepeatingTask(
+	    []() {
+		    if (uiCalls == 1) {
+			    audioCallsBetweenRedraws += 1;
+		    }
+		    passMockTime(0.0001);
+	    },
+	    0, 0.00001, 16 / 44100., 24 / 44100., "audio routine", RESOURCE_NONE);
+	TaskID redraw = addRepeatingTask(
+	    []() {
+		    uiCalls += 1;
+		    passMockTime(0.0015);
+	    },
+	    12, 0.01, 0.01, 0.03, "pending UI", RESOURCE_NONE);
+	taskManager.start(0.05);
+	CHECK(uiCalls >= 2);
+	// the redraw's target is 10ms and its deadline 20ms after that
+	CHECK(audioCallsBetweenRedraws > 0.02 / (16 / 44100.));
+	// only the redraws that had to be forced through make audio late
+	CHECK(taskManager.getTask(audio).deadlineMisses <= uiCalls);
+	CHECK_EQUAL(taskManager.getTask(redraw).deadlineMisses, uiCalls - 1);
+}
+
+TEST_GROUP(SchedulerTracing){
+
+    void setup(){taskManager = TaskManager();
+} // namespace
+}
+;
+
+TEST(SchedulerTracing, histogramBuckets) {
+	CHECK_EQUAL(0, LogHistogram::getBucket(Time(0)));
+	CHECK_EQUAL(0, LogHistogram::getBucket(Time(0.0000005)));
+	CHECK_EQUAL(1, LogHistogram::getBucket(Time(0.0000015)));
+	CHECK_EQUAL(7, LogHistogram::getBucket(Time(0.0001)));
+	CHECK_EQUAL(11, LogHistogram::getBucket(Time(0.0015)));
+	CHECK_EQUAL(LogHistogram::kNumBuckets - 1, LogHistogram::getBucket(Time(1.0)));
+}
+
+/// a task that's usually quick but every so often takes long enough to push a 1ms task past its maximum
+TEST(SchedulerTracing, overrunsAndTail) {
+	static int calls;
+	calls = 0;
+	TaskID quick = addRepeatingTask([]() { passMockTime(0.00005); }, 0, 0.001, 0.001, 0.0015, "quick", RESOURCE_NONE);
+	TaskID spiky = addRepeatingTask([]() { passMockTime((++calls % 10) ? 0.0001 : 0.003); }, 10, 0.001, 0.001, 0.01,
+	                                "spiky", RESOURCE_NONE);
+	taskManager.start(0.1);
+
+	const Task& q = taskManager.getTask(quick);
+	const Task& s = taskManager.getTask(spiky);
+	// the average is dominated by the short runs but the histogram keeps the long ones
+	CHECK(s.runTimeHistogram.counts[LogHistogram::getBucket(Time(0.003))] > 0);
+	CHECK(s.runTimeHistogram.counts[LogHistogram::getBucket(Time(0.0001))] > s.runTimeHistogram.counts[12]);
+	CHECK(q.overruns > 0);
+	CHECK(q.overruns <= s.runTimeHistogram.counts[LogHistogram::getBucket(Time(0.003))]);
+	uint32_t quickIntervals = 0;
+	for (uint32_t count : q.jitterHistogram.counts) {
+		quickIntervals += count;
+	}
+	CHECK_EQUAL(q.timesCalled - 1, quickIntervals);
+}
+
+int linesWritten = 0;
+TEST(SchedulerTracing, decisionLog) {
+	addRepeatingTask([]() { passMockTime(0.0001); }, 0, 0.001, 0.001, 0.002, "first", RESOURCE_NONE);
+	addRepeatingTask([]() { passMockTime(0.0001); }, 10, 0.001, 0.001, 0.002, "second", RESOURCE_NONE);
+	taskManager.start(0.005);
+	int32_t numDecisions = taskManager.getNumLoggedDecisions();
+	CHECK(numDecisions > 4);
+	CHECK(numDecisions < kNumLoggedDecisions);
+
+	// newest first, and the oldest ones get overwritten once it's full
+	Time newest = taskManager.getDecision(0).startTime;
+	Time older = taskManager.getDecision(1).startTime;
+	CHECK(newest > older);
+	taskManager.start(0.1);
+	CHECK_EQUAL(kNumLoggedDecisions, taskManager.getNumLoggedDecisions());
+	Time oldest = taskManager.getDecision(kNumLoggedDecisions - 1).startTime;
+	CHECK(oldest > newest);
+
+	linesWritten = 0;
+	writeSchedulerStats([](char const* line) { linesWritten += 1; });
+	// header, three lines per task, decisions header and the decisions
+	CHECK_EQUAL(1 + 2 * 3 + 1 + kNumLoggedDecisions, linesWritten);
+}
 } // namespace
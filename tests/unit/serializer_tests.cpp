@@ -0,0 +1,207 @@
+#include "CppUTest/TestHarness.h"
+#include "storage/binary_format.h"
+#include "storage/storage_manager.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kNumClips = 3;
+constexpr int32_t kNumNoteRows = 2;
+constexpr int32_t kNumNotes = 40; // Enough for the note data to span several of the binary format's chunks
+constexpr int32_t kNoteHexLength = 28;
+
+void writeNoteData(Serializer& writer, int32_t seed) {
+	writer.insertCommaIfNeeded();
+	writer.write("\n");
+	writer.printIndents();
+	writer.writeTagNameAndSeperator("noteDataWithSplitProb");
+	writer.write("\"0x");
+	for (int32_t n = 0; n < kNumNotes; n++) {
+		char buffer[9];
+		snprintf(buffer, sizeof(buffer), "%08X", n * 96 + seed);
+		writer.write(buffer);
+		snprintf(buffer, sizeof(buffer), "%08X", 24 + n);
+		writer.write(buffer);
+		snprintf(buffer, sizeof(buffer), "%02X", (n * 7 + seed) & 127);
+		writer.write(buffer);
+		writer.write("40");
+		snprintf(buffer, sizeof(buffer), "%02X", 100 - n);
+		writer.write(buffer);
+		writer.write("0000");
+		writer.write("00");
+	}
+	writer.write("\"");
+}
+
+// A cut down song, written the same way Song, InstrumentClip and NoteRow write theirs
+void writeSong(Serializer& writer) {
+	writer.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	writer.writeOpeningTagBeginning("song", true, false);
+	writer.writeFirmwareVersion();
+	writer.writeEarliestCompatibleFirmwareVersion("4.1.0-alpha");
+	writer.writeAttribute("previewNumPads", 144);
+	writer.writeAttribute("xScroll", -3072);
+	writer.writeAttributeHex("timePerTimerTick", 0x1F400, 8);
+	writer.writeAttribute("name", "Round trip");
+	uint8_t bytes[] = {0x00, 0x7F, 0x80, 0xFF};
+	writer.writeAttributeHexBytes("bytes", bytes, sizeof(bytes));
+	writer.writeOpeningTagEnd();
+
+	writer.writeTag("swingAmount", -7);
+	writer.writeTag("rootNote", "C#");
+
+	writer.writeArrayStart("sessionClips");
+	for (int32_t c = 0; c < kNumClips; c++) {
+		writer.writeOpeningTagBeginning("instrumentClip", true);
+		writer.writeAttribute("isPlaying", c == 0);
+		writer.writeAttribute("length", 384 * (c + 1));
+		writer.writeOpeningTagEnd();
+
+		writer.writeArrayStart("noteRows");
+		for (int32_t r = 0; r < kNumNoteRows; r++) {
+			writer.writeOpeningTagBeginning("noteRow", true);
+			writer.writeAttribute("y", 60 + r);
+			writeNoteData(writer, c * kNumNoteRows + r);
+			writer.closeTag(true);
+		}
+		writer.writeArrayEnding("noteRows");
+
+		writer.writeClosingTag("instrumentClip", true, true);
+	}
+	writer.writeArrayEnding("sessionClips");
+
+	writer.writeClosingTag("song", true, true);
+}
+
+bool isContainer(std::string const& name) {
+	return name == "sessionClips" || name == "instrumentClip" || name == "noteRows" || name == "noteRow";
+}
+
+bool isInt(std::string const& name) {
+	return name == "previewNumPads" || name == "xScroll" || name == "swingAmount" || name == "length" || name == "y";
+}
+
+// Reads back everything, in the order it comes, as one "path=value" line per tag or attribute - the way the model
+// code does, knowing which tags hold others and how each value should be read
+void readTags(Deserializer& reader, std::string const& path, std::vector<std::string>& lines) {
+	char const* tagName;
+	while (*(tagName = reader.readNextTagOrAttributeName())) {
+		std::string name = tagName;
+		std::string line = path + "/" + name;
+
+		if (isContainer(name)) {
+			lines.push_back(line);
+			readTags(reader, line, lines);
+		}
+		else if (name == "noteDataWithSplitProb") {
+			line += "=";
+			if (reader.prepareToReadTagOrAttributeValueOneCharAtATime()) {
+				char const* chars = reader.readNextCharsOfTagOrAttributeValue(2);
+				line += chars ? std::string(chars, 2) : "?";
+				while ((chars = reader.readNextCharsOfTagOrAttributeValue(kNoteHexLength))) {
+					line += " " + std::string(chars, kNoteHexLength);
+				}
+			}
+			lines.push_back(line);
+		}
+		else if (name == "timePerTimerTick") {
+			lines.push_back(line + "=" + std::to_string(reader.readTagOrAttributeValueHex(-1)));
+		}
+		else if (name == "bytes") {
+			uint8_t bytes[8] = {0};
+			int32_t numBytes = reader.readTagOrAttributeValueHexBytes(bytes, sizeof(bytes));
+			line += "=";
+			for (int32_t i = 0; i < numBytes; i++) {
+				line += std::to_string(bytes[i]) + " ";
+			}
+			lines.push_back(line);
+		}
+		else if (isInt(name)) {
+			lines.push_back(line + "=" + std::to_string(reader.readTagOrAttributeValueInt()));
+		}
+		else {
+			lines.push_back(line + "=" + reader.readTagOrAttributeValue());
+		}
+		reader.exitTag(name.c_str());
+	}
+}
+
+std::vector<std::string> readSong(FileDeserializer& reader, Error openError) {
+	std::vector<std::string> lines;
+	if (openError == Error::NONE) {
+		readTags(reader, "song", lines);
+	}
+	return lines;
+}
+
+std::string getFile(FileWriter& writer) {
+	return std::string(writer.getBufferPtr(), writer.bytesWritten());
+}
+
+TEST_GROUP(SerializerTests){};
+
+TEST(SerializerTests, binaryReadsBackTheSameAsXML) {
+	XMLSerializer xmlWriter;
+	xmlWriter.setMemoryBased();
+	xmlWriter.reset();
+	writeSong(xmlWriter);
+	CHECK(xmlWriter.closeFileAfterWriting() == Error::NONE);
+	std::string xmlFile = getFile(xmlWriter);
+
+	BinarySerializer binaryWriter;
+	binaryWriter.setMemoryBased();
+	binaryWriter.reset();
+	binaryWriter.writeChars(BinaryFormat::kMagic); // As StorageManager::createBinaryFile() does
+	writeSong(binaryWriter);
+	CHECK(binaryWriter.closeFileAfterWriting() == Error::NONE);
+	std::string binaryFile = getFile(binaryWriter);
+
+	XMLDeserializer xmlReader((uint8_t*)xmlFile.data(), xmlFile.size());
+	std::vector<std::string> fromXML = readSong(xmlReader, xmlReader.openXMLFile(nullptr, "song"));
+
+	BinaryDeserializer binaryReader((uint8_t*)binaryFile.data(), binaryFile.size());
+	std::vector<std::string> fromBinary = readSong(binaryReader, binaryReader.openBinaryFile(nullptr, "song"));
+
+	// Every attribute of the song, and each clip with its two note rows
+	CHECK_EQUAL(9 + 1 + kNumClips * (3 + 1 + kNumNoteRows * 3), fromXML.size());
+	CHECK_EQUAL(fromXML.size(), fromBinary.size());
+	for (size_t i = 0; i < fromXML.size(); i++) {
+		STRCMP_EQUAL(fromXML[i].c_str(), fromBinary[i].c_str());
+	}
+
+	STRCMP_EQUAL("song/firmwareVersion=TESTS", fromBinary[0].c_str());
+	STRCMP_EQUAL("song/xScroll=-3072", fromBinary[3].c_str());
+	STRCMP_EQUAL("song/timePerTimerTick=128000", fromBinary[4].c_str());
+	STRCMP_EQUAL("song/bytes=0 127 128 255 ", fromBinary[6].c_str());
+	STRCMP_EQUAL("song/swingAmount=-7", fromBinary[7].c_str());
+	STRCMP_EQUAL("song/rootNote=C#", fromBinary[8].c_str());
+
+	// Note data needs no quotes scanned for or hex decoded, so takes well under half the space
+	CHECK(binaryFile.size() * 2 < xmlFile.size());
+}
+
+TEST(SerializerTests, binaryRejectsNewerVersion) {
+	BinarySerializer writer;
+	writer.setMemoryBased();
+	writer.reset();
+	writer.writeChars(BinaryFormat::kMagic);
+	writeSong(writer);
+	writer.closeFileAfterWriting();
+	std::string file = getFile(writer);
+	file[BinaryFormat::kMagicLength - 1]++;
+
+	BinaryDeserializer reader((uint8_t*)file.data(), file.size());
+	CHECK(reader.openBinaryFile(nullptr, "song") == Error::FILE_UNSUPPORTED);
+}
+
+TEST(SerializerTests, binaryCutShortIsCorrupted) {
+	std::string file(BinaryFormat::kMagic, BinaryFormat::kMagicLength - 2);
+
+	BinaryDeserializer reader((uint8_t*)file.data(), file.size());
+	CHECK(reader.openBinaryFile(nullptr, "song") == Error::FILE_CORRUPTED);
+}
+
+} // namespace
@@ -0,0 +1,43 @@
+#include "CppUTest/TestHarness.h"
+#include "util/container/tag_table.h"
+#include <string>
+
+namespace {
+constexpr auto tags = deluge::makeTagTable({"osc1", "osc2", "mode", "oscillatorA", "oscillatorB", "lfo1", "lfo2",
+                                            "envelope1", "envelope2", "noteData", "noteDataWithLift", "y"});
+
+// Looked up at compile time too
+static_assert(tags["osc1"] == 0);
+static_assert(tags["y"] == 11);
+static_assert(tags.find("osc3") == decltype(tags)::kNotFound);
+} // namespace
+
+TEST_GROUP(TagTableTests){};
+
+TEST(TagTableTests, findsEveryName) {
+	for (int32_t i = 0; i < 12; i++) {
+		std::string name(tags.getName(i));
+		CHECK_EQUAL(i, tags.find(name.c_str()));
+	}
+}
+
+TEST(TagTableTests, matchesCaseLabels) {
+	switch (tags.find("envelope2")) {
+	case tags["envelope1"]:
+		FAIL("found the wrong tag");
+		break;
+	case tags["envelope2"]:
+		break;
+	default:
+		FAIL("didn't find the tag");
+	}
+}
+
+TEST(TagTableTests, rejectsOtherNames) {
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find(""));
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find("osc"));
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find("osc12"));
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find("noteDataWith"));
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find("Y"));
+	CHECK_EQUAL(decltype(tags)::kNotFound, tags.find("someTagFromALaterFirmware"));
+}